@@ -0,0 +1,42 @@
+//================================================================================================
+// Filename:      Instancing.hlsl
+// Description:   USE_INSTANCING 변형에서 ModelBuffer(b0)/ColorBuffer(b3)를 대체하는 인스턴스 데이터
+//                DrawMeshBatches가 같은 메시/머티리얼 배치를 DrawIndexedInstanced 한 번으로 묶을 때 사용
+//================================================================================================
+
+// 주의: 이 파일을 include 하는 셰이더는 ModelBuffer/ColorBuffer를 선언하지 않아야 함
+//       (아래 static 변수가 같은 이름으로 대신 제공됨)
+
+// t12: 인스턴스별 데이터 - ConstantBufferType.h의 FInstanceData와 정확히 일치 (160 bytes)
+struct FInstanceData
+{
+    row_major float4x4 World;
+    row_major float4x4 WorldInverseTranspose;
+    float4 Color;
+    uint ObjectID;
+    uint3 Padding;
+};
+
+StructuredBuffer<FInstanceData> g_InstanceData : register(t12);
+
+// b9: InstancingBuffer (VS) - 이번 드로우의 첫 인스턴스 위치 (SV_InstanceID는 StartInstanceLocation을 더하지 않음)
+cbuffer InstancingBuffer : register(b9)
+{
+    uint InstanceOffset;
+    uint3 InstancingPadding;
+};
+
+// 기존 셰이더 코드가 그대로 쓰는 이름들 (VS에서 LoadInstanceData, PS에서 보간값으로 채움)
+static float4x4 WorldMatrix;
+static float4x4 WorldInverseTranspose;
+static float4 LerpColor;
+static uint UUID;
+
+void LoadInstanceData(uint InstanceID)
+{
+    FInstanceData Data = g_InstanceData[InstanceOffset + InstanceID];
+    WorldMatrix = Data.World;
+    WorldInverseTranspose = Data.WorldInverseTranspose;
+    LerpColor = Data.Color;
+    UUID = Data.ObjectID;
+}
@@ -1,9 +1,13 @@
 // Model/View/Projection buffers (match other material shaders)
+#if USE_INSTANCING
+#include "../Common/Instancing.hlsl"
+#else
 cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix;
     row_major float4x4 WorldInverseTranspose;
 };
+#endif
 
 cbuffer ViewProjBuffer : register(b1)
 {
@@ -13,12 +17,14 @@ cbuffer ViewProjBuffer : register(b1)
     row_major float4x4 InverseProjectionMatrix;
 };
 
+#if !USE_INSTANCING
 // b3: ColorBuffer (PS) - 색상 블렌딩/lerp용
 cbuffer ColorBuffer : register(b3)
 {
     float4 LerpColor; // 블렌드할 색상 (알파가 블렌드 양 제어)
     uint UUID;
 }; 
+#endif
 
 cbuffer FireballCB : register(b6)
 {
@@ -46,6 +52,9 @@ struct VS_IN
     float3 Position : POSITION;
     float3 Normal : NORMAL0;
     float2 TexCoord : TEXCOORD0;
+#if USE_INSTANCING
+    uint InstanceID : SV_InstanceID;
+#endif
 };
 struct VS_OUT
 {
@@ -54,12 +63,20 @@ struct VS_OUT
     float3 Normal : NORMAL0;
     float2 UV : TEXCOORD0;
     float3 ViewDir : TEXCOORD1;
+#if USE_INSTANCING
+    nointerpolation uint InstanceUUID : INSTANCE_UUID;
+#endif
 };
 
 VS_OUT FireballVS(VS_IN In)
 {
     VS_OUT Out;
 
+#if USE_INSTANCING
+    LoadInstanceData(In.InstanceID);
+    Out.InstanceUUID = UUID;
+#endif
+
     float4 worldPos = mul(float4(In.Position, 1), WorldMatrix);
     Out.WorldPos = worldPos.xyz;
 
@@ -124,6 +141,9 @@ float get_layer_scale(float layer_index)
 PS_OUT FireballPS(VS_OUT In)
 { 
     PS_OUT o;
+#if USE_INSTANCING
+    UUID = In.InstanceUUID;
+#endif
     o.UUID = UUID; 
     // Base 2D flow
     float2 uvBase = In.UV + UVScrollSpeed * Time;
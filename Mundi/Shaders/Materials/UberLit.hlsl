@@ -28,12 +28,17 @@ struct FMaterial
 // --- 상수 버퍼 (Constant Buffers) ---
 // 조명과 StaticMeshShader 기능을 모두 지원하도록 확장
 
+#if USE_INSTANCING
+// 인스턴싱 변형: 월드 행렬/색상/UUID를 인스턴스 버퍼(t12)에서 읽음
+#include "../Common/Instancing.hlsl"
+#else
 // b0: ModelBuffer (VS) - ModelBufferType과 정확히 일치 (128 bytes)
 cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix;              // 64 bytes
     row_major float4x4 WorldInverseTranspose;    // 64 bytes - 올바른 노멀 변환을 위함
 };
+#endif
 
 // b1: ViewProjBuffer (VS) - ViewProjBufferType과 일치
 cbuffer ViewProjBuffer : register(b1)
@@ -44,12 +49,14 @@ cbuffer ViewProjBuffer : register(b1)
     row_major float4x4 InverseProjectionMatrix;
 };
 
+#if !USE_INSTANCING
 // b3: ColorBuffer (PS) - 색상 블렌딩/lerp용
 cbuffer ColorBuffer : register(b3)
 {
     float4 LerpColor;   // 블렌드할 색상 (알파가 블렌드 양 제어)
     uint UUID;
 };
+#endif
 
 // b4: PixelConstBuffer (VS+PS) - OBJ 파일의 머티리얼 정보
 // FPixelConstBufferType과 정확히 일치해야 함!
@@ -104,6 +111,9 @@ struct VS_INPUT
     float2 TexCoord : TEXCOORD0;
     float4 Tangent : TANGENT0;
     float4 Color : COLOR;
+#if USE_INSTANCING
+    uint InstanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
@@ -114,6 +124,10 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#if USE_INSTANCING
+    nointerpolation float4 InstanceColor : INSTANCE_COLOR;
+    nointerpolation uint InstanceUUID : INSTANCE_UUID;
+#endif
 };
 
 struct PS_OUTPUT
@@ -128,6 +142,12 @@ struct PS_OUTPUT
 PS_INPUT mainVS(VS_INPUT Input)
 {
     PS_INPUT Out;
+
+#if USE_INSTANCING
+    LoadInstanceData(Input.InstanceID);
+    Out.InstanceColor = LerpColor;
+    Out.InstanceUUID = UUID;
+#endif
     
     // 위치를 월드 공간으로 먼저 변환
     float4 worldPos = mul(float4(Input.Position, 1.0f), WorldMatrix);
@@ -231,6 +251,10 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#if USE_INSTANCING
+    LerpColor = Input.InstanceColor;
+    UUID = Input.InstanceUUID;
+#endif
     Output.UUID = UUID;
     
     //CSM 구간 시각화
@@ -0,0 +1,30 @@
+// 섀도우 아틀라스에서 현재 뷰포트 영역만 초기화하는 셰이더
+// ClearDepthStencilView는 아틀라스 전체를 지우므로, 캐시된 다른 섀도우 뷰를 보존하려면
+// 뷰포트를 덮는 사각형을 가장 먼 깊이(1.0)로 그려서 해당 영역만 지운다.
+// C++ 코드에서 깊이 테스트 Always + 깊이 쓰기 상태로 DeviceContext->Draw(6, 0); 호출
+
+struct VS_OUTPUT
+{
+    float4 Position : SV_POSITION;
+};
+
+VS_OUTPUT mainVS(uint VertexID : SV_VertexID)
+{
+    VS_OUTPUT Out;
+
+    const float2 Positions[6] =
+    {
+        float2(-1, 1), float2(1, 1), float2(-1, -1), // 첫 번째 삼각형
+        float2(-1, -1), float2(1, 1), float2(1, -1) // 두 번째 삼각형
+    };
+
+    // z = w = 1 → NDC 깊이 1.0 (Far)
+    Out.Position = float4(Positions[VertexID], 1.0f, 1.0f);
+    return Out;
+}
+
+// VSM 모멘트 초기값 (기존 ClearRenderTargetView의 {1, 1, 0, 0}과 동일)
+float2 mainPS(VS_OUTPUT Input) : SV_TARGET
+{
+    return float2(1.0f, 1.0f);
+}
@@ -0,0 +1,106 @@
+﻿#include "pch.h"
+#include "AssetPreload.h"
+#include "ParallelFor.h"
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	bool HasExtension(const fs::path& Path, const TArray<FString>& Extensions)
+	{
+		const FString Extension = AssetPreload::GetLowerExtension(Path.string());
+		return std::find(Extensions.begin(), Extensions.end(), Extension) != Extensions.end();
+	}
+
+	void DiscoverFilesRecursive(const fs::path& Dir, const TArray<FString>& Extensions, TArray<FString>& OutFiles)
+	{
+		std::error_code Ec;
+		for (fs::recursive_directory_iterator It(Dir, fs::directory_options::skip_permission_denied, Ec), End; !Ec && It != End; It.increment(Ec))
+		{
+			if (It->is_regular_file(Ec) && HasExtension(It->path(), Extensions))
+			{
+				OutFiles.Add(NormalizePath(It->path().string()));
+			}
+		}
+		if (Ec)
+		{
+			UE_LOG("[Preload] Failed to scan '%s': %s", Dir.string().c_str(), Ec.message().c_str());
+		}
+	}
+}
+
+FString AssetPreload::GetLowerExtension(const FString& Path)
+{
+	FString Extension = fs::path(Path).extension().string();
+	std::transform(Extension.begin(), Extension.end(), Extension.begin(),
+		[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return Extension;
+}
+
+TArray<FString> AssetPreload::DiscoverFiles(const FString& RootDir, const TArray<FString>& Extensions)
+{
+	TArray<FString> Files;
+
+	const fs::path Root(RootDir);
+	std::error_code Ec;
+	if (!fs::is_directory(Root, Ec))
+	{
+		return Files;
+	}
+
+	// 최상위 파일은 바로 수집하고, 하위 폴더는 병렬 탐색 대상으로 모음
+	TArray<fs::path> SubDirs;
+	for (fs::directory_iterator It(Root, fs::directory_options::skip_permission_denied, Ec), End; !Ec && It != End; It.increment(Ec))
+	{
+		if (It->is_directory(Ec))
+		{
+			SubDirs.Add(It->path());
+		}
+		else if (It->is_regular_file(Ec) && HasExtension(It->path(), Extensions))
+		{
+			Files.Add(NormalizePath(It->path().string()));
+		}
+	}
+
+	TArray<TArray<FString>> SubDirFiles;
+	SubDirFiles.resize(SubDirs.size());
+	ParallelFor::Run(SubDirs.Num(), 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 i = Begin; i < End; ++i)
+			{
+				DiscoverFilesRecursive(SubDirs[i], Extensions, SubDirFiles[i]);
+			}
+		});
+
+	for (TArray<FString>& DirFiles : SubDirFiles)
+	{
+		Files.insert(Files.end(), std::make_move_iterator(DirFiles.begin()), std::make_move_iterator(DirFiles.end()));
+	}
+
+	// 디렉터리 순회 순서와 무관하게 등록 순서를 고정
+	std::sort(Files.begin(), Files.end());
+	Files.erase(std::unique(Files.begin(), Files.end()), Files.end());
+	return Files;
+}
+
+FPreloadProgress::FPreloadProgress(const char* InLabel, int32 InTotal)
+	: Label(InLabel)
+	, Total(InTotal)
+{
+}
+
+void FPreloadProgress::Advance()
+{
+	const int32 Done = Completed.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (Total <= 0)
+	{
+		return;
+	}
+
+	const int32 Step = Done * 10 / Total;
+	if (Step != (Done - 1) * 10 / Total)
+	{
+		UE_LOG("[Preload] %s: %d / %d (%d%%)", Label, Done, Total, Step * 10);
+	}
+}
@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#include "UEContainer.h"
+#include <atomic>
+
+// ─────────────────────────────────────────────
+// AssetPreload
+//  - FObjManager / FFbxManager 프리로드 공용 유틸
+//  - 파일 탐색과 CPU 작업(캐시 검사/역직렬화/파싱/텍스처 변환)은 ParallelFor 워커에서,
+//    UObject 생성과 GPU 리소스 생성은 메인(디바이스) 스레드에서 정렬된 순서대로 수행
+// ─────────────────────────────────────────────
+namespace AssetPreload
+{
+	// RootDir 아래에서 Extensions(소문자, 점 포함) 중 하나에 해당하는 파일을 수집
+	// 최상위 하위 폴더 단위로 병렬 탐색하며, 결과는 정규화 + 정렬 + 중복 제거되어 항상 같은 순서
+	TArray<FString> DiscoverFiles(const FString& RootDir, const TArray<FString>& Extensions);
+
+	// 소문자 확장자 (점 포함, 예: ".obj")
+	FString GetLowerExtension(const FString& Path);
+}
+
+// 프리로드 진행률 카운터 (워커 스레드에서 Advance, 10% 단위로 로그)
+class FPreloadProgress
+{
+public:
+	FPreloadProgress(const char* InLabel, int32 InTotal);
+
+	void Advance();
+
+	int32 GetCompleted() const { return Completed.load(std::memory_order_relaxed); }
+	int32 GetTotal() const { return Total; }
+
+private:
+	const char* Label;
+	int32 Total;
+	std::atomic<int32> Completed{ 0 };
+};
@@ -0,0 +1,1204 @@
+﻿#include "pch.h"
+#include "DevBenchmarks.h"
+
+#if MUNDI_DEV_BENCHMARKS
+
+#include "BVHierarchy.h"
+#include "CPUSkinning.h"
+#include "FbxCache.h"
+#include "WindowsBinReader.h"
+#include "WindowsMappedReader.h"
+#include "ObjManager.h"
+#include "AssetPreload.h"
+#include "TickTaskManager.h"
+#include "Actor.h"
+#include "SceneComponent.h"
+#include "RotatingMovementComponent.h"
+#include "ProjectileMovementComponent.h"
+#include "ActorComponent.h"
+#include "ObjectFactory.h"
+#include "StaticMeshActor.h"
+#include "PrefabCache.h"
+#include "ActorPool.h"
+#include "JsonDocument.h"
+#include "BinarySerializer.h"
+#include "Level.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <random>
+#include <psapi.h>
+
+#pragma comment(lib, "psapi")
+
+namespace fs = std::filesystem;
+
+//====================================================================================
+// BVH 리핏 (BVH BENCH)
+//====================================================================================
+
+// 실제 컴포넌트 없이 바운드만으로 트리를 구성한다. 키 포인터는 맵 조회용 식별자로만 쓰이고
+// 역참조되지 않는다 (BuildRange/Refit 모두 캐시된 바운드 사용). 매 프레임 NumMoving개의 박스를 이동시킨 뒤 FlushRebuild 시간을 측정.
+void DevBenchmarks::RunBvhRefitBenchmark(int32 NumComponents, int32 NumMoving, int32 NumFrames)
+{
+	if (NumComponents <= 0 || NumFrames <= 0) return;
+	NumMoving = std::clamp(NumMoving, 0, NumComponents);
+
+	TArray<UPrimitiveComponent*> Keys;
+	Keys.resize(NumComponents);
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		Keys[i] = reinterpret_cast<UPrimitiveComponent*>(static_cast<uintptr_t>(i + 1) * 16);
+	}
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> PositionDist(-1000.0f, 1000.0f);
+	std::uniform_real_distribution<float> SizeDist(0.5f, 5.0f);
+	std::uniform_real_distribution<float> VelocityDist(-2.0f, 2.0f);
+
+	TArray<FAABB> InitialBoxes;
+	InitialBoxes.resize(NumComponents);
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		const FVector Center(PositionDist(Rng), PositionDist(Rng), PositionDist(Rng));
+		const FVector Half(SizeDist(Rng), SizeDist(Rng), SizeDist(Rng));
+		InitialBoxes[i] = FAABB(Center - Half, Center + Half);
+	}
+
+	// 움직이는 컴포넌트는 전체에 고르게 분포 (투사체처럼 서로 다른 위치에서 이동)
+	const int32 Stride = NumMoving > 0 ? std::max(1, NumComponents / NumMoving) : 1;
+	TArray<FVector> Velocities;
+	Velocities.resize(NumMoving);
+	for (int32 m = 0; m < NumMoving; ++m)
+	{
+		Velocities[m] = FVector(VelocityDist(Rng), VelocityDist(Rng), VelocityDist(Rng));
+	}
+
+	auto RunMode = [&](bool bForceRebuild, float& OutFinalCost, int32& OutRebuildCount) -> double
+		{
+			FBVHierarchy Tree(FAABB(), 0, 8, 1);
+			for (int32 i = 0; i < NumComponents; ++i)
+			{
+				Tree.StaticMeshComponentBounds.Add(Keys[i], InitialBoxes[i]);
+			}
+			Tree.BuildLBVH();
+
+			TArray<FAABB> Boxes = InitialBoxes;
+			uint64 TotalCycles = 0;
+			OutRebuildCount = 0;
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				for (int32 m = 0; m < NumMoving; ++m)
+				{
+					const int32 Index = (m * Stride) % NumComponents;
+					Boxes[Index].Min += Velocities[m];
+					Boxes[Index].Max += Velocities[m];
+					Tree.UpdateComponentBounds(Keys[Index], Boxes[Index]);
+				}
+				if (bForceRebuild)
+				{
+					Tree.bPendingRebuild = true;
+				}
+
+				const float CostBefore = Tree.BuildAreaCost;
+				const uint64 Start = FPlatformTime::Cycles64();
+				Tree.FlushRebuild();
+				TotalCycles += FPlatformTime::Cycles64() - Start;
+
+				// BuildLBVH가 돌면 기준 비용이 다시 계산됨
+				if (bForceRebuild || Tree.BuildAreaCost != CostBefore)
+				{
+					++OutRebuildCount;
+				}
+			}
+			OutFinalCost = Tree.GetNormalizedAreaCost();
+			return FPlatformTime::ToMilliseconds(TotalCycles) / NumFrames;
+		};
+
+	float RebuildCost = 0.0f, RefitCost = 0.0f;
+	int32 RebuildCount = 0, RefitRebuildCount = 0;
+	const double RebuildMs = RunMode(true, RebuildCost, RebuildCount);
+	const double RefitMs = RunMode(false, RefitCost, RefitRebuildCount);
+
+	UE_LOG("[BVH Bench] N=%d Moving=%d Frames=%d", NumComponents, NumMoving, NumFrames);
+	UE_LOG("[BVH Bench]   Rebuild: %.3f ms/frame (SAH cost %.2f)", RebuildMs, RebuildCost);
+	UE_LOG("[BVH Bench]   Refit  : %.3f ms/frame (SAH cost %.2f, heuristic rebuilds %d) -> x%.1f",
+		RefitMs, RefitCost, RefitRebuildCount, RefitMs > 0.0 ? RebuildMs / RefitMs : 0.0);
+}
+
+//====================================================================================
+// CPU 스키닝 (SKINNING TEST)
+//====================================================================================
+
+// 합성 팔레트/정점으로 SIMD/병렬 커널 결과를 스칼라 결과와 비교 (렌더러 없이 실행 가능)
+bool DevBenchmarks::RunSkinningSelfTest(int32 NumVertices, int32 NumBones, int32 NumIterations)
+{
+	if (NumVertices <= 0 || NumBones <= 0 || NumIterations <= 0) return false;
+	NumBones = std::min(NumBones, static_cast<int32>(FSkinnedVertex::InvalidBoneIndex));
+
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> ScaleDist(0.5f, 2.0f);
+	std::uniform_int_distribution<int32> BoneDist(0, NumBones - 1);
+	std::uniform_int_distribution<int32> InfluenceDist(0, 4);
+
+	// 1. 합성 팔레트 (회전 + 비균등 스케일 + 이동)
+	TArray<FMatrix> BoneMatrices;
+	TArray<FMatrix> NormalMatrices;
+	BoneMatrices.resize(NumBones);
+	NormalMatrices.resize(NumBones);
+	for (int32 b = 0; b < NumBones; ++b)
+	{
+		const FVector Axis(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng) + 2.0f);
+		const FQuat Rotation = FQuat::FromAxisAngle(Axis, UnitDist(Rng) * PI);
+		const FVector Translation(UnitDist(Rng) * 100.0f, UnitDist(Rng) * 100.0f, UnitDist(Rng) * 100.0f);
+		const FVector Scale(ScaleDist(Rng), ScaleDist(Rng), ScaleDist(Rng));
+		BoneMatrices[b] = FTransform(Translation, Rotation, Scale).ToMatrix();
+		NormalMatrices[b] = BoneMatrices[b].Transpose().InverseAffine();
+	}
+
+	// 2. 합성 정점 (0~4개 영향, 내림차순 가중치)
+	TArray<FSkinnedVertex> Vertices;
+	Vertices.resize(NumVertices);
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		FSkinnedVertex& V = Vertices[i];
+		V.Position = FVector(UnitDist(Rng) * 50.0f, UnitDist(Rng) * 50.0f, UnitDist(Rng) * 50.0f);
+		V.Normal = FVector(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng) + 2.0f).GetNormalized();
+		const FVector T = FVector::Cross(V.Normal, FVector(0, 0, 1)).GetNormalized();
+		V.Tangent = FVector4(T.X, T.Y, T.Z, UnitDist(Rng) < 0.0f ? -1.0f : 1.0f);
+		V.UV = FVector2D(UnitDist(Rng), UnitDist(Rng));
+		V.Color = FVector4(1, 1, 1, 1);
+
+		const int32 InfluenceCount = InfluenceDist(Rng);
+		uint16 BoneIndices[4] = {};
+		float Weights[4] = {};
+		float Total = 0.0f;
+		for (int32 j = 0; j < InfluenceCount; ++j)
+		{
+			BoneIndices[j] = static_cast<uint16>(BoneDist(Rng));
+			Weights[j] = std::fabs(UnitDist(Rng)) + 0.05f;
+			Total += Weights[j];
+		}
+		std::sort(Weights, Weights + InfluenceCount, std::greater<float>());
+		for (int32 j = 0; j < InfluenceCount; ++j)
+		{
+			Weights[j] /= Total;
+		}
+		V.SetBoneInfluences(BoneIndices, Weights, InfluenceCount);
+	}
+
+	const FSkinningPalette Palette{ BoneMatrices.data(), NormalMatrices.data(), NumBones };
+
+	TArray<FVertexDynamic> Reference, Simd, Parallel;
+	Reference.resize(NumVertices);
+	Simd.resize(NumVertices);
+	Parallel.resize(NumVertices);
+
+	// 3. 시간 측정
+	auto Measure = [&](auto&& Func) -> double
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 It = 0; It < NumIterations; ++It)
+		{
+			Func();
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / NumIterations;
+	};
+
+	const double ReferenceMs = Measure([&]() { CPUSkinning::SkinVerticesReference(Vertices.data(), Reference.data(), 0, NumVertices, Palette); });
+	const double SimdMs = Measure([&]() { CPUSkinning::SkinVertices(Vertices.data(), Simd.data(), 0, NumVertices, Palette); });
+	const double ParallelMs = Measure([&]() { CPUSkinning::SkinVerticesParallel(Vertices.data(), Parallel.data(), NumVertices, Palette); });
+
+	// 4. 스칼라 결과와 비교 (위치는 상대 오차)
+	float MaxPositionError = 0.0f, MaxNormalError = 0.0f, MaxTangentError = 0.0f;
+	auto Compare = [&](const TArray<FVertexDynamic>& Result)
+	{
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FVertexDynamic& A = Reference[i];
+			const FVertexDynamic& B = Result[i];
+			const float PositionScale = std::max(1.0f, A.Position.Size());
+			MaxPositionError = std::max(MaxPositionError, (A.Position - B.Position).Size() / PositionScale);
+			MaxNormalError = std::max(MaxNormalError, (A.Normal - B.Normal).Size());
+			const FVector TangentA(A.Tangent.X, A.Tangent.Y, A.Tangent.Z);
+			const FVector TangentB(B.Tangent.X, B.Tangent.Y, B.Tangent.Z);
+			MaxTangentError = std::max(MaxTangentError, (TangentA - TangentB).Size() + std::fabs(A.Tangent.W - B.Tangent.W));
+		}
+	};
+	Compare(Simd);
+	Compare(Parallel);
+
+	constexpr float Tolerance = 1e-3f;
+	const bool bPassed = MaxPositionError < Tolerance && MaxNormalError < Tolerance && MaxTangentError < Tolerance;
+
+	UE_LOG("[Skinning Test] Vertices=%d Bones=%d Workers=%d", NumVertices, NumBones, ParallelFor::GetNumWorkers());
+	UE_LOG("[Skinning Test]   Scalar  : %.3f ms", ReferenceMs);
+	UE_LOG("[Skinning Test]   SIMD    : %.3f ms -> x%.1f", SimdMs, SimdMs > 0.0 ? ReferenceMs / SimdMs : 0.0);
+	UE_LOG("[Skinning Test]   Parallel: %.3f ms -> x%.1f", ParallelMs, ParallelMs > 0.0 ? ReferenceMs / ParallelMs : 0.0);
+	UE_LOG("[Skinning Test]   Max error pos %.2e / normal %.2e / tangent %.2e : %s",
+		MaxPositionError, MaxNormalError, MaxTangentError, bPassed ? "PASS" : "FAIL");
+	return bPassed;
+}
+
+//====================================================================================
+// 메시 캐시 로드 (CACHE BENCH)
+//====================================================================================
+
+namespace
+{
+	// GCacheDir 아래 모든 메시/머티리얼 캐시를 두 리더로 각각 읽어서 시간 비교
+	//  - Cold: 매 패스 전에 FILE_FLAG_NO_BUFFERING 으로 열어 OS 파일 캐시를 비우도록 시도 (최선 노력)
+	//  - Warm: 파일 캐시에 올라온 상태에서 반복 측정한 평균
+	struct FCacheBenchmarkFiles
+	{
+		TArray<FString> StaticMeshes;
+		TArray<FString> SkeletalMeshes;
+		TArray<FString> Materials;
+		uint64 TotalBytes = 0;
+	};
+
+	bool EndsWith(const FString& Str, const char* Suffix)
+	{
+		const size_t SuffixLen = strlen(Suffix);
+		return Str.size() >= SuffixLen && Str.compare(Str.size() - SuffixLen, SuffixLen, Suffix) == 0;
+	}
+
+	void EvictFileFromSystemCache(const FString& Path)
+	{
+		// 비버퍼링 핸들을 열면 해당 파일의 캐시된 페이지가 정리됨 (다른 곳에서 매핑 중이면 무시됨)
+		HANDLE Handle = ::CreateFileW(UTF8ToWide(Path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+			OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+		if (Handle != INVALID_HANDLE_VALUE)
+		{
+			::CloseHandle(Handle);
+		}
+	}
+
+	template<typename TReader>
+	int32 LoadAllCachesWith(const FCacheBenchmarkFiles& Files)
+	{
+		int32 NumFailed = 0;
+
+		for (const FString& Path : Files.StaticMeshes)
+		{
+			try
+			{
+				TReader Reader(Path);
+				if (!Reader.IsOpen()) throw std::runtime_error("open failed");
+				FStaticMesh Mesh;
+				Reader << Mesh;
+			}
+			catch (const std::exception&) { ++NumFailed; }
+		}
+
+		// 스켈레탈 캐시는 UObject를 만들지 않도록 바이트 읽기 + 체크섬 검증까지만 측정
+		for (const FString& Path : Files.SkeletalMeshes)
+		{
+			try
+			{
+				TReader Reader(Path);
+				if (!Reader.IsOpen()) throw std::runtime_error("open failed");
+				const uint64 Size = fs::file_size(Path);
+
+				TArray<uint8> Bytes;
+				const uint8* Data = Reader.ReadView(static_cast<int64>(Size));
+				if (!Data)
+				{
+					Bytes.resize(Size);
+					Reader.Serialize(Bytes.data(), static_cast<int64>(Size));
+					Data = Bytes.data();
+				}
+
+				if (!VerifySkeletalCacheChecksum(Data, Size))
+				{
+					throw std::runtime_error("checksum");
+				}
+			}
+			catch (const std::exception&) { ++NumFailed; }
+		}
+
+		for (const FString& Path : Files.Materials)
+		{
+			try
+			{
+				TReader Reader(Path);
+				if (!Reader.IsOpen()) throw std::runtime_error("open failed");
+				TArray<FMaterialInfo> MaterialInfos;
+				Serialization::ReadArray(Reader, MaterialInfos);
+			}
+			catch (const std::exception&) { ++NumFailed; }
+		}
+
+		return NumFailed;
+	}
+
+	template<typename TReader>
+	double TimeCachePass(const FCacheBenchmarkFiles& Files, bool bCold, int32& OutNumFailed)
+	{
+		if (bCold)
+		{
+			for (const FString& Path : Files.StaticMeshes) EvictFileFromSystemCache(Path);
+			for (const FString& Path : Files.SkeletalMeshes) EvictFileFromSystemCache(Path);
+			for (const FString& Path : Files.Materials) EvictFileFromSystemCache(Path);
+		}
+
+		const uint64 Start = FPlatformTime::Cycles64();
+		OutNumFailed = LoadAllCachesWith<TReader>(Files);
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+}
+
+void DevBenchmarks::RunMeshCacheLoadBenchmark(int32 NumWarmPasses)
+{
+	FCacheBenchmarkFiles Files;
+
+	std::error_code Ec;
+	for (const auto& Entry : fs::recursive_directory_iterator(GCacheDir, Ec))
+	{
+		if (!Entry.is_regular_file()) continue;
+
+		const FString Path = Entry.path().generic_string();
+		if (EndsWith(Path, ".mat.bin"))
+		{
+			Files.Materials.Add(Path);
+		}
+		else if (EndsWith(Path, ".skel.bin"))
+		{
+			Files.SkeletalMeshes.Add(Path);
+		}
+		else if (EndsWith(Path, ".bin"))
+		{
+			Files.StaticMeshes.Add(Path);
+		}
+		else
+		{
+			continue;
+		}
+		Files.TotalBytes += Entry.file_size();
+	}
+
+	if (Files.StaticMeshes.empty() && Files.SkeletalMeshes.empty())
+	{
+		UE_LOG("[Cache Bench] No mesh caches under '%s'. Load some assets first.", GCacheDir.c_str());
+		return;
+	}
+
+	UE_LOG("[Cache Bench] %d static, %d skeletal, %d material caches (%.2f MB)",
+		Files.StaticMeshes.Num(), Files.SkeletalMeshes.Num(), Files.Materials.Num(),
+		static_cast<double>(Files.TotalBytes) / (1024.0 * 1024.0));
+
+	int32 NumFailed = 0;
+	const double StreamCold = TimeCachePass<FWindowsBinReader>(Files, true, NumFailed);
+	const double MappedCold = TimeCachePass<FWindowsMappedReader>(Files, true, NumFailed);
+
+	double StreamWarm = 0.0;
+	double MappedWarm = 0.0;
+	NumWarmPasses = std::max(NumWarmPasses, 1);
+	for (int32 Pass = 0; Pass < NumWarmPasses; ++Pass)
+	{
+		StreamWarm += TimeCachePass<FWindowsBinReader>(Files, false, NumFailed);
+		MappedWarm += TimeCachePass<FWindowsMappedReader>(Files, false, NumFailed);
+	}
+	StreamWarm /= NumWarmPasses;
+	MappedWarm /= NumWarmPasses;
+
+	UE_LOG("[Cache Bench] Cold : stream %.2f ms, mapped %.2f ms (x%.2f)", StreamCold, MappedCold, MappedCold > 0.0 ? StreamCold / MappedCold : 0.0);
+	UE_LOG("[Cache Bench] Warm : stream %.2f ms, mapped %.2f ms (x%.2f, avg of %d)", StreamWarm, MappedWarm, MappedWarm > 0.0 ? StreamWarm / MappedWarm : 0.0, NumWarmPasses);
+	if (NumFailed > 0)
+	{
+		UE_LOG("[Cache Bench] %d caches failed to load (outdated or corrupt)", NumFailed);
+	}
+}
+
+//====================================================================================
+// OBJ 파서 (OBJ BENCH)
+//====================================================================================
+
+namespace
+{
+	// 격자 메시를 v/vt/vn/f + usemtl 구간으로 기록 (파서 벤치마크용 대용량 입력)
+	bool WriteSyntheticObj(const FString& Path, int32 GridSize)
+	{
+		std::ofstream Out(UTF8ToWide(Path), std::ios::binary | std::ios::trunc);
+		if (!Out)
+		{
+			return false;
+		}
+
+		FString Buffer;
+		Buffer.reserve(1 << 20);
+		char Line[128];
+		auto Flush = [&]()
+		{
+			Out.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+			Buffer.clear();
+		};
+
+		Buffer += "# Mundi OBJ parser benchmark\n";
+		const int32 NumVerts = GridSize + 1;
+		for (int32 Y = 0; Y < NumVerts; ++Y)
+		{
+			for (int32 X = 0; X < NumVerts; ++X)
+			{
+				const float Fx = static_cast<float>(X) * 0.1f;
+				const float Fy = static_cast<float>(Y) * 0.1f;
+				const float Fz = std::sin(Fx) * std::cos(Fy);
+				snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\n", Fx, Fy, Fz);
+				Buffer += Line;
+				snprintf(Line, sizeof(Line), "vt %.6f %.6f\n", static_cast<float>(X) / GridSize, static_cast<float>(Y) / GridSize);
+				Buffer += Line;
+				snprintf(Line, sizeof(Line), "vn %.6f %.6f %.6f\n", -Fz, 0.0f, 1.0f);
+				Buffer += Line;
+			}
+			if (Buffer.size() > (1 << 20)) Flush();
+		}
+
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			// 64행마다 머티리얼 구간을 바꿔 그룹 병합 경로까지 검증
+			if (Y % 64 == 0)
+			{
+				snprintf(Line, sizeof(Line), "usemtl Bench_%d\n", (Y / 64) % 4);
+				Buffer += Line;
+			}
+			for (int32 X = 0; X < GridSize; ++X)
+			{
+				const int32 I0 = Y * NumVerts + X + 1;
+				const int32 I1 = I0 + 1;
+				const int32 I2 = I1 + NumVerts;
+				const int32 I3 = I0 + NumVerts;
+				snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", I0, I0, I0, I1, I1, I1, I2, I2, I2, I3, I3, I3);
+				Buffer += Line;
+			}
+			if (Buffer.size() > (1 << 20)) Flush();
+		}
+		Flush();
+		return static_cast<bool>(Out);
+	}
+
+	template<typename T>
+	bool IsSameArrayBits(const TArray<T>& A, const TArray<T>& B)
+	{
+		return A.size() == B.size() && (A.empty() || std::memcmp(A.data(), B.data(), A.size() * sizeof(T)) == 0);
+	}
+
+	bool IsSameObjInfo(const FObjInfo& A, const FObjInfo& B)
+	{
+		return IsSameArrayBits(A.Positions, B.Positions)
+			&& IsSameArrayBits(A.TexCoords, B.TexCoords)
+			&& IsSameArrayBits(A.Normals, B.Normals)
+			&& IsSameArrayBits(A.PositionIndices, B.PositionIndices)
+			&& IsSameArrayBits(A.TexCoordIndices, B.TexCoordIndices)
+			&& IsSameArrayBits(A.NormalIndices, B.NormalIndices)
+			&& IsSameArrayBits(A.GroupIndexStartArray, B.GroupIndexStartArray)
+			&& IsSameArrayBits(A.GroupMaterialArray, B.GroupMaterialArray)
+			&& A.MaterialNames == B.MaterialNames
+			&& A.ObjFileName == B.ObjFileName
+			&& A.bHasMtl == B.bHasMtl;
+	}
+
+	bool IsSameMaterialInfos(const TArray<FMaterialInfo>& A, const TArray<FMaterialInfo>& B)
+	{
+		if (A.size() != B.size()) return false;
+		for (size_t i = 0; i < A.size(); ++i)
+		{
+			const FMaterialInfo& L = A[i];
+			const FMaterialInfo& R = B[i];
+			if (L.MaterialName != R.MaterialName
+				|| std::memcmp(&L.DiffuseColor, &R.DiffuseColor, sizeof(FVector)) != 0
+				|| std::memcmp(&L.AmbientColor, &R.AmbientColor, sizeof(FVector)) != 0
+				|| std::memcmp(&L.SpecularColor, &R.SpecularColor, sizeof(FVector)) != 0
+				|| std::memcmp(&L.EmissiveColor, &R.EmissiveColor, sizeof(FVector)) != 0
+				|| L.Transparency != R.Transparency
+				|| L.SpecularExponent != R.SpecularExponent
+				|| L.IlluminationModel != R.IlluminationModel
+				|| L.DiffuseTextureFileName != R.DiffuseTextureFileName
+				|| L.NormalTextureFileName != R.NormalTextureFileName)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	struct FObjParseTiming
+	{
+		double ReferenceMs = 0.0;
+		double FastMs = 0.0;
+		bool bMatch = true;
+	};
+
+	FObjParseTiming TimeObjParsers(const FString& Path, int32 NumPasses)
+	{
+		FObjParseTiming Timing;
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			FObjInfo RefInfo;
+			TArray<FMaterialInfo> RefMaterials;
+			uint64 Start = FPlatformTime::Cycles64();
+			const bool bRefOk = FObjImporter::LoadObjModelReference(Path, &RefInfo, RefMaterials);
+			Timing.ReferenceMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			FObjInfo FastInfo;
+			TArray<FMaterialInfo> FastMaterials;
+			Start = FPlatformTime::Cycles64();
+			const bool bFastOk = FObjImporter::LoadObjModel(Path, &FastInfo, FastMaterials);
+			Timing.FastMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Timing.bMatch = Timing.bMatch && bRefOk == bFastOk
+				&& IsSameObjInfo(RefInfo, FastInfo) && IsSameMaterialInfos(RefMaterials, FastMaterials);
+		}
+		Timing.ReferenceMs /= NumPasses;
+		Timing.FastMs /= NumPasses;
+		return Timing;
+	}
+}
+
+void DevBenchmarks::RunObjParserBenchmark()
+{
+	const FString SyntheticPath = GCacheDir + "/ObjParserBench.obj";
+	std::error_code Ec;
+	fs::create_directories(UTF8ToWide(GCacheDir), Ec);
+	if (!WriteSyntheticObj(SyntheticPath, 600))
+	{
+		UE_LOG("[OBJ Bench] Failed to write '%s'", SyntheticPath.c_str());
+		return;
+	}
+
+	const double SyntheticMB = static_cast<double>(fs::file_size(UTF8ToWide(SyntheticPath), Ec)) / (1024.0 * 1024.0);
+	const FObjParseTiming Synthetic = TimeObjParsers(SyntheticPath, 3);
+	UE_LOG("[OBJ Bench] Synthetic %.1f MB : stream %.2f ms, fast %.2f ms (x%.2f) %s",
+		SyntheticMB, Synthetic.ReferenceMs, Synthetic.FastMs,
+		Synthetic.FastMs > 0.0 ? Synthetic.ReferenceMs / Synthetic.FastMs : 0.0,
+		Synthetic.bMatch ? "identical" : "MISMATCH");
+	fs::remove(UTF8ToWide(SyntheticPath), Ec);
+
+	// Data 폴더의 실제 OBJ들 (머티리얼/그룹/특수 포맷 검증)
+	double TotalReferenceMs = 0.0;
+	double TotalFastMs = 0.0;
+	int32 NumFiles = 0;
+	int32 NumMismatch = 0;
+	for (const FString& Path : AssetPreload::DiscoverFiles(GDataDir, { ".obj" }))
+	{
+		const FObjParseTiming Timing = TimeObjParsers(Path, 1);
+		TotalReferenceMs += Timing.ReferenceMs;
+		TotalFastMs += Timing.FastMs;
+		++NumFiles;
+		if (!Timing.bMatch)
+		{
+			++NumMismatch;
+			UE_LOG("[OBJ Bench] MISMATCH: %s", Path.c_str());
+		}
+	}
+
+	UE_LOG("[OBJ Bench] Data %d files : stream %.2f ms, fast %.2f ms (x%.2f), %d mismatches",
+		NumFiles, TotalReferenceMs, TotalFastMs, TotalFastMs > 0.0 ? TotalReferenceMs / TotalFastMs : 0.0, NumMismatch);
+}
+
+//====================================================================================
+// 병렬 틱 (TICK BENCH)
+//====================================================================================
+
+void DevBenchmarks::RunTickBenchmark(int32 NumActors, int32 NumFrames)
+{
+	// 월드/레벨에 등록하지 않은 액터를 만들어 틱만 측정 (렌더/파티션 영향 제거)
+	std::mt19937 Rng(1234);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	auto CreateActors = [&](TArray<AActor*>& OutActors)
+	{
+		Rng.seed(1234);
+		OutActors.reserve(NumActors);
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			AActor* Actor = ObjectFactory::NewObject<AActor>();
+			Actor->SetWorld(GWorld); // AActor::Tick의 에디터 틱 판정용 (레벨에는 추가하지 않음)
+			USceneComponent* Root = Actor->CreateDefaultSubobject<USceneComponent>("Root");
+			Actor->SetRootComponent(Root);
+			Root->SetRegistered(true);
+			Root->SetRelativeLocation(FVector(Unit(Rng), Unit(Rng), Unit(Rng)) * 100.0f);
+
+			UMovementComponent* Movement = nullptr;
+			if (i % 2 == 0)
+			{
+				URotatingMovementComponent* Rotating = Actor->CreateDefaultSubobject<URotatingMovementComponent>("Rotating");
+				Rotating->SetRotationRate(FVector(Unit(Rng), Unit(Rng), Unit(Rng)) * 90.0f);
+				Movement = Rotating;
+			}
+			else
+			{
+				UProjectileMovementComponent* Projectile = Actor->CreateDefaultSubobject<UProjectileMovementComponent>("Projectile");
+				Projectile->SetVelocity(FVector(Unit(Rng), Unit(Rng), Unit(Rng)) * 10.0f);
+				Movement = Projectile;
+			}
+			Movement->SetUpdatedComponent(Root);
+			Movement->SetRegistered(true);
+
+			OutActors.Add(Actor);
+		}
+	};
+
+	const bool bWasEnabled = FTickTaskManager::IsParallelTickEnabled();
+	const float DeltaSeconds = 1.0f / 60.0f;
+
+	auto Run = [&](bool bParallel, TArray<AActor*>& Actors) -> double
+	{
+		FTickTaskManager::SetParallelTickEnabled(bParallel);
+		FTickTaskManager Manager;
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Manager.TickActors(Actors, DeltaSeconds);
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	};
+
+	TArray<AActor*> SerialActors;
+	TArray<AActor*> ParallelActorList;
+	CreateActors(SerialActors);
+	CreateActors(ParallelActorList);
+
+	const double SerialMs = Run(false, SerialActors);
+	const double ParallelMs = Run(true, ParallelActorList);
+	FTickTaskManager::SetParallelTickEnabled(bWasEnabled);
+
+	// 스레드 스케줄과 무관하게 비트 단위로 같은 결과여야 함
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		const FTransform A = SerialActors[i]->GetRootComponent()->GetWorldTransform();
+		const FTransform B = ParallelActorList[i]->GetRootComponent()->GetWorldTransform();
+		if (std::memcmp(&A.Translation, &B.Translation, sizeof(FVector)) != 0 ||
+			std::memcmp(&A.Rotation, &B.Rotation, sizeof(FQuat)) != 0)
+		{
+			++NumMismatches;
+		}
+	}
+
+	UE_LOG("TickBench: %d actors x %d frames, workers %d", NumActors, NumFrames, ParallelFor::GetNumWorkers());
+	UE_LOG("TickBench:   serial   %.3f ms", SerialMs);
+	UE_LOG("TickBench:   parallel %.3f ms (x%.2f), result %s", ParallelMs, ParallelMs > 0.0 ? SerialMs / ParallelMs : 0.0,
+		NumMismatches == 0 ? "match" : "MISMATCH");
+
+	for (AActor* Actor : SerialActors)
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+	for (AActor* Actor : ParallelActorList)
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+}
+
+//====================================================================================
+// GUObjectArray 슬롯 (OBJECT BENCH)
+//====================================================================================
+
+namespace
+{
+	// 격자에 스태틱 메시 액터를 깔아 둔 임시 레벨 (월드에는 등록하지 않음, JSON/BINARY BENCH도 사용)
+	std::unique_ptr<ULevel> CreateGridLevel(int32 NumActors)
+	{
+		std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			AStaticMeshActor* Actor = NewObject<AStaticMeshActor>();
+			Actor->SetActorLocation(FVector(static_cast<float>(i % 100), static_cast<float>((i / 100) % 100), static_cast<float>(i / 10000)) * 10.0f);
+			Level->AddActor(Actor);
+		}
+		return Level;
+	}
+
+	void DestroyLevelActors(ULevel* Level)
+	{
+		for (AActor* Actor : Level->GetActors())
+		{
+			ObjectFactory::DeleteObject(Actor);
+		}
+		Level->Clear();
+	}
+
+	int32 CountLiveObjects()
+	{
+		int32 Count = 0;
+		for (UObject* Obj : GUObjectArray)
+		{
+			if (Obj)
+			{
+				++Count;
+			}
+		}
+		return Count;
+	}
+}
+
+void DevBenchmarks::RunObjectBenchmark(int32 NumObjects)
+{
+	// 월드에 붙이지 않은 UActorComponent로 슬롯 할당/해제 비용만 측정 (이름 발급 없는 ConstructObject 경로)
+	auto CreateObjects = [](int32 Count, TArray<UObject*>& OutObjects)
+	{
+		OutObjects.clear();
+		OutObjects.reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			UObject* Obj = ObjectFactory::ConstructObject(UActorComponent::StaticClass());
+			ObjectFactory::AddToGUObjectArray(UActorComponent::StaticClass(), Obj);
+			OutObjects.Add(Obj);
+		}
+	};
+
+	const int32 BaseNum = GUObjectArray.Num();
+	TArray<UObject*> Objects;
+
+	// 1. 생성
+	uint64 Start = FPlatformTime::Cycles64();
+	CreateObjects(NumObjects, Objects);
+	const double CreateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	TArray<TWeakObjectPtr<UObject>> WeakPtrs;
+	WeakPtrs.reserve(NumObjects);
+	for (UObject* Obj : Objects)
+	{
+		WeakPtrs.Add(TWeakObjectPtr<UObject>(Obj));
+	}
+
+	// 2. 절반을 무작위 순서로 삭제 (PIE 중 액터 파괴 패턴)
+	TArray<int32> Order;
+	for (int32 i = 0; i < NumObjects; i += 2)
+	{
+		Order.Add(i);
+	}
+	std::shuffle(Order.begin(), Order.end(), std::mt19937(777));
+
+	Start = FPlatformTime::Cycles64();
+	for (int32 i : Order)
+	{
+		ObjectFactory::DeleteObject(Objects[i]);
+	}
+	const double RandomDeleteMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 3. 같은 수만큼 다시 생성 - 배열이 늘지 않고 빈 슬롯을 재사용해야 함
+	const int32 NumBeforeRefill = GUObjectArray.Num();
+	TArray<UObject*> Refill;
+	CreateObjects(Order.Num(), Refill);
+	const bool bSlotsReused = GUObjectArray.Num() == NumBeforeRefill;
+
+	// 4. 삭제된 객체의 약한 포인터는 슬롯이 재사용된 뒤에도 무효여야 함
+	int32 NumWrong = 0;
+	for (int32 i = 0; i < NumObjects; ++i)
+	{
+		const bool bShouldBeValid = (i % 2) != 0;
+		if (WeakPtrs[i].IsValid() != bShouldBeValid || (bShouldBeValid && WeakPtrs[i].Get() != Objects[i]))
+		{
+			++NumWrong;
+		}
+	}
+
+	// 5. 나머지 전부를 생성 순서대로 삭제 (레벨 언로드/PIE 종료 패턴)
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 1; i < NumObjects; i += 2)
+	{
+		ObjectFactory::DeleteObject(Objects[i]);
+	}
+	for (UObject* Obj : Refill)
+	{
+		ObjectFactory::DeleteObject(Obj);
+	}
+	const double UnloadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 6. 생성한 레벨을 UWorld 소멸자(PIE 종료)와 같은 순서로 해제 - 액터/컴포넌트의 실제 삭제 경로
+	const int32 NumLevelActors = std::max(1, NumObjects / 10);
+	std::unique_ptr<ULevel> Level = CreateGridLevel(NumLevelActors);
+	const int32 NumLiveBeforeTeardown = CountLiveObjects();
+
+	Start = FPlatformTime::Cycles64();
+	TArray<AActor*> TempActors = Level->GetActors();
+	for (AActor* Actor : TempActors)
+	{
+		Actor->DestroyAllComponents();
+		ObjectFactory::DeleteObject(Actor);
+	}
+	Level->Clear();
+	const double TeardownMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	const int32 NumTornDown = NumLiveBeforeTeardown - CountLiveObjects();
+	Level.reset();
+
+	ObjectFactory::CompactNullSlots();
+
+	UE_LOG("ObjectBench: %d objects (array %d -> %d after cleanup)", NumObjects, BaseNum, GUObjectArray.Num());
+	UE_LOG("ObjectBench:   create %.3f ms, random delete (half) %.3f ms, unload (rest) %.3f ms", CreateMs, RandomDeleteMs, UnloadMs);
+	UE_LOG("ObjectBench:   slot reuse %s, weak ptr check %s (%d wrong)", bSlotsReused ? "OK" : "FAIL", NumWrong == 0 ? "OK" : "FAIL", NumWrong);
+	UE_LOG("ObjectBench:   level teardown (EndPIE order) %d actors / %d objects: %.3f ms (%.3f us/object)",
+		NumLevelActors, NumTornDown, TeardownMs, NumTornDown > 0 ? TeardownMs * 1000.0 / NumTornDown : 0.0);
+}
+
+//====================================================================================
+// 프리팹 스폰 (PREFAB BENCH)
+//====================================================================================
+
+namespace
+{
+	void MeasurePrefabSpawns(const FWideString& PrefabPath, int32 NumSpawns)
+	{
+		// 레벨 등록/BeginPlay는 두 경로가 같으므로 빼고 액터 생성 비용만 측정
+		TArray<AActor*> Spawned;
+		Spawned.reserve(NumSpawns);
+
+		// 1. 기존 경로: 매번 파일 읽기 + 클래스 조회 + NewObject + Serialize
+		uint64 Start = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < NumSpawns; ++i)
+		{
+			if (AActor* Actor = FPrefabCache::LoadPrefabActor(PrefabPath))
+			{
+				Spawned.Add(Actor);
+			}
+		}
+		const double LoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		const int32 NumLoaded = Spawned.Num();
+		for (AActor* Actor : Spawned)
+		{
+			ObjectFactory::DeleteObject(Actor);
+		}
+		Spawned.clear();
+
+		// 2. 캐시 경로: 아키타입 Duplicate (첫 로드 포함)
+		FPrefabCache& Cache = FPrefabCache::GetInstance();
+		Cache.Invalidate(PrefabPath);
+		Start = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < NumSpawns; ++i)
+		{
+			if (AActor* Archetype = Cache.FindOrLoadArchetype(PrefabPath))
+			{
+				Spawned.Add(Archetype->Duplicate());
+			}
+		}
+		const double CachedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		const int32 NumCloned = Spawned.Num();
+		for (AActor* Actor : Spawned)
+		{
+			ObjectFactory::DeleteObject(Actor);
+		}
+
+		auto SpawnsPerSecond = [](int32 Count, double Ms) { return Ms > 0.0 ? Count * 1000.0 / Ms : 0.0; };
+		UE_LOG("PrefabBench: %s x %d", WideToUTF8(PrefabPath).c_str(), NumSpawns);
+		UE_LOG("PrefabBench: load+serialize %.2f ms (%d, %.0f spawns/s), archetype clone %.2f ms (%d, %.0f spawns/s)",
+			LoadMs, NumLoaded, SpawnsPerSecond(NumLoaded, LoadMs), CachedMs, NumCloned, SpawnsPerSecond(NumCloned, CachedMs));
+	}
+}
+
+void DevBenchmarks::RunPrefabSpawnBenchmark(int32 NumSpawns)
+{
+	// Data/Prefabs의 첫 번째 프리팹으로 측정
+	const fs::path PrefabDir = UTF8ToWide(GDataDir) + L"/Prefabs";
+	std::error_code ErrorCode;
+	for (const auto& Entry : fs::directory_iterator(PrefabDir, ErrorCode))
+	{
+		if (Entry.is_regular_file() && Entry.path().extension() == L".prefab")
+		{
+			MeasurePrefabSpawns(Entry.path().wstring(), NumSpawns);
+			return;
+		}
+	}
+	UE_LOG("PrefabBench: no prefab found in Data/Prefabs");
+}
+
+//====================================================================================
+// 액터 풀 재사용 (POOL TEST)
+//====================================================================================
+
+bool DevBenchmarks::RunActorPoolSelfTest()
+{
+	UWorld* World = GWorld;
+	FActorPool* Pool = World ? World->GetActorPool() : nullptr;
+	if (!Pool)
+	{
+		UE_LOG("[Pool Test] No world or actor pool");
+		return false;
+	}
+
+	// 스폰 시점 속도/수명을 가진 발사체 액터 (등록 전에 값을 넣어야 스폰 시점 값으로 기록됨)
+	const FVector SpawnVelocity(100.0f, 0.0f, 0.0f);
+	AActor* Actor = ObjectFactory::NewObject<AActor>();
+	USceneComponent* Root = Actor->CreateDefaultSubobject<USceneComponent>("Root");
+	Actor->SetRootComponent(Root);
+	UProjectileMovementComponent* Projectile = Actor->CreateDefaultSubobject<UProjectileMovementComponent>("Projectile");
+	Projectile->SetUpdatedComponent(Root);
+	Projectile->SetGravity(0.0f);
+	Projectile->SetVelocity(SpawnVelocity);
+	Projectile->SetProjectileLifespan(0.25f);
+	Projectile->SetAutoDestroyWhenLifespanExceeded(true);
+	World->AddActorToLevel(Actor);
+
+	// 수명 만료까지 진행 -> 숨김 처리된 상태로 반납
+	for (int32 Step = 0; Step < 5; ++Step)
+	{
+		Projectile->TickComponent(0.1f);
+	}
+	const bool bExpired = Actor->GetActorHiddenInGame();
+	Pool->Release(Actor);
+
+	AActor* Reused = Pool->Acquire(AActor::StaticClass(), FTransform());
+	const bool bSameActor = Reused == Actor;
+
+	const FVector StartLocation = Actor->GetActorLocation();
+	Projectile->TickComponent(0.1f);
+	const FVector EndLocation = Actor->GetActorLocation();
+
+	const bool bVelocityRestored = Projectile->GetVelocity() == SpawnVelocity;
+	const bool bMoved = !(EndLocation - StartLocation).IsZero();
+	const bool bVisible = !Actor->GetActorHiddenInGame();
+	const bool bPassed = bExpired && bSameActor && bVelocityRestored && bMoved && bVisible && Projectile->IsActive();
+
+	UE_LOG("[Pool Test] expired %d, same actor %d, velocity restored %d, moved %d, visible %d : %s",
+		bExpired, bSameActor, bVelocityRestored, bMoved, bVisible, bPassed ? "PASS" : "FAIL");
+
+	if (Reused && Reused != Actor)
+	{
+		World->DestroyActor(Reused);
+	}
+	World->DestroyActor(Actor);
+	return bPassed;
+}
+
+//====================================================================================
+// JSON 파싱 (JSON BENCH)
+//====================================================================================
+
+namespace
+{
+	uint64 GetProcessPrivateBytes()
+	{
+		PROCESS_MEMORY_COUNTERS_EX Counters = {};
+		if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&Counters), sizeof(Counters)))
+		{
+			return Counters.PrivateUsage;
+		}
+		return 0;
+	}
+
+	double ToMegaBytes(uint64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+
+	// 레벨 로드가 액터마다 읽는 값들 (Type, OwnedComponents의 Type/RelativeLocation)
+	template<typename TJsonNode>
+	int32 ReadActorFields(const TJsonNode& ActorJson, const TJsonNode* ComponentsJson)
+	{
+		FString TypeString;
+		FJsonSerializer::ReadString(ActorJson, "Type", TypeString, "", false);
+		if (!ComponentsJson)
+		{
+			return 0;
+		}
+
+		int32 NumRead = 0;
+		for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson->size()); ++i)
+		{
+			const TJsonNode& ComponentJson = ComponentsJson->at(i);
+			FString ComponentType;
+			FVector Location;
+			if (FJsonSerializer::ReadString(ComponentJson, "Type", ComponentType, "", false)
+				&& FJsonSerializer::ReadVector(ComponentJson, "RelativeLocation", Location, FVector::Zero(), false))
+			{
+				++NumRead;
+			}
+		}
+		return NumRead;
+	}
+
+	FString ReadTextFile(const FWideString& Path)
+	{
+		std::ifstream File(Path, std::ios::binary);
+		return FString(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	}
+}
+
+
+void DevBenchmarks::RunJsonParseBenchmark(int32 NumActors)
+{
+	// 1. 실제 스태틱 메시 액터 하나를 저장한 JSON을 N번 반복해 레벨 파일과 같은 모양의 텍스트를 만듦
+	AStaticMeshActor* TemplateActor = NewObject<AStaticMeshActor>();
+	JSON TemplateJson = json::Object();
+	TemplateJson["Type"] = TemplateActor->GetClass()->Name;
+	TemplateActor->Serialize(false, TemplateJson);
+	ObjectFactory::DeleteObject(TemplateActor);
+
+	const FString ActorText = TemplateJson.dump(3);
+	FString LevelText = "{\n  \"Actors\" : {\n";
+	LevelText.reserve((ActorText.size() + 24) * NumActors + 64);
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		if (i > 0)
+		{
+			LevelText += ",\n";
+		}
+		LevelText += "    \"" + std::to_string(i + 1) + "\" : " + ActorText;
+	}
+	LevelText += "\n  },\n  \"Version\" : 1\n}\n";
+
+	// 2. 기존 경로: json::JSON::Load + ReadObject(복사) + 순회
+	//    메모리는 트리가 살아 있는 동안의 private bytes 증가분 (최대치가 아님. 앞 단계가 해제한 힙을 재사용하지 않도록 먼저 측정)
+	double LegacyParseMs = 0.0, LegacyWalkMs = 0.0;
+	uint64 LegacyMemory = 0;
+	int32 LegacyComponents = 0;
+	{
+		const uint64 MemoryBefore = GetProcessPrivateBytes();
+		uint64 Start = FPlatformTime::Cycles64();
+
+		JSON LegacyJson = JSON::Load(LevelText);
+		LegacyParseMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		const uint64 MemoryAfter = GetProcessPrivateBytes();
+		LegacyMemory = MemoryAfter > MemoryBefore ? MemoryAfter - MemoryBefore : 0;
+
+		Start = FPlatformTime::Cycles64();
+		JSON ActorList;
+		if (FJsonSerializer::ReadObject(LegacyJson, "Actors", ActorList))
+		{
+			for (auto& Pair : ActorList.ObjectRange())
+			{
+				JSON Components;
+				const bool bHasComponents = FJsonSerializer::ReadArray(Pair.second, "OwnedComponents", Components, nullptr, false);
+				LegacyComponents += ReadActorFields<JSON>(Pair.second, bHasComponents ? &Components : nullptr);
+			}
+		}
+		LegacyWalkMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	// 3. FJsonDocument: 파싱 + 액터 순회 (액터/컴포넌트는 LoadFromNode로 문서 노드를 바로 읽으므로 변환 비용 없음)
+	//    메모리는 문서가 실제로 확보한 버퍼 + 아레나 바이트
+	double DocumentParseMs = 0.0, DocumentWalkMs = 0.0;
+	uint64 DocumentArena = 0;
+	int32 DocumentComponents = 0;
+	{
+		uint64 Start = FPlatformTime::Cycles64();
+
+		FJsonDocument Document;
+		const bool bParsed = Document.Parse(FString(LevelText));
+		DocumentParseMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		DocumentArena = Document.GetAllocatedBytes();
+		if (!bParsed)
+		{
+			UE_LOG("[error] JsonBench: FJsonDocument parse failed - %s", Document.GetError().c_str());
+			return;
+		}
+
+		Start = FPlatformTime::Cycles64();
+		const FJsonValue* ActorList = nullptr;
+		if (FJsonSerializer::ReadObject(Document.GetRoot(), "Actors", ActorList))
+		{
+			for (const FJsonMember& Member : ActorList->ObjectRange())
+			{
+				const FJsonValue* Components = nullptr;
+				FJsonSerializer::ReadArray(Member.Value, "OwnedComponents", Components, false);
+				DocumentComponents += ReadActorFields(Member.Value, Components);
+			}
+		}
+		DocumentWalkMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	// 4. 전체 레벨 로드: 액터 생성 + 액터/컴포넌트 로드(Serialize / LoadFromNode)까지 포함
+	//    기존 ULevelService 경로(파일 읽기 + json::JSON::Load + ULevel::Serialize)와 현재 LoadLevelFromFile 비교
+	const FWideString LevelPath = (fs::temp_directory_path() / L"MundiJsonBench.scene").wstring();
+	{
+		std::unique_ptr<ULevel> SourceLevel = CreateGridLevel(NumActors);
+		JSON LevelJson;
+		SourceLevel->Serialize(false, LevelJson);
+		FJsonSerializer::SaveJsonToFile(LevelJson, LevelPath);
+		DestroyLevelActors(SourceLevel.get());
+	}
+
+	std::error_code ErrorCode;
+	const uint64 LevelFileBytes = fs::file_size(LevelPath, ErrorCode);
+
+	int32 NumLegacyLoaded = 0, NumDocumentLoaded = 0;
+	double LegacyLoadMs = 0.0, DocumentLoadMs = 0.0;
+	{
+		std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+		const uint64 Start = FPlatformTime::Cycles64();
+		JSON LevelJson = JSON::Load(ReadTextFile(LevelPath));
+		Level->Serialize(true, LevelJson);
+		LegacyLoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		NumLegacyLoaded = Level->GetActors().Num();
+		DestroyLevelActors(Level.get());
+	}
+	{
+		std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+		const uint64 Start = FPlatformTime::Cycles64();
+		ULevelService::LoadLevelFromFile(Level.get(), LevelPath);
+		DocumentLoadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		NumDocumentLoaded = Level->GetActors().Num();
+		DestroyLevelActors(Level.get());
+	}
+	fs::remove(LevelPath, ErrorCode);
+
+	UE_LOG("JsonBench: %d actors, %.1f MB text", NumActors, ToMegaBytes(LevelText.size()));
+	UE_LOG("JsonBench: json::JSON    parse %.2f ms, walk %.2f ms, private bytes with tree alive +%.1f MB (%d components)",
+		LegacyParseMs, LegacyWalkMs, ToMegaBytes(LegacyMemory), LegacyComponents);
+	UE_LOG("JsonBench: FJsonDocument parse %.2f ms, walk %.2f ms, buffer+arena %.1f MB (%d components)",
+		DocumentParseMs, DocumentWalkMs, ToMegaBytes(DocumentArena), DocumentComponents);
+	UE_LOG("JsonBench: level load %.1f MB - JSON::Load+Serialize %.2f ms (%d actors), LoadLevelFromFile %.2f ms (%d actors)",
+		ToMegaBytes(LevelFileBytes), LegacyLoadMs, NumLegacyLoaded, DocumentLoadMs, NumDocumentLoaded);
+}
+
+//====================================================================================
+// 바이너리 레벨 포맷 (BINARY BENCH)
+//====================================================================================
+
+void DevBenchmarks::RunBinaryLevelBenchmark(int32 NumActors)
+{
+	// 1. 격자에 스태틱 메시 액터를 깔아 둔 임시 레벨
+	std::unique_ptr<ULevel> SourceLevel = CreateGridLevel(NumActors);
+
+	const fs::path TempDir = fs::temp_directory_path();
+	const FWideString BinaryPath = (TempDir / L"MundiBinaryBench.scene").wstring();
+	const FWideString JsonPath = BinaryPath + L".json";
+
+	// 2. 저장
+	uint64 Start = FPlatformTime::Cycles64();
+	JSON LevelJson;
+	SourceLevel->Serialize(false, LevelJson);
+	FJsonSerializer::SaveJsonToFile(LevelJson, JsonPath);
+	const double JsonSaveMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	Start = FPlatformTime::Cycles64();
+	FBinarySerializer::SaveToFile(BinaryPath, [&SourceLevel](JSON& Root) { SourceLevel->Serialize(false, Root); });
+	const double BinarySaveMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	std::error_code ErrorCode;
+	const uint64 JsonBytes = fs::file_size(JsonPath, ErrorCode);
+	const uint64 BinaryBytes = fs::file_size(BinaryPath, ErrorCode);
+
+	DestroyLevelActors(SourceLevel.get());
+
+	// 3. 로드 (포맷은 파일 앞부분으로 판별)
+	auto MeasureLoad = [](const FWideString& Path, int32& OutNumActors)
+	{
+		std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+		const uint64 LoadStart = FPlatformTime::Cycles64();
+		ULevelService::LoadLevelFromFile(Level.get(), Path);
+		const double Ms = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStart);
+
+		OutNumActors = Level->GetActors().Num();
+		DestroyLevelActors(Level.get());
+		return Ms;
+	};
+
+	int32 NumJsonActors = 0, NumBinaryActors = 0;
+	const double JsonLoadMs = MeasureLoad(JsonPath, NumJsonActors);
+	const double BinaryLoadMs = MeasureLoad(BinaryPath, NumBinaryActors);
+
+	fs::remove(JsonPath, ErrorCode);
+	fs::remove(BinaryPath, ErrorCode);
+
+	UE_LOG("BinaryBench: %d static mesh actors", NumActors);
+	UE_LOG("BinaryBench: JSON   save %.2f ms, load %.2f ms (%d actors), %.2f MB",
+		JsonSaveMs, JsonLoadMs, NumJsonActors, JsonBytes / (1024.0 * 1024.0));
+	UE_LOG("BinaryBench: binary save %.2f ms, load %.2f ms (%d actors), %.2f MB",
+		BinarySaveMs, BinaryLoadMs, NumBinaryActors, BinaryBytes / (1024.0 * 1024.0));
+}
+
+#endif // MUNDI_DEV_BENCHMARKS
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+// 1이면 콘솔 "... BENCH" 명령과 아래 벤치마크를 빌드에 포함 (StandAlone 게임 빌드에서는 빠짐)
+#ifndef MUNDI_DEV_BENCHMARKS
+#if defined(_EDITOR)
+#define MUNDI_DEV_BENCHMARKS 1
+#else
+#define MUNDI_DEV_BENCHMARKS 0
+#endif
+#endif
+
+#if MUNDI_DEV_BENCHMARKS
+/**
+ * 최적화 작업의 전/후 비교용 개발 벤치마크 모음 (결과는 콘솔 로그로 출력)
+ * 공개 API(내부 상태가 필요한 경우 해당 클래스의 friend 선언)만 사용하므로 런타임 클래스에는 벤치마크 코드가 남지 않습니다.
+ */
+namespace DevBenchmarks
+{
+	// 합성 바운드로 만든 BVH에서 매 프레임 일부를 이동시키며 전체 리빌드와 리핏 시간/SAH 비용 비교 (콘솔 "BVH BENCH")
+	void RunBvhRefitBenchmark(int32 NumComponents, int32 NumMoving, int32 NumFrames);
+
+	// 합성 데이터로 CPU 스키닝 SIMD/병렬 결과를 스칼라 결과와 비교하고 시간 출력, 일치하면 true (콘솔 "SKINNING TEST")
+	bool RunSkinningSelfTest(int32 NumVertices, int32 NumBones, int32 NumIterations);
+
+	// GCacheDir 전체 메시/머티리얼 캐시를 스트림 리더와 매핑 리더로 읽어 Cold/Warm 로드 시간 비교 (콘솔 "CACHE BENCH")
+	void RunMeshCacheLoadBenchmark(int32 NumWarmPasses);
+
+	// 대용량 합성 메시 + Data 폴더 OBJ로 stringstream 파서와 버퍼 파서의 속도/결과 일치 비교 (콘솔 "OBJ BENCH")
+	void RunObjParserBenchmark();
+
+	// 회전/발사체 컴포넌트를 가진 합성 액터로 직렬/병렬 틱 시간과 결과 일치 여부 비교 (콘솔 "TICK BENCH")
+	void RunTickBenchmark(int32 NumActors, int32 NumFrames);
+
+	// 오브젝트 생성/삭제, 약한 포인터 무효화 확인, 생성한 레벨의 PIE 종료식 해제 시간 (콘솔 "OBJECT BENCH")
+	void RunObjectBenchmark(int32 NumObjects);
+
+	// Data/Prefabs의 첫 프리팹으로 파일 로드 스폰과 아키타입 복제 스폰의 초당 스폰 수 비교 (콘솔 "PREFAB BENCH")
+	void RunPrefabSpawnBenchmark(int32 NumSpawns);
+
+	// 수명이 만료돼 숨겨진 발사체 액터를 풀에 반납했다가 다시 꺼냈을 때 스폰 시점 속도로 다시 움직이는지 확인 (콘솔 "POOL TEST")
+	bool RunActorPoolSelfTest();
+
+	// 생성한 N액터 씬에서 json::JSON::Load와 FJsonDocument 파싱 시간/메모리, 그리고 액터 생성·Serialize까지 포함한
+	// 전체 레벨 로드 시간(기존 JSON::Load + ULevel::Serialize vs LoadLevelFromFile) 비교 (콘솔 "JSON BENCH")
+	void RunJsonParseBenchmark(int32 NumActors);
+
+	// N액터 레벨의 JSON/바이너리 저장·로드 시간과 파일 크기 비교 (콘솔 "BINARY BENCH")
+	void RunBinaryLevelBenchmark(int32 NumActors);
+}
+#endif
@@ -3,6 +3,7 @@
 #include "FbxCache.h"
 
 #include "WindowsBinReader.h"
+#include "WindowsMappedReader.h"
 #include "WindowsBinWriter.h"
 #include "PathUtils.h"
 #include "ResourceManager.h"
@@ -92,297 +93,350 @@ void RegisterMaterialInfos(const TArray<FMaterialInfo>& MaterialInfos)
 
 
 // ================================================================
-// [3] 스켈레탈 캐시 데이터 구조체들
-//  - FSkeletalCacheBone : 본 정보 저장
-//  - FSkeletalCacheFlesh : 스킨 파트(가중치, 본 인덱스 등)
-//  - FSkeletalCacheData : 전체 메시 + 본 구조 저장
+// [3] 스켈레탈 캐시 포맷
+//  - [FSkeletalCacheHeader][섹션...] 형태의 단일 블롭 (모든 섹션 16바이트 정렬)
+//  - 섹션: FNormalVertex 배열 / 인덱스 / 본 테이블(부모 인덱스) / Flesh / 본 인덱스(uint16x4) / 가중치(uint8x4) / 문자열
+//  - 스킨 정점의 위치·노멀 등은 Vertices와 1:1로 같으므로 저장하지 않고 로드 시 Vertices에서 채움
+//  - 한 번에 읽어서 헤더의 오프셋으로 바로 해석하며, 버전/크기/체크섬이 맞지 않으면 캐시를 재생성
 // ================================================================
-struct FSkeletalCacheBone
+struct FSkeletalCacheHeader
+{
+	static constexpr uint32 CacheMagic = 0x4B534D4D; // 'MMSK'
+	static constexpr uint32 CacheVersion = 3;        // 3: 단일 블롭 + 섹션 오프셋 + 체크섬
+
+	uint32 Magic = CacheMagic;
+	uint32 Version = CacheVersion;
+	uint32 HeaderSize = sizeof(FSkeletalCacheHeader);
+	uint32 bHasMaterial = 0;
+
+	uint64 FileSize = 0;
+	uint64 Checksum = 0;             // 헤더 뒤 전체 바이트의 해시
+
+	uint32 NumVertices = 0;
+	uint32 NumIndices = 0;
+	uint32 NumBones = 0;
+	uint32 NumFleshes = 0;
+	uint32 NumSkinnedVertices = 0;
+	uint32 StringTableSize = 0;
+	uint32 PathFileNameOffset = 0;   // 문자열 테이블 기준
+	uint32 PathFileNameLength = 0;
+
+	uint64 VerticesOffset = 0;       // 이하 파일 시작 기준
+	uint64 IndicesOffset = 0;
+	uint64 BonesOffset = 0;
+	uint64 FleshesOffset = 0;
+	uint64 BoneIndicesOffset = 0;
+	uint64 BoneWeightsOffset = 0;
+	uint64 StringTableOffset = 0;
+};
+
+// 본 테이블 한 칸 (전위 순회 순서 = USkeleton::GetBones() 순서, 부모가 항상 앞)
+struct FSkeletalCacheBoneRecord
 {
-	FString Name;
 	int32 ParentIndex = -1;
+	uint32 NameOffset = 0;
+	uint32 NameLength = 0;
+	uint32 Padding = 0;
 	FTransform RelativeTransform;
 	FTransform BindPose;
-
-	// 직렬화/역직렬화 지원 (저장/읽기 공용)
-	friend FArchive& operator<<(FArchive& Ar, FSkeletalCacheBone& Bone)
-	{
-		if (Ar.IsSaving())
-		{
-			Serialization::WriteString(Ar, Bone.Name);
-		}
-		else
-		{
-			Serialization::ReadString(Ar, Bone.Name);
-		}
-
-		Ar << Bone.ParentIndex;
-		Ar << Bone.RelativeTransform;
-		Ar << Bone.BindPose;
-		return Ar;
-	}
 };
 
-struct FSkeletalCacheFlesh
+struct FSkeletalCacheFleshRecord
 {
-	FGroupInfo GroupInfo;
-	// CPU Skinning으로 변경되어 Flesh별 Bone/Weight는 제거됨
-	// Skinning 데이터는 정점별로 FSkinnedVertex에 저장됨
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+	uint32 MaterialNameOffset = 0;
+	uint32 MaterialNameLength = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<FNormalVertex>, "FNormalVertex must be trivially copyable for the skeletal cache");
+static_assert(std::is_trivially_copyable_v<FTransform>, "FTransform must be trivially copyable for the skeletal cache");
 
-	friend FArchive& operator<<(FArchive& Ar, FSkeletalCacheFlesh& Flesh)
+// 캐시 무결성 검사용 해시 (FNV-1a, 8바이트 단위 + 나머지 바이트)
+static uint64 ComputeCacheChecksum(const uint8* Data, uint64 Size)
+{
+	uint64 Hash = 14695981039346656037ull;
+	const uint64 NumWords = Size / sizeof(uint64);
+	for (uint64 i = 0; i < NumWords; ++i)
 	{
-		Ar << Flesh.GroupInfo;
-		return Ar;
+		uint64 Word;
+		memcpy(&Word, Data + i * sizeof(uint64), sizeof(uint64));
+		Hash ^= Word;
+		Hash *= 1099511628211ull;
 	}
-};
+	for (uint64 i = NumWords * sizeof(uint64); i < Size; ++i)
+	{
+		Hash ^= Data[i];
+		Hash *= 1099511628211ull;
+	}
+	return Hash;
+}
 
-struct FSkeletalCacheData
+// 16바이트 정렬 섹션을 이어 붙이는 블롭 빌더
+struct FSkeletalCacheBlobBuilder
 {
-	FString PathFileName;
-	TArray<FNormalVertex> Vertices;
-	TArray<uint32> Indices;
-	bool bHasMaterial = false;
-	TArray<FSkeletalCacheFlesh> Fleshes;
-	TArray<FSkeletalCacheBone> Bones;
-	TArray<FSkinnedVertex> SkinnedVertices;  // CPU Skinning용 정점 데이터
-	TArray<TArray<FString>> VertexBoneNames;  // 각 정점의 BonePointers를 이름으로 저장
-
-	// 메시 + 본 전체 직렬화 (저장/읽기)
-	friend FArchive& operator<<(FArchive& Ar, FSkeletalCacheData& Data)
-	{
-		if (Ar.IsSaving())
-		{
-			Serialization::WriteString(Ar, Data.PathFileName);
-			Serialization::WriteArray(Ar, Data.Vertices);
-			Serialization::WriteArray(Ar, Data.Indices);
-		}
-		else
-		{
-			Serialization::ReadString(Ar, Data.PathFileName);
-			Serialization::ReadArray(Ar, Data.Vertices);
-			Serialization::ReadArray(Ar, Data.Indices);
-		}
+	TArray<uint8> Bytes;
+	TArray<char> Strings;
 
-		Ar << Data.bHasMaterial;
-
-		// Flesh 정보
-		uint32 FleshCount = static_cast<uint32>(Data.Fleshes.size());
-		Ar << FleshCount;
-		if (Ar.IsSaving())
-		{
-			for (auto& Flesh : Data.Fleshes) Ar << Flesh;
-		}
-		else
+	uint64 AppendSection(const void* Data, uint64 Size)
+	{
+		Bytes.resize((Bytes.size() + 15) & ~static_cast<size_t>(15), 0);
+		const uint64 Offset = Bytes.size();
+		if (Size > 0)
 		{
-			Data.Fleshes.resize(FleshCount);
-			for (auto& Flesh : Data.Fleshes) Ar << Flesh;
+			Bytes.resize(Bytes.size() + Size);
+			memcpy(Bytes.data() + Offset, Data, Size);
 		}
+		return Offset;
+	}
 
-		// Bone 정보
-		uint32 BoneCount = static_cast<uint32>(Data.Bones.size());
-		Ar << BoneCount;
-		if (Ar.IsSaving())
-		{
-			for (auto& Bone : Data.Bones) Ar << Bone;
-		}
-		else
-		{
-			Data.Bones.resize(BoneCount);
-			for (auto& Bone : Data.Bones) Ar << Bone;
-		}
+	uint32 AddString(const FString& Str, uint32& OutLength)
+	{
+		const uint32 Offset = static_cast<uint32>(Strings.size());
+		Strings.insert(Strings.end(), Str.begin(), Str.end());
+		OutLength = static_cast<uint32>(Str.size());
+		return Offset;
+	}
+};
 
-		// SkinnedVertices 정보 (CPU Skinning용)
-		uint32 SkinnedVertexCount = static_cast<uint32>(Data.SkinnedVertices.size());
-		Ar << SkinnedVertexCount;
-		if (Ar.IsSaving())
-		{
-			for (auto& SV : Data.SkinnedVertices)
-			{
-				// FVertexDynamic 부분
-				Ar << SV.Position << SV.Normal << SV.UV << SV.Tangent << SV.Color;
-				// Skinning 데이터 (BonePointers는 직렬화 불가능하므로 Weight만 저장)
-				// TODO: Bone 이름을 저장하고 로드 시 복원하는 로직 필요
-				Ar.Serialize(&SV.BoneWeights[0], sizeof(float) * 4);
-			}
-		}
-		else
-		{
-			Data.SkinnedVertices.resize(SkinnedVertexCount);
-			for (auto& SV : Data.SkinnedVertices)
-			{
-				// FVertexDynamic 부분
-				Ar << SV.Position << SV.Normal << SV.UV << SV.Tangent << SV.Color;
-				// Skinning 데이터 (BoneWeights 로드, BonePointers는 나중에 복원)
-				Ar.Serialize(&SV.BoneWeights[0], sizeof(float) * 4);
-				// BonePointers 초기화
-				for (int i = 0; i < 4; i++)
-				{
-					SV.BonePointers[i] = nullptr;
-				}
-			}
-		}
+// 읽기 전용 캐시 블롭 (매핑된 파일을 복사 없이 그대로 가리킴)
+struct FSkeletalCacheView
+{
+	const uint8* Data = nullptr;
+	uint64 Size = 0;
+};
 
-		// VertexBoneNames 직렬화
-		uint32 VertexBoneNamesCount = static_cast<uint32>(Data.VertexBoneNames.size());
-		Ar << VertexBoneNamesCount;
-		if (Ar.IsSaving())
-		{
-			for (const auto& BoneNames : Data.VertexBoneNames)
-			{
-				for (int i = 0; i < 4; i++)
-				{
-					FString BoneName = (i < BoneNames.Num()) ? BoneNames[i] : FString();
-					Serialization::WriteString(Ar, BoneName);
-				}
-			}
-		}
-		else
-		{
-			Data.VertexBoneNames.resize(VertexBoneNamesCount);
-			for (auto& BoneNames : Data.VertexBoneNames)
-			{
-				BoneNames.resize(4);
-				for (int i = 0; i < 4; i++)
-				{
-					Serialization::ReadString(Ar, BoneNames[i]);
-				}
-			}
-		}
+// 블롭 안의 섹션을 범위 검사 후 포인터로 반환
+template<typename T>
+static const T* GetCacheSection(const FSkeletalCacheView& Blob, uint64 Offset, uint64 Count)
+{
+	const uint64 Size = Count * sizeof(T);
+	if (Offset > Blob.Size || Size > Blob.Size - Offset)
+	{
+		throw std::runtime_error("Cache corrupt: Section is out of range.");
+	}
+	return reinterpret_cast<const T*>(Blob.Data + Offset);
+}
 
-		return Ar;
+static FString GetCacheString(const FSkeletalCacheView& Blob, const FSkeletalCacheHeader& Header, uint32 Offset, uint32 Length)
+{
+	if (Offset > Header.StringTableSize || Length > Header.StringTableSize - Offset)
+	{
+		throw std::runtime_error("Cache corrupt: String is out of range.");
 	}
-};
+	const char* Strings = GetCacheSection<char>(Blob, Header.StringTableOffset, Header.StringTableSize);
+	return FString(Strings + Offset, Length);
+}
 
 
 
 // ================================================================
 // [4] 스켈레톤 계층을 재귀적으로 순회하여 캐시용 본 데이터 수집
+//  - 전위 순회이므로 USkeleton::GetBones()와 순서가 같고, 정점의 본 인덱스를 그대로 쓸 수 있음
 // ================================================================
-static void GatherBonesRecursive(UBone* Bone, int32 ParentIndex, TArray<FSkeletalCacheBone>& OutBones, TMap<UBone*, int32>& OutBoneIndexMap)
+static void GatherBonesRecursive(UBone* Bone, int32 ParentIndex, TArray<FSkeletalCacheBoneRecord>& OutBones, TArray<FString>& OutNames)
 {
 	if (!Bone) return;
 
 	const int32 ThisIndex = static_cast<int32>(OutBones.size());
-	OutBoneIndexMap.Add(Bone, ThisIndex);
 
 	OutBones.emplace_back();
-	FSkeletalCacheBone& CachedBone = OutBones.back();
-	CachedBone.Name = Bone->GetName().ToString();
+	FSkeletalCacheBoneRecord& CachedBone = OutBones.back();
 	CachedBone.ParentIndex = ParentIndex;
 	CachedBone.RelativeTransform = Bone->GetRelativeTransform();
 	CachedBone.BindPose = Bone->GetRelativeBindPose();
+	OutNames.Add(Bone->GetName().ToString());
 
 	for (UBone* Child : Bone->GetChildren())
 	{
-		GatherBonesRecursive(Child, ThisIndex, OutBones, OutBoneIndexMap);
+		GatherBonesRecursive(Child, ThisIndex, OutBones, OutNames);
 	}
 }
 
 
 
 // ================================================================
-// [5] 스켈레탈 메시로부터 캐시 데이터 생성 (저장 전 변환 단계)
+// [5] 스켈레탈 메시로부터 캐시 블롭 생성 (저장 전 변환 단계)
 // ================================================================
-static void BuildSkeletalCacheData(const FSkeletalMesh* Mesh, FSkeletalCacheData& OutData)
+static void BuildSkeletalCacheBlob(const FSkeletalMesh* Mesh, TArray<uint8>& OutBlob)
 {
-	if (!Mesh) return;
-
-	OutData.PathFileName = Mesh->PathFileName;
-	OutData.Vertices = Mesh->Vertices;
-	OutData.Indices = Mesh->Indices;
-	OutData.bHasMaterial = Mesh->bHasMaterial;
-	OutData.Fleshes.clear();
-	OutData.Bones.clear();
-
-	if (!Mesh->Skeleton) return;
-
-	UBone* Root = Mesh->Skeleton->GetRoot();
-	if (!Root) return;
-
-	TMap<UBone*, int32> BoneIndexMap;
-	GatherBonesRecursive(Root, -1, OutData.Bones, BoneIndexMap);
+	FSkeletalCacheHeader Header;
+	FSkeletalCacheBlobBuilder Builder;
+	Builder.Bytes.resize(sizeof(FSkeletalCacheHeader), 0);
+
+	Header.bHasMaterial = Mesh->bHasMaterial ? 1u : 0u;
+	Header.PathFileNameOffset = Builder.AddString(Mesh->PathFileName, Header.PathFileNameLength);
+
+	// 정점 / 인덱스
+	Header.NumVertices = static_cast<uint32>(Mesh->Vertices.size());
+	Header.VerticesOffset = Builder.AppendSection(Mesh->Vertices.data(), sizeof(FNormalVertex) * Mesh->Vertices.size());
+	Header.NumIndices = static_cast<uint32>(Mesh->Indices.size());
+	Header.IndicesOffset = Builder.AppendSection(Mesh->Indices.data(), sizeof(uint32) * Mesh->Indices.size());
+
+	// 본 테이블
+	TArray<FSkeletalCacheBoneRecord> Bones;
+	TArray<FString> BoneNames;
+	if (Mesh->Skeleton)
+	{
+		GatherBonesRecursive(Mesh->Skeleton->GetRoot(), -1, Bones, BoneNames);
+	}
+	for (int32 i = 0; i < Bones.Num(); ++i)
+	{
+		Bones[i].NameOffset = Builder.AddString(BoneNames[i], Bones[i].NameLength);
+	}
+	Header.NumBones = static_cast<uint32>(Bones.size());
+	Header.BonesOffset = Builder.AppendSection(Bones.data(), sizeof(FSkeletalCacheBoneRecord) * Bones.size());
 
-	// Flesh 그룹 변환
-	// Fleshes 복사 (이제 FGroupInfo만 가짐)
-	OutData.Fleshes.resize(Mesh->Fleshes.size());
+	// Flesh (섹션 정보)
+	TArray<FSkeletalCacheFleshRecord> Fleshes;
+	Fleshes.resize(Mesh->Fleshes.size());
 	for (size_t FleshIdx = 0; FleshIdx < Mesh->Fleshes.size(); ++FleshIdx)
 	{
 		const FFlesh& Flesh = Mesh->Fleshes[FleshIdx];
-		FSkeletalCacheFlesh& CachedFlesh = OutData.Fleshes[FleshIdx];
-		CachedFlesh.GroupInfo.StartIndex = Flesh.StartIndex;
-		CachedFlesh.GroupInfo.IndexCount = Flesh.IndexCount;
-		CachedFlesh.GroupInfo.InitialMaterialName = Flesh.InitialMaterialName;
+		FSkeletalCacheFleshRecord& CachedFlesh = Fleshes[FleshIdx];
+		CachedFlesh.StartIndex = Flesh.StartIndex;
+		CachedFlesh.IndexCount = Flesh.IndexCount;
+		CachedFlesh.MaterialNameOffset = Builder.AddString(Flesh.InitialMaterialName, CachedFlesh.MaterialNameLength);
 	}
-
-	// SkinnedVertices 복사 (CPU Skinning용)
-	OutData.SkinnedVertices = Mesh->SkinnedVertices;
-
-	// BonePointers를 이름으로 변환하여 VertexBoneNames에 저장
-	OutData.VertexBoneNames.resize(Mesh->SkinnedVertices.Num());
-	for (int i = 0; i < Mesh->SkinnedVertices.Num(); i++)
+	Header.NumFleshes = static_cast<uint32>(Fleshes.size());
+	Header.FleshesOffset = Builder.AppendSection(Fleshes.data(), sizeof(FSkeletalCacheFleshRecord) * Fleshes.size());
+
+	// 스킨 영향 (본 인덱스 / 가중치를 각각 연속 배열로)
+	const uint32 NumSkinned = static_cast<uint32>(std::min(Mesh->SkinnedVertices.size(), Mesh->Vertices.size()));
+	TArray<uint16> BoneIndices;
+	TArray<uint8> BoneWeights;
+	BoneIndices.resize(NumSkinned * 4);
+	BoneWeights.resize(NumSkinned * 4);
+	for (uint32 i = 0; i < NumSkinned; ++i)
 	{
 		const FSkinnedVertex& SV = Mesh->SkinnedVertices[i];
-		TArray<FString>& BoneNames = OutData.VertexBoneNames[i];
-		BoneNames.resize(4);
-
-		for (int j = 0; j < 4; j++)
-		{
-			UBone* BonePtr = SV.BonePointers[j];
-			if (BonePtr)
-			{
-				BoneNames[j] = BonePtr->GetName().ToString();
-			}
-			else
-			{
-				BoneNames[j] = FString();  // Empty string for nullptr
-			}
-		}
+		memcpy(&BoneIndices[i * 4], SV.BoneIndices, sizeof(SV.BoneIndices));
+		memcpy(&BoneWeights[i * 4], SV.BoneWeights, sizeof(SV.BoneWeights));
 	}
+	Header.NumSkinnedVertices = NumSkinned;
+	Header.BoneIndicesOffset = Builder.AppendSection(BoneIndices.data(), sizeof(uint16) * BoneIndices.size());
+	Header.BoneWeightsOffset = Builder.AppendSection(BoneWeights.data(), sizeof(uint8) * BoneWeights.size());
+
+	// 문자열 테이블
+	Header.StringTableSize = static_cast<uint32>(Builder.Strings.size());
+	Header.StringTableOffset = Builder.AppendSection(Builder.Strings.data(), Builder.Strings.size());
+
+	// 헤더 기록 (체크섬은 헤더 뒤 전체)
+	Header.FileSize = Builder.Bytes.size();
+	Header.Checksum = ComputeCacheChecksum(Builder.Bytes.data() + sizeof(FSkeletalCacheHeader), Header.FileSize - sizeof(FSkeletalCacheHeader));
+	memcpy(Builder.Bytes.data(), &Header, sizeof(FSkeletalCacheHeader));
+
+	OutBlob = std::move(Builder.Bytes);
 }
 
 
 
 // ================================================================
-// [6] 캐시 데이터로부터 스켈레톤 복원 (메모리 상에서 재구성)
+// [6] 캐시 블롭으로부터 스켈레탈 메시 복원 (메모리 상에서 재구성)
+//  - UObject를 만들지 않으므로 워커 스레드에서 호출 가능
 // ================================================================
-static USkeleton* RebuildSkeletonFromCache(const TArray<FSkeletalCacheBone>& CachedBones, TArray<UBone*>& OutBonePointers)
+static void DecodeSkeletonFromCache(const FSkeletalCacheView& Blob, const FSkeletalCacheHeader& Header, FSkeletalCacheSkeleton& OutSkeleton)
 {
-	OutBonePointers.clear();
-	if (CachedBones.empty()) return nullptr;
+	const FSkeletalCacheBoneRecord* CachedBones = GetCacheSection<FSkeletalCacheBoneRecord>(Blob, Header.BonesOffset, Header.NumBones);
 
-	// 본 인스턴스 생성
-	OutBonePointers.resize(CachedBones.size());
-	for (size_t i = 0; i < CachedBones.size(); ++i)
+	OutSkeleton.BoneNames.resize(Header.NumBones);
+	OutSkeleton.ParentIndices.resize(Header.NumBones);
+	OutSkeleton.RelativeTransforms.resize(Header.NumBones);
+	OutSkeleton.BindPoses.resize(Header.NumBones);
+	for (uint32 i = 0; i < Header.NumBones; ++i)
 	{
-		const auto& CachedBone = CachedBones[i];
-		UBone* Bone = new UBone(FName(CachedBone.Name.c_str()), CachedBone.RelativeTransform);
-		ObjectFactory::AddToGUObjectArray(UBone::StaticClass(), Bone);
-		Bone->SetRelativeBindPoseTransform(CachedBone.BindPose);
-		OutBonePointers[i] = Bone;
+		FSkeletalCacheBoneRecord CachedBone;
+		memcpy(&CachedBone, &CachedBones[i], sizeof(FSkeletalCacheBoneRecord));
+
+		// 부모는 항상 앞 인덱스여야 함 (전위 순회)
+		if (CachedBone.ParentIndex >= static_cast<int32>(i) || (i > 0 && CachedBone.ParentIndex < 0))
+		{
+			throw std::runtime_error("Cache corrupt: Bone table is not in parent-first order.");
+		}
+
+		OutSkeleton.BoneNames[i] = GetCacheString(Blob, Header, CachedBone.NameOffset, CachedBone.NameLength);
+		OutSkeleton.ParentIndices[i] = CachedBone.ParentIndex;
+		OutSkeleton.RelativeTransforms[i] = CachedBone.RelativeTransform;
+		OutSkeleton.BindPoses[i] = CachedBone.BindPose;
 	}
+}
 
-	// 부모-자식 관계 복원
-	for (size_t i = 0; i < CachedBones.size(); ++i)
+static void RebuildSkeletalMeshFromCache(const FSkeletalCacheView& Blob, FSkeletalMesh* Mesh, FSkeletalCacheSkeleton& OutSkeleton)
+{
+	if (Blob.Size < sizeof(FSkeletalCacheHeader))
 	{
-		int32 ParentIdx = CachedBones[i].ParentIndex;
-		if (ParentIdx >= 0 && ParentIdx < (int32)CachedBones.size())
+		throw std::runtime_error("Cache corrupt: File is smaller than the header.");
+	}
+
+	FSkeletalCacheHeader Header;
+	memcpy(&Header, Blob.Data, sizeof(FSkeletalCacheHeader));
+	if (Header.Magic != FSkeletalCacheHeader::CacheMagic ||
+		Header.Version != FSkeletalCacheHeader::CacheVersion ||
+		Header.HeaderSize != sizeof(FSkeletalCacheHeader))
+	{
+		throw std::runtime_error("Outdated skeletal mesh cache format.");
+	}
+	if (Header.FileSize != Blob.Size)
+	{
+		throw std::runtime_error("Cache corrupt: File size mismatch.");
+	}
+	if (Header.Checksum != ComputeCacheChecksum(Blob.Data + sizeof(FSkeletalCacheHeader), Blob.Size - sizeof(FSkeletalCacheHeader)))
+	{
+		throw std::runtime_error("Cache corrupt: Checksum mismatch.");
+	}
+	if (Header.NumSkinnedVertices > Header.NumVertices)
+	{
+		throw std::runtime_error("Cache corrupt: Skinned vertex count exceeds vertex count.");
+	}
+
+	// 기본 데이터 복원
+	Mesh->PathFileName = GetCacheString(Blob, Header, Header.PathFileNameOffset, Header.PathFileNameLength);
+	Mesh->bHasMaterial = Header.bHasMaterial != 0;
+
+	Mesh->Vertices.resize(Header.NumVertices);
+	memcpy(Mesh->Vertices.data(), GetCacheSection<FNormalVertex>(Blob, Header.VerticesOffset, Header.NumVertices), sizeof(FNormalVertex) * Header.NumVertices);
+
+	Mesh->Indices.resize(Header.NumIndices);
+	memcpy(Mesh->Indices.data(), GetCacheSection<uint32>(Blob, Header.IndicesOffset, Header.NumIndices), sizeof(uint32) * Header.NumIndices);
+
+	// 본 테이블 복원 (UBone 생성은 CreateSkeletonFromCache에서)
+	DecodeSkeletonFromCache(Blob, Header, OutSkeleton);
+
+	// Flesh 데이터 복원
+	const FSkeletalCacheFleshRecord* CachedFleshes = GetCacheSection<FSkeletalCacheFleshRecord>(Blob, Header.FleshesOffset, Header.NumFleshes);
+	Mesh->Fleshes.clear();
+	Mesh->Fleshes.reserve(Header.NumFleshes);
+	for (uint32 i = 0; i < Header.NumFleshes; ++i)
+	{
+		// 섹션 범위가 인덱스 버퍼를 벗어나면 DrawIndexed가 범위 밖을 읽으므로 캐시 거부
+		if (static_cast<uint64>(CachedFleshes[i].StartIndex) + CachedFleshes[i].IndexCount > Header.NumIndices)
 		{
-			OutBonePointers[i]->SetParent(OutBonePointers[ParentIdx]);
-			OutBonePointers[ParentIdx]->AddChild(OutBonePointers[i]);
+			throw std::runtime_error("Cache corrupt: Section index range exceeds index count.");
 		}
+
+		FFlesh Flesh;
+		Flesh.StartIndex = CachedFleshes[i].StartIndex;
+		Flesh.IndexCount = CachedFleshes[i].IndexCount;
+		Flesh.InitialMaterialName = GetCacheString(Blob, Header, CachedFleshes[i].MaterialNameOffset, CachedFleshes[i].MaterialNameLength);
+		Mesh->Fleshes.Add(Flesh);
 	}
 
-	// 루트 본 탐색 및 스켈레톤 생성
-	UBone* Root = nullptr;
-	for (size_t i = 0; i < CachedBones.size(); ++i)
+	// SkinnedVertices 복원 (정점 속성은 Vertices에서, 본 인덱스/가중치는 캐시에서)
+	const uint16* BoneIndices = GetCacheSection<uint16>(Blob, Header.BoneIndicesOffset, static_cast<uint64>(Header.NumSkinnedVertices) * 4);
+	const uint8* BoneWeights = GetCacheSection<uint8>(Blob, Header.BoneWeightsOffset, static_cast<uint64>(Header.NumSkinnedVertices) * 4);
+	Mesh->SkinnedVertices.resize(Header.NumSkinnedVertices);
+	for (uint32 i = 0; i < Header.NumSkinnedVertices; ++i)
 	{
-		if (CachedBones[i].ParentIndex < 0) { Root = OutBonePointers[i]; break; }
+		FSkinnedVertex& SV = Mesh->SkinnedVertices[i];
+		const FNormalVertex& Src = Mesh->Vertices[i];
+		SV.Position = Src.pos;
+		SV.Normal = Src.normal;
+		SV.UV = Src.tex;
+		SV.Tangent = Src.Tangent;
+		SV.Color = Src.color;
+		memcpy(SV.BoneIndices, BoneIndices + i * 4, sizeof(SV.BoneIndices));
+		memcpy(SV.BoneWeights, BoneWeights + i * 4, sizeof(SV.BoneWeights));
 	}
-	if (!Root) Root = OutBonePointers.front();
-
-	USkeleton* Skeleton = NewObject<USkeleton>();
-	Skeleton->SetRoot(Root);
-	return Skeleton;
 }
 
 // ================================================================
@@ -431,13 +485,13 @@ bool TryLoadStaticMeshCache(const FString& MeshBinPath, const FString& MatBinPat
 	try
 	{
 		// 메시 캐시 로드
-		FWindowsBinReader Reader(MeshBinPath);
+		FWindowsMappedReader Reader(MeshBinPath);
 		if (!Reader.IsOpen()) throw std::runtime_error("Failed to open mesh cache.");
 		Reader << *Mesh;
 		Reader.Close();
 
 		// 머티리얼 캐시 로드
-		FWindowsBinReader MatReader(MatBinPath);
+		FWindowsMappedReader MatReader(MatBinPath);
 		if (!MatReader.IsOpen()) throw std::runtime_error("Failed to open material cache.");
 		Serialization::ReadArray(MatReader, MaterialInfos);
 		MatReader.Close();
@@ -487,116 +541,100 @@ void RemoveCacheFiles(const FString& MeshBinPath, const FString& MatBinPath)
 // [10] 스켈레탈 메시 캐시 로드 / 저장
 //  - 본 및 웨이트 구조를 함께 복원
 // ================================================================
-bool TryLoadSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, TArray<FMaterialInfo>& MaterialInfos)
+bool DecodeSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, TArray<FMaterialInfo>& MaterialInfos, FSkeletalCacheSkeleton& OutSkeleton)
 {
 	try
 	{
-		// 메시 + 본 데이터 읽기
-		FWindowsBinReader Reader(MeshBinPath);
+		// 메시 + 본 데이터를 매핑해서 제자리에서 해석
+		FWindowsMappedReader Reader(MeshBinPath);
 		if (!Reader.IsOpen()) throw std::runtime_error("Failed to open skeletal mesh cache.");
-		FSkeletalCacheData CacheData;
-		Reader << CacheData;
-		Reader.Close();
+		const FSkeletalCacheView Blob{ Reader.GetData(), static_cast<uint64>(Reader.GetSize()) };
 
 		// 머티리얼 읽기
-		FWindowsBinReader MatReader(MatBinPath);
+		FWindowsMappedReader MatReader(MatBinPath);
 		if (!MatReader.IsOpen()) throw std::runtime_error("Failed to open skeletal material cache.");
 		Serialization::ReadArray(MatReader, MaterialInfos);
 		MatReader.Close();
 
-		// 기본 데이터 복원
-		Mesh->PathFileName = CacheData.PathFileName;
-		Mesh->Vertices = CacheData.Vertices;
-		Mesh->Indices = CacheData.Indices;
-		Mesh->bHasMaterial = CacheData.bHasMaterial;
-		Mesh->CacheFilePath = MeshBinPath;
-		Mesh->Fleshes.clear();
+		// 헤더/체크섬 검증 후 복원 (실패 시 예외 → 호출부에서 캐시 재생성)
 		Mesh->Skeleton = nullptr;
+		RebuildSkeletalMeshFromCache(Blob, Mesh, OutSkeleton);
+		Reader.Close();
+		Mesh->CacheFilePath = MeshBinPath;
 
-		// 본 복원
-		TArray<UBone*> BonePointers;
-		if (!CacheData.Bones.empty())
-		{
-			USkeleton* Skeleton = RebuildSkeletonFromCache(CacheData.Bones, BonePointers);
-			Mesh->Skeleton = Skeleton;
-		}
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG("[FBX Cache] %s", e.what());
+		return false;
+	}
+}
 
-		// Flesh 데이터 복원 (이제 FGroupInfo만 가짐)
-		for (const FSkeletalCacheFlesh& CachedFlesh : CacheData.Fleshes)
-		{
-			FFlesh Flesh;
-			Flesh.StartIndex = CachedFlesh.GroupInfo.StartIndex;
-			Flesh.IndexCount = CachedFlesh.GroupInfo.IndexCount;
-			Flesh.InitialMaterialName = CachedFlesh.GroupInfo.InitialMaterialName;
-			Mesh->Fleshes.Add(Flesh);
-		}
+USkeleton* CreateSkeletonFromCache(const FSkeletalCacheSkeleton& CachedSkeleton)
+{
+	const int32 NumBones = CachedSkeleton.BoneNames.Num();
+	if (NumBones == 0) return nullptr;
 
-		// SkinnedVertices 복원 (CPU Skinning용)
-		Mesh->SkinnedVertices = CacheData.SkinnedVertices;
+	// 본 인스턴스 생성 + 부모-자식 관계 복원 (부모는 항상 앞 인덱스)
+	TArray<UBone*> BonePointers;
+	BonePointers.resize(NumBones);
+	for (int32 i = 0; i < NumBones; ++i)
+	{
+		UBone* Bone = new UBone(FName(CachedSkeleton.BoneNames[i].c_str()), CachedSkeleton.RelativeTransforms[i]);
+		ObjectFactory::AddToGUObjectArray(UBone::StaticClass(), Bone);
+		Bone->SetRelativeBindPoseTransform(CachedSkeleton.BindPoses[i]);
+		BonePointers[i] = Bone;
 
-		// BonePointers 복원 (이름 기반)
-		if (Mesh->Skeleton && !CacheData.VertexBoneNames.empty())
+		const int32 ParentIdx = CachedSkeleton.ParentIndices[i];
+		if (ParentIdx >= 0)
 		{
-			// Bone 이름 -> Bone 포인터 매핑 생성
-			TMap<FString, UBone*> NameToBoneMap;
-			Mesh->Skeleton->ForEachBone([&](UBone* Bone)
-			{
-				if (Bone)
-				{
-					NameToBoneMap.Add(Bone->GetName().ToString(), Bone);
-				}
-			});
-
-			// 각 정점의 BonePointers 복원
-			for (int i = 0; i < Mesh->SkinnedVertices.Num(); i++)
-			{
-				if (i >= CacheData.VertexBoneNames.Num())
-					break;
-
-				const TArray<FString>& BoneNames = CacheData.VertexBoneNames[i];
-				FSkinnedVertex& SV = Mesh->SkinnedVertices[i];
-
-				for (int j = 0; j < 4; j++)
-				{
-					if (j < BoneNames.Num() && !BoneNames[j].empty())
-					{
-						if (UBone** FoundBone = NameToBoneMap.Find(BoneNames[j]))
-						{
-							SV.BonePointers[j] = *FoundBone;
-						}
-						else
-						{
-							SV.BonePointers[j] = nullptr;
-						}
-					}
-					else
-					{
-						SV.BonePointers[j] = nullptr;
-					}
-				}
-			}
+			Bone->SetParent(BonePointers[ParentIdx]);
+			BonePointers[ParentIdx]->AddChild(Bone);
 		}
+	}
 
-		return true;
+	// 전위 순회 순서이므로 첫 번째 본이 루트
+	USkeleton* Skeleton = NewObject<USkeleton>();
+	Skeleton->SetRoot(BonePointers.front());
+	return Skeleton;
+}
+
+bool TryLoadSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, TArray<FMaterialInfo>& MaterialInfos)
+{
+	FSkeletalCacheSkeleton CachedSkeleton;
+	if (!DecodeSkeletalMeshCache(MeshBinPath, MatBinPath, Mesh, MaterialInfos, CachedSkeleton))
+	{
+		return false;
 	}
-	catch (const std::exception& e)
+
+	Mesh->Skeleton = CreateSkeletonFromCache(CachedSkeleton);
+	return true;
+}
+
+bool VerifySkeletalCacheChecksum(const uint8* Data, uint64 Size)
+{
+	if (!Data || Size < sizeof(FSkeletalCacheHeader))
 	{
-		UE_LOG("[FBX Cache] %s", e.what());
 		return false;
 	}
+
+	FSkeletalCacheHeader Header;
+	memcpy(&Header, Data, sizeof(FSkeletalCacheHeader));
+	return Header.Checksum == ComputeCacheChecksum(Data + sizeof(FSkeletalCacheHeader), Size - sizeof(FSkeletalCacheHeader));
 }
 
 void SaveSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, const TArray<FMaterialInfo>& MaterialInfos)
 {
 	try
 	{
-		// 캐시 데이터 구성
-		FSkeletalCacheData CacheData;
-		BuildSkeletalCacheData(Mesh, CacheData);
+		// 캐시 블롭 구성
+		TArray<uint8> Blob;
+		BuildSkeletalCacheBlob(Mesh, Blob);
 
-		// 메시 저장
+		// 메시 저장 (한 번에 기록)
 		FWindowsBinWriter Writer(MeshBinPath);
-		Writer << CacheData;
+		Writer.Serialize(Blob.data(), static_cast<int64>(Blob.size()));
 		Writer.Close();
 
 		// 머티리얼 저장
@@ -5,6 +5,7 @@
 
 struct FStaticMesh;
 struct FSkeletalMesh;
+class USkeleton;
 
 struct FStaticCachePaths
 {
@@ -18,6 +19,15 @@ struct FSkeletalCachePaths
 	FString MaterialBinPath;
 };
 
+// 캐시에서 읽은 본 테이블 (UBone 생성 전 단계, 전위 순회 순서로 부모가 항상 앞)
+struct FSkeletalCacheSkeleton
+{
+	TArray<FString> BoneNames;
+	TArray<int32> ParentIndices;
+	TArray<FTransform> RelativeTransforms;
+	TArray<FTransform> BindPoses;
+};
+
 // Common
 bool ShouldRegenerateFbxCache(const FString& AssetPath, const FString& MeshBinPath, const FString& MatBinPath);
 void RegisterMaterialInfos(const TArray<FMaterialInfo>& MaterialInfos);
@@ -31,6 +41,11 @@ void SaveStaticMeshCache(const FString& MeshBinPath, const FString& MatBinPath,
 
 // Skeletal
 FSkeletalCachePaths GetSkeletalCachePaths(const FString& NormalizedPath);
+// 워커 스레드에서 호출 가능: 메시/머티리얼/본 테이블까지만 복원 (Mesh->Skeleton은 nullptr)
+bool DecodeSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, TArray<FMaterialInfo>& MaterialInfos, FSkeletalCacheSkeleton& OutSkeleton);
+// 메인 스레드 전용: 본 테이블로 UBone 계층과 USkeleton 생성
+USkeleton* CreateSkeletonFromCache(const FSkeletalCacheSkeleton& CachedSkeleton);
 bool TryLoadSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, TArray<FMaterialInfo>& MaterialInfos);
 void SaveSkeletalMeshCache(const FString& MeshBinPath, const FString& MatBinPath, FSkeletalMesh* Mesh, const TArray<FMaterialInfo>& MaterialInfos);
-
+// 스켈레탈 캐시 블롭의 헤더 체크섬만 검사 (메시 복원 없이 캐시 무결성 확인용)
+bool VerifySkeletalCacheChecksum(const uint8* Data, uint64 Size);
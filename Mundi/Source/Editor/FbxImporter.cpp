@@ -373,24 +373,15 @@ void FFbxImporter::ExtractVertexSkinningData(
 	FbxSkin* Skin = static_cast<FbxSkin*>(InMesh->GetDeformer(0, FbxDeformer::eSkin));
 	int ClusterCount = Skin->GetClusterCount();
 
-	// 3. BoneName -> UBone 역매핑 생성 (FbxCluster에서 이름으로 찾기 위함)
-	TMap<FString, UBone*> NameToBoneMap;
-	if (Skeleton)
-	{
-		Skeleton->ForEachBone([&](UBone* Bone)
-		{
-			if (Bone)
-			{
-				NameToBoneMap.Add(Bone->GetName().ToString(), Bone);
-			}
-		});
-	}
+	// 3. Skeleton 없으면 본 인덱스를 찾을 수 없음
+	if (!Skeleton)
+		return;
 
 	// 4. ControlPoint별 본 영향 정보 저장 (FBX 원본 정점)
 	int ControlPointCount = InMesh->GetControlPointsCount();
 	struct FVertexBoneInfluence
 	{
-		TArray<TPair<UBone*, float>> Influences; // <Bone 포인터, Weight>
+		TArray<TPair<uint16, float>> Influences; // <Bone 인덱스, Weight>
 	};
 	TArray<FVertexBoneInfluence> ControlPointInfluences;
 	ControlPointInfluences.resize(ControlPointCount);
@@ -402,13 +393,11 @@ void FFbxImporter::ExtractVertexSkinningData(
 		if (!Cluster || !Cluster->GetLink())
 			continue;
 
-		FString BoneName(Cluster->GetLink()->GetName());
-		UBone* const* FoundBone = NameToBoneMap.Find(BoneName);
-		if (!FoundBone || !*FoundBone)
+		// 클러스터 이름 -> 평탄화된 본 배열 인덱스
+		const int32 BoneIndex = Skeleton->FindBoneIndex(FName(Cluster->GetLink()->GetName()));
+		if (BoneIndex < 0 || BoneIndex >= FSkinnedVertex::InvalidBoneIndex)
 			continue;
 
-		UBone* Bone = *FoundBone;
-
 		int* ControlPointIndices = Cluster->GetControlPointIndices();
 		double* Weights = Cluster->GetControlPointWeights();
 		int InfluenceCount = Cluster->GetControlPointIndicesCount();
@@ -421,7 +410,7 @@ void FFbxImporter::ExtractVertexSkinningData(
 
 			if (CPIdx >= 0 && CPIdx < ControlPointCount && Weight > 0.0001f)
 			{
-				ControlPointInfluences[CPIdx].Influences.Add(TPair<UBone*, float>(Bone, Weight));
+				ControlPointInfluences[CPIdx].Influences.Add(TPair<uint16, float>(static_cast<uint16>(BoneIndex), Weight));
 			}
 		}
 	}
@@ -442,7 +431,7 @@ void FFbxImporter::ExtractVertexSkinningData(
 		auto& Influences = ControlPointInfluences[CPIdx].Influences;
 
 		// 가중치 내림차순 정렬
-		Influences.Sort([](const TPair<UBone*, float>& A, const TPair<UBone*, float>& B) {
+		Influences.Sort([](const TPair<uint16, float>& A, const TPair<uint16, float>& B) {
 			return A.second > B.second;
 		});
 
@@ -456,14 +445,17 @@ void FFbxImporter::ExtractVertexSkinningData(
 			TotalWeight += Influences[i].second;
 		}
 
-		// 정규화하여 저장 (Bone 포인터 직접 저장)
+		// 정규화 후 양자화하여 저장 (본 인덱스 + 8비트 가중치)
 		if (TotalWeight > 0.0001f)
 		{
+			uint16 BoneIndices[4] = {};
+			float BoneWeights[4] = {};
 			for (int i = 0; i < InfluenceCount; i++)
 			{
-				OutSkinnedVertices[VertexIdx].BonePointers[i] = Influences[i].first;
-				OutSkinnedVertices[VertexIdx].BoneWeights[i] = Influences[i].second / TotalWeight;
+				BoneIndices[i] = Influences[i].first;
+				BoneWeights[i] = Influences[i].second / TotalWeight;
 			}
+			OutSkinnedVertices[VertexIdx].SetBoneInfluences(BoneIndices, BoneWeights, InfluenceCount);
 		}
 	}
 }
@@ -1,4 +1,4 @@
-#include "pch.h"
+﻿#include "pch.h"
 #include "FbxManager.h"
 #include "FbxDebugLog.h"
 #include "Bone.h"
@@ -13,6 +13,9 @@
 #include "FbxCache.h"
 #include "FbxImporter.h"
 #include "ObjectIterator.h"
+#include "AssetPreload.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
 
 // =============================================================
 // FFbxManager
@@ -90,6 +93,8 @@ FFbxManager& FFbxManager::GetInstance()
 // =============================================================
 // Preload()
 //   - GFbxDataDir 경로에서 .fbx 파일을 전부 스캔하여 사전 로드
+//   - 파일 탐색, 캐시 검사, 캐시 역직렬화는 워커 스레드에서 병렬 처리
+//   - UObject 생성, FBX SDK 임포트(SDK 매니저 공유), GPU 리소스 생성은 메인 스레드에서 정렬된 순서로 처리
 //   - SkeletalMesh / StaticMesh 형태에 맞게 자동 분류 및 등록
 // =============================================================
 void FFbxManager::Preload()
@@ -108,60 +113,148 @@ void FFbxManager::Preload()
 		return;
 	}
 
-	size_t LoadedCount = 0;
-	size_t TotalFilesScanned = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지용
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 1) 파일 탐색 (하위 폴더 단위 병렬, 정렬 + 중복 제거된 결과)
+	const TArray<FString> FbxFiles = AssetPreload::DiscoverFiles(GFbxDataDir, { ".fbx" });
+	const int32 NumFiles = FbxFiles.Num();
 
-	try
+	// 2) 캐시 검사 + 역직렬화 (워커 스레드)
+	enum class EFbxPreloadState : uint8
+	{
+		NeedsImport,     // 유효한 캐시 없음 → 메인 스레드에서 FBX SDK 임포트
+		SkeletalCached,  // 스켈레탈 캐시에서 복원됨 (본 오브젝트 생성만 남음)
+		StaticCached,    // 스태틱 캐시에서 복원됨
+	};
+	struct FFbxPreloadResult
 	{
-		// FBX 폴더 내 모든 파일을 재귀적으로 탐색
-		for (const auto& Entry : fs::recursive_directory_iterator(FbxDir))
+		EFbxPreloadState State = EFbxPreloadState::NeedsImport;
+		FSkeletalMesh* SkeletalMesh = nullptr;
+		FStaticMesh* StaticMesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+		FSkeletalCacheSkeleton Skeleton;
+	};
+	TArray<FFbxPreloadResult> Results;
+	Results.resize(FbxFiles.size());
+
+#ifdef USE_OBJ_CACHE
+	FPreloadProgress Progress("FBX cache", NumFiles);
+	ParallelFor::Run(NumFiles, 1, [&](int32 Begin, int32 End)
 		{
-			TotalFilesScanned++;
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				const FString& PathStr = FbxFiles[Index];
+				FFbxPreloadResult& Result = Results[Index];
+
+				// 이 구간에서는 맵에 쓰지 않으므로 동시 조회는 안전
+				if (FbxSkeletalMeshMap.Contains(PathStr) || FObjManager::GetFromCache(PathStr))
+				{
+					Progress.Advance();
+					continue;
+				}
 
-			if (!Entry.is_regular_file())
-				continue;
+				const FSkeletalCachePaths SkeletalPaths = GetSkeletalCachePaths(PathStr);
+				const FStaticCachePaths StaticPaths = GetStaticCachePaths(PathStr);
+				if (!ShouldRegenerateFbxCache(PathStr, SkeletalPaths.MeshBinPath, SkeletalPaths.MaterialBinPath))
+				{
+					FSkeletalMesh* CachedMesh = new FSkeletalMesh();
+					CachedMesh->PathFileName = PathStr;
+					if (DecodeSkeletalMeshCache(SkeletalPaths.MeshBinPath, SkeletalPaths.MaterialBinPath, CachedMesh, Result.MaterialInfos, Result.Skeleton))
+					{
+						Result.SkeletalMesh = CachedMesh;
+						Result.State = EFbxPreloadState::SkeletalCached;
+					}
+					else
+					{
+						// 캐시 파일이 손상된 경우 메인 스레드에서 재생성
+						delete CachedMesh;
+						Result.MaterialInfos.clear();
+						RemoveCacheFiles(SkeletalPaths.MeshBinPath, SkeletalPaths.MaterialBinPath);
+					}
+				}
+				else if (!ShouldRegenerateFbxCache(PathStr, StaticPaths.MeshBinPath, StaticPaths.MaterialBinPath))
+				{
+					FStaticMesh* CachedMesh = new FStaticMesh();
+					CachedMesh->PathFileName = PathStr;
+					if (TryLoadStaticMeshCache(StaticPaths.MeshBinPath, StaticPaths.MaterialBinPath, CachedMesh, Result.MaterialInfos))
+					{
+						Result.StaticMesh = CachedMesh;
+						Result.State = EFbxPreloadState::StaticCached;
+					}
+					else
+					{
+						delete CachedMesh;
+						Result.MaterialInfos.clear();
+						RemoveCacheFiles(StaticPaths.MeshBinPath, StaticPaths.MaterialBinPath);
+					}
+				}
+
+				Progress.Advance();
+			}
+		});
+#endif // USE_OBJ_CACHE
 
-			const fs::path& Path = Entry.path();
-			FString Extension = Path.extension().string();
-			std::transform(Extension.begin(), Extension.end(), Extension.begin(),
-				[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	// 3) 등록 + GPU 리소스 생성 (메인 스레드, 정렬된 순서)
+	size_t LoadedCount = 0;
+	size_t ImportedCount = 0;
+	for (int32 Index = 0; Index < NumFiles; ++Index)
+	{
+		const FString& PathStr = FbxFiles[Index];
+		FFbxPreloadResult& Result = Results[Index];
 
-			// FBX 파일만 대상
-			if (Extension == ".fbx")
+		FSkeletalMesh* SkeletalMeshAsset = nullptr;
+		switch (Result.State)
+		{
+		case EFbxPreloadState::SkeletalCached:
+			SkeletalMeshAsset = Result.SkeletalMesh;
+			SkeletalMeshAsset->Skeleton = CreateSkeletonFromCache(Result.Skeleton);
+
+			// CPU Skinning 최적화: 캐시 로드 후에도 WorldBindPose와 InverseBindPoseMatrix 캐싱
+			if (SkeletalMeshAsset->Skeleton)
 			{
-				FString PathStr = NormalizePath(Path.string());
+				SkeletalMeshAsset->Skeleton->CacheAllWorldBindPoses();
+			}
 
-				// 이미 처리된 파일은 스킵
-				if (ProcessedFiles.find(PathStr) != ProcessedFiles.end())
-					continue;
+			RegisterMaterialInfos(Result.MaterialInfos);
+			FbxSkeletalMeshMap.Add(PathStr, SkeletalMeshAsset);
+			break;
 
-				ProcessedFiles.insert(PathStr);
+		case EFbxPreloadState::StaticCached:
+		{
+			RegisterMaterialInfos(Result.MaterialInfos);
 
-				// SkeletalMesh 로드 시도
-				FSkeletalMesh* SkeletalMeshAsset = LoadFbxSkeletalMeshAsset(PathStr);
+			// UStaticMesh::Load가 메모리 캐시에서 찾도록 먼저 등록
+			FObjManager::AddToCache(PathStr, Result.StaticMesh);
 
-				// 본이 존재한다면 SkeletalMesh, 아니면 StaticMesh로 구분
-				if (SkeletalMeshAsset && SkeletalMeshAsset->Skeleton)
-				{
-					USkeletalMesh* USkeletalMeshObj = NewObject<USkeletalMesh>();
-					USkeletalMeshObj->SetFilePath(PathStr);
-					USkeletalMeshObj->Load(PathStr, GEngine.GetRHIDevice()->GetDevice());
-					UResourceManager::GetInstance().Add<USkeletalMesh>(PathStr, USkeletalMeshObj);
-				}
+			UStaticMesh* UStatic = NewObject<UStaticMesh>();
+			UStatic->SetFilePath(PathStr);
+			UStatic->Load(PathStr, GEngine.GetRHIDevice()->GetDevice());
+			UResourceManager::GetInstance().Add<UStaticMesh>(PathStr, UStatic);
+			break;
+		}
 
-				++LoadedCount;
-			}
+		default:
+			// SkeletalMesh 로드 시도 (본이 없으면 내부에서 StaticMesh로 처리)
+			SkeletalMeshAsset = LoadFbxSkeletalMeshAsset(PathStr);
+			++ImportedCount;
+			break;
 		}
-	}
-	catch (const std::exception& e)
-	{
-		UE_LOG("[FBX Preload ERROR] Exception during scan: %s", e.what());
-		return;
+
+		// 본이 존재한다면 SkeletalMesh로 등록
+		if (SkeletalMeshAsset && SkeletalMeshAsset->Skeleton)
+		{
+			USkeletalMesh* USkeletalMeshObj = NewObject<USkeletalMesh>();
+			USkeletalMeshObj->SetFilePath(PathStr);
+			USkeletalMeshObj->Load(PathStr, GEngine.GetRHIDevice()->GetDevice());
+			UResourceManager::GetInstance().Add<USkeletalMesh>(PathStr, USkeletalMeshObj);
+		}
+
+		++LoadedCount;
 	}
 
-	UE_LOG("[FBX Preload] Scan complete. Total files scanned: %zu", TotalFilesScanned);
-	UE_LOG("Loaded %zu .fbx files from %s", LoadedCount, FbxDir.string().c_str());
+	UE_LOG("[FBX Preload] Scan complete. Total fbx files found: %d", NumFiles);
+	UE_LOG("Loaded %zu .fbx files from %s (%zu imported through FBX SDK) in %.1f ms",
+		LoadedCount, FbxDir.string().c_str(), ImportedCount, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 	UE_LOG("==========================================");
 }
 
@@ -294,13 +387,14 @@ void FFbxManager::BuildStaticMeshFromScene(FbxScene* Scene, const TMap<int64, FM
 	SaveStaticMeshCache(CachePaths.MeshBinPath, CachePaths.MaterialBinPath, NewStatic, MaterialInfos);
 #endif
 
+	// UStaticMesh::Load가 메모리 캐시에서 찾도록 먼저 등록
+	FObjManager::AddToCache(Path, NewStatic);
+
 	// 엔진 리소스 등록
 	UStaticMesh* UStatic = NewObject<UStaticMesh>();
 	UStatic->SetFilePath(Path);
 	UStatic->Load(Path, GEngine.GetRHIDevice()->GetDevice());
 	UResourceManager::GetInstance().Add<UStaticMesh>(Path, UStatic);
-
-	FObjManager::AddToCache(Path, NewStatic);
 }
 
 // =============================================================
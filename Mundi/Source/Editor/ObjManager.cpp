@@ -5,8 +5,13 @@
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
 #include "Enums.h"
-#include "WindowsBinReader.h"
+#include "WindowsMappedReader.h"
 #include "WindowsBinWriter.h"
+#include "TextureConverter.h"
+#include "ObjParser.h"
+#include "AssetPreload.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -163,6 +168,31 @@ bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths
 	return true;
 }
 
+// UTexture::Load가 사용할 DDS 캐시를 미리 만들어 둠 (디코딩/압축은 프리로드 워커에서, GPU 업로드는 메인 스레드에서)
+static void PrepareTextureCache(const FString& TexturePath)
+{
+#ifdef USE_DDS_CACHE
+	if (AssetPreload::GetLowerExtension(TexturePath) == ".dds")
+	{
+		return;
+	}
+
+	const FString DDSCachePath = FTextureConverter::GetDDSCachePath(TexturePath);
+	if (!FTextureConverter::ShouldRegenerateDDS(TexturePath, DDSCachePath))
+	{
+		return;
+	}
+
+	// WIC 디코딩은 스레드마다 COM 초기화가 필요
+	const HRESULT ComResult = ::CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+	FTextureConverter::ConvertToDDS(TexturePath, DDSCachePath, FTextureConverter::GetRecommendedFormat(true, true));
+	if (SUCCEEDED(ComResult))
+	{
+		::CoUninitialize();
+	}
+#endif
+}
+
 /**
  * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
  * @param ObjPath 원본 .obj 파일의 경로입니다.
@@ -226,40 +256,87 @@ void FObjManager::Preload()
 		return;
 	}
 
-	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+	// 1) 파일 탐색 (하위 폴더 단위 병렬, 정렬된 결과라 등록 순서가 항상 같음)
+	TArray<FString> ObjFiles;
+	TArray<FString> TextureFiles;
+	for (const FString& File : AssetPreload::DiscoverFiles(GDataDir, { ".obj", ".dds", ".jpg", ".png" }))
 	{
-		if (!Entry.is_regular_file())
-			continue;
-
-		const fs::path& Path = Entry.path();
-		FString Extension = Path.extension().string();
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-		if (Extension == ".obj")
+		if (AssetPreload::GetLowerExtension(File) == ".obj")
 		{
-			FString PathStr = NormalizePath(Path.string());
+			ObjFiles.Add(File);
+		}
+		else
+		{
+			TextureFiles.Add(File);
+		}
+	}
 
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
+	// 2) CPU 작업 (워커 스레드): OBJ 캐시 검사/로드/파싱, 텍스처 DDS 변환
+	struct FObjPreloadResult
+	{
+		FStaticMesh* Mesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+	};
+	TArray<FObjPreloadResult> ObjResults;
+	ObjResults.resize(ObjFiles.size());
+
+	const FString DefaultMaterialName = UResourceManager::GetInstance().GetDefaultMaterial()->GetMaterialInfo().MaterialName;
+	const int32 NumObjs = ObjFiles.Num();
+	const int32 NumJobs = NumObjs + TextureFiles.Num();
+	FPreloadProgress Progress("OBJ/Texture", NumJobs);
+
+	ParallelFor::Run(NumJobs, 1, [&](int32 Begin, int32 End)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
 			{
-				ProcessedFiles.insert(PathStr);
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
+				try
+				{
+					if (Index < NumObjs)
+					{
+						// 이 구간에서는 맵에 쓰지 않으므로 동시 조회는 안전
+						if (!ObjStaticMeshMap.Contains(ObjFiles[Index]))
+						{
+							ObjResults[Index].Mesh = BuildObjStaticMeshData(ObjFiles[Index], DefaultMaterialName, ObjResults[Index].MaterialInfos);
+						}
+					}
+					else
+					{
+						PrepareTextureCache(TextureFiles[Index - NumObjs]);
+					}
+				}
+				catch (const std::exception& e)
+				{
+					UE_LOG("FObjManager::Preload: Worker failed on item %d: %s", Index, e.what());
+				}
+				Progress.Advance();
 			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
+		});
+
+	// 3) 등록 + GPU 리소스 생성 (메인 스레드, 정렬된 순서)
+	size_t LoadedCount = 0;
+	for (int32 Index = 0; Index < NumObjs; ++Index)
+	{
+		if (ObjResults[Index].Mesh)
 		{
-			UResourceManager::GetInstance().Load<UTexture>(Path.string()); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
+			RegisterObjStaticMesh(ObjFiles[Index], ObjResults[Index].Mesh, ObjResults[Index].MaterialInfos);
 		}
+		LoadObjStaticMesh(ObjFiles[Index]);
+		++LoadedCount;
+	}
+
+	for (const FString& TexturePath : TextureFiles)
+	{
+		UResourceManager::GetInstance().Load<UTexture>(TexturePath); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
 	}
 
 	// 4) 모든 StaticMeshes 가져오기
 	RESOURCE.SetStaticMeshes();
 
-	UE_LOG("FObjManager::Preload: Loaded %zu .obj files from %s", LoadedCount, DataDir.string().c_str());
+	UE_LOG("FObjManager::Preload: Loaded %zu .obj files and %d textures from %s in %.1f ms (%d workers)",
+		LoadedCount, TextureFiles.Num(), DataDir.string().c_str(),
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles), ParallelFor::GetNumWorkers());
 }
 
 void FObjManager::Clear()
@@ -296,6 +373,24 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return nullptr;
 	}
 
+	// 3. 캐시 로드 또는 OBJ 파싱 (기본 머티리얼 이름은 미리 구해서 전달)
+	const FString DefaultMaterialName = UResourceManager::GetInstance().GetDefaultMaterial()->GetMaterialInfo().MaterialName;
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = BuildObjStaticMeshData(NormalizedPathStr, DefaultMaterialName, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+
+	// 4. 머티리얼 생성 및 메모리 캐시 등록
+	RegisterObjStaticMesh(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+	return NewFStaticMesh;
+}
+
+// 캐시 검사 → 캐시 로드 or OBJ 파싱 후 캐시 저장 → 텍스처 경로 정리까지 수행
+// UObject/리소스 매니저를 건드리지 않으므로 프리로드 워커 스레드에서 호출 가능
+FStaticMesh* FObjManager::BuildObjStaticMeshData(const FString& NormalizedPathStr, const FString& DefaultMaterialName, TArray<FMaterialInfo>& OutMaterialInfos)
+{
 #ifdef USE_OBJ_CACHE
 	// 2-1. 캐시 파일 경로 설정
 	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
@@ -324,7 +419,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		try
 		{
 			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
+			FWindowsMappedReader Reader(BinPathFileName);
 			if (!Reader.IsOpen())
 			{
 				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
@@ -334,7 +429,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			Reader.Close();
 
 			// 캐시에서 Material 데이터 로드
-			FWindowsBinReader MatReader(MatBinPathFileName);
+			FWindowsMappedReader MatReader(MatBinPathFileName);
 			if (!MatReader.IsOpen())
 			{
 				throw std::runtime_error("Failed to open material bin file for reading.");
@@ -378,8 +473,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 				UE_LOG("No materials found for '%s'. Assigning default 'uberlit' material.", NormalizedPathStr.c_str());
 
 				FMaterialInfo DefaultMaterialInfo;
-				UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
-				DefaultMaterialInfo.MaterialName = DefaultMaterial->GetMaterialInfo().MaterialName;
+				DefaultMaterialInfo.MaterialName = DefaultMaterialName;
 				Materials.Add(DefaultMaterialInfo);
 
 				TArray<FGroupInfo>& GroupInfos = Mesh->GroupInfos;
@@ -485,6 +579,13 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			ResolveAssetRelativePath(MaterialInfo.EmissiveTextureFileName, ObjBaseDir);
 	}
 
+	OutMaterialInfos = std::move(MaterialInfos);
+	return NewFStaticMesh;
+}
+
+// 머티리얼 오브젝트 생성 및 메모리 캐시 등록 (메인 스레드 전용)
+void FObjManager::RegisterObjStaticMesh(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, const TArray<FMaterialInfo>& MaterialInfos)
+{
 	// 루프가 시작되기 전에 기본 UberLit 셰이더 포인터를 한 번만 가져옵니다.
 	UShader* DefaultUberlitShader = nullptr;
 	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
@@ -516,9 +617,8 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		}
 	}
 
-	// 5. 메모리 캐시에 등록하고 반환
+	// 메모리 캐시에 등록
 	ObjStaticMeshMap.Add(NormalizedPathStr, NewFStaticMesh);
-	return NewFStaticMesh;
 }
 
 // 여기서 BVH 정보 담아주기 작업을 해야 함 
@@ -546,12 +646,142 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 }
 
 // obj File to FObjInfo, FMaterialParameters
+// 파일 전체를 매핑해서 ObjParser로 파싱 (LoadObjModelReference와 같은 결과)
 bool FObjImporter::LoadObjModel(
 	const FString& InFileName,
 	FObjInfo* const OutObjInfo,
 	TArray<FMaterialInfo>& OutMaterialInfos,
 	bool bIsRightHanded
 )
+{
+	size_t pos = InFileName.find_last_of("/\\");
+	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
+
+	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
+	FWindowsMappedReader ObjFile(InFileName);
+	if (!ObjFile.IsOpen())
+	{
+		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
+		return false;
+	}
+
+	OutObjInfo->ObjFileName = InFileName;
+
+	// 0바이트 파일은 매핑 없이 열리므로(GetData() == nullptr) 빈 버퍼로 파싱
+	// -> LoadObjModelReference와 마찬가지로 빈 모델을 반환하고 성공 처리
+	const char* ObjData = ObjFile.GetSize() > 0 ? reinterpret_cast<const char*>(ObjFile.GetData()) : "";
+
+	FString MtlFileName;
+	ObjParser::ParseObjBuffer(ObjData, static_cast<size_t>(ObjFile.GetSize()),
+		objDir, InFileName, bIsRightHanded, *OutObjInfo, MtlFileName);
+	ObjFile.Close();
+
+	// Material 파싱 시작
+	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
+
+	if (MtlFileName.empty())
+	{
+		UE_LOG("[ObjImporter::LoadObjModel] MTL file path is empty - loading without materials");
+		OutObjInfo->bHasMtl = false;
+		return true;
+	}
+
+	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
+	FWindowsMappedReader MtlFile(MtlFileName);
+	if (!MtlFile.IsOpen())
+	{
+		UE_LOG("[ObjImporter::LoadObjModel] ERROR: Material file '%s' not found for obj '%s'. Loading model without materials.", MtlFileName.c_str(), InFileName.c_str());
+		OutObjInfo->bHasMtl = false;
+		return true;
+	}
+
+	UE_LOG("[ObjImporter::LoadObjModel] MTL file opened successfully, parsing materials...");
+
+	uint32 MatCount = 0;
+
+	TArray<FString> TempOptions;
+	FString TempTexturePath;
+
+	const char* MtlData = MtlFile.GetSize() > 0 ? reinterpret_cast<const char*>(MtlFile.GetData()) : "";
+	ObjParser::ForEachLine(MtlData, static_cast<size_t>(MtlFile.GetSize()), [&](std::string_view RawLine)
+		{
+			if (RawLine.empty()) return;
+
+			const std::string_view Line = ObjParser::TrimLeading(RawLine);
+			if (Line.empty() || Line[0] == '#') return;
+
+			if (Line.starts_with("newmtl "))
+			{
+				FMaterialInfo TempMatInfo;
+				TempMatInfo.MaterialName = FString(Line.substr(7));
+				OutMaterialInfos.push_back(TempMatInfo);
+				++MatCount;
+				UE_LOG("[ObjImporter::LoadObjModel] Found material: %s", TempMatInfo.MaterialName.c_str());
+				return;
+			}
+			if (MatCount == 0)
+			{
+				return;
+			}
+
+			FMaterialInfo& Mat = OutMaterialInfos[MatCount - 1];
+			float V[3];
+			if (Line.starts_with("Kd ")) { ObjParser::ParseFloats(Line.substr(3), V, 3); Mat.DiffuseColor = FVector(V[0], V[1], V[2]); }
+			else if (Line.starts_with("Ka ")) { ObjParser::ParseFloats(Line.substr(3), V, 3); Mat.AmbientColor = FVector(V[0], V[1], V[2]); }
+			else if (Line.starts_with("Ke ")) { ObjParser::ParseFloats(Line.substr(3), V, 3); Mat.EmissiveColor = FVector(V[0], V[1], V[2]); }
+			else if (Line.starts_with("Ks ")) { ObjParser::ParseFloats(Line.substr(3), V, 3); Mat.SpecularColor = FVector(V[0], V[1], V[2]); }
+			else if (Line.starts_with("Tf ")) { ObjParser::ParseFloats(Line.substr(3), V, 3); Mat.TransmissionFilter = FVector(V[0], V[1], V[2]); }
+			else if (Line.starts_with("Tr ")) { ObjParser::ParseFloats(Line.substr(3), V, 1); Mat.Transparency = V[0]; }
+			else if (Line.starts_with("d ")) { ObjParser::ParseFloats(Line.substr(2), V, 1); Mat.Transparency = 1.0f - V[0]; }
+			else if (Line.starts_with("Ni ")) { ObjParser::ParseFloats(Line.substr(3), V, 1); Mat.OpticalDensity = V[0]; }
+			else if (Line.starts_with("Ns ")) { ObjParser::ParseFloats(Line.substr(3), V, 1); Mat.SpecularExponent = V[0]; }
+			else if (Line.starts_with("illum ")) { ObjParser::ParseFloats(Line.substr(6), V, 1); Mat.IlluminationModel = static_cast<int32>(V[0]); }
+
+			// --- 텍스처 맵 파싱 로직 (드문 줄이라 기존 토큰 분리 함수 사용) ---
+			else if (Line.starts_with("map_Kd ")) { ParseTextureMapLine(FString(Line), 7, TempOptions, TempTexturePath); Mat.DiffuseTextureFileName = TempTexturePath; }
+			else if (Line.starts_with("map_d ")) { ParseTextureMapLine(FString(Line), 7, TempOptions, TempTexturePath); Mat.TransparencyTextureFileName = TempTexturePath; }
+			else if (Line.starts_with("map_Ka ")) { ParseTextureMapLine(FString(Line), 7, TempOptions, TempTexturePath); Mat.AmbientTextureFileName = TempTexturePath; }
+			else if (Line.starts_with("map_Ks ")) { ParseTextureMapLine(FString(Line), 7, TempOptions, TempTexturePath); Mat.SpecularTextureFileName = TempTexturePath; }
+			else if (Line.starts_with("map_Ns ")) { ParseTextureMapLine(FString(Line), 7, TempOptions, TempTexturePath); Mat.SpecularExponentTextureFileName = TempTexturePath; }
+			else if (Line.starts_with("map_Ke ")) { ParseTextureMapLine(FString(Line), 7, TempOptions, TempTexturePath); Mat.EmissiveTextureFileName = TempTexturePath; }
+			else if (Line.starts_with("map_Bump "))
+			{
+				ParseTextureMapLine(FString(Line), 9, TempOptions, TempTexturePath);
+				Mat.NormalTextureFileName = TempTexturePath;
+				Mat.BumpMultiplier = GetFloatOption(TempOptions, "-bm", 1.0f);
+			}
+		});
+	MtlFile.Close();
+
+	for (uint32 i = 0; i < OutObjInfo->MaterialNames.size(); ++i)
+	{
+		bool bHasMat = false;
+		for (uint32 j = 0; j < OutMaterialInfos.size(); ++j)
+		{
+			if (OutObjInfo->MaterialNames[i] == OutMaterialInfos[j].MaterialName)
+			{
+				OutObjInfo->GroupMaterialArray.push_back(j);
+				bHasMat = true;
+				break;
+			}
+		}
+
+		if (!bHasMat && !OutMaterialInfos.empty())
+		{
+			OutObjInfo->GroupMaterialArray.push_back(0);
+		}
+	}
+
+	return true;
+}
+
+// 기존 std::getline + stringstream 파서 (OBJ BENCH에서 결과/속도 비교용 기준 구현)
+bool FObjImporter::LoadObjModelReference(
+	const FString& InFileName,
+	FObjInfo* const OutObjInfo,
+	TArray<FMaterialInfo>& OutMaterialInfos,
+	bool bIsRightHanded
+)
 {
 	uint32 subsetCount = 0;
 	FString MtlFileName;
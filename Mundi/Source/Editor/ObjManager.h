@@ -42,6 +42,8 @@ public:
 	};
 
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
+	// 기존 stringstream 기반 파서 (결과 비교/벤치마크 기준)
+	static bool LoadObjModelReference(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
 
@@ -57,6 +59,11 @@ class FObjManager
 {
 private:
 	static TMap<FString, FStaticMesh*> ObjStaticMeshMap;
+
+	// 워커 스레드에서 호출 가능한 CPU 작업 (캐시 로드/OBJ 파싱), 실패 시 nullptr
+	static FStaticMesh* BuildObjStaticMeshData(const FString& NormalizedPathStr, const FString& DefaultMaterialName, TArray<FMaterialInfo>& OutMaterialInfos);
+	// 메인 스레드 전용: 머티리얼 오브젝트 생성 및 메모리 캐시 등록
+	static void RegisterObjStaticMesh(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, const TArray<FMaterialInfo>& MaterialInfos);
 public:
 	static void Preload();
 	static void Clear();
@@ -0,0 +1,339 @@
+﻿#include "pch.h"
+#include "ObjParser.h"
+#include "ObjManager.h"
+#include "ParallelFor.h"
+#include <charconv>
+
+namespace
+{
+	// 청크 하나를 파싱한 결과 (면 인덱스는 파일 전체 기준이라 그대로 이어 붙이면 됨)
+	struct FObjChunkResult
+	{
+		struct FMaterialUse
+		{
+			FString Name;
+			uint32 LocalVIndex;
+		};
+
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+		TArray<FMaterialUse> MaterialUses;
+
+		FString MtlLib;
+		bool bHasMtlLib = false;
+		bool bHasTexcoord = false;
+		bool bHasNormal = false;
+		uint32 VIndex = 0;
+	};
+
+	struct FFaceVertex
+	{
+		uint32 PositionIndex;
+		uint32 TexCoordIndex;
+		uint32 NormalIndex;
+	};
+
+	// 청크를 나누기 시작하는 파일 크기 (작은 파일은 스레드 비용이 더 큼)
+	constexpr size_t ParallelParseThreshold = 4 * 1024 * 1024;
+	constexpr size_t MinChunkSize = 1024 * 1024;
+
+	inline bool IsSpace(char C)
+	{
+		return C == ' ' || C == '\t' || C == '\n' || C == '\r' || C == '\v' || C == '\f';
+	}
+
+	inline const char* SkipSpaces(const char* Cursor, const char* End)
+	{
+		while (Cursor < End && IsSpace(*Cursor)) ++Cursor;
+		return Cursor;
+	}
+
+	inline bool StartsWith(std::string_view Line, std::string_view Prefix)
+	{
+		return Line.size() >= Prefix.size() && memcmp(Line.data(), Prefix.data(), Prefix.size()) == 0;
+	}
+
+	// 스트림의 operator>>(float)처럼 앞 공백을 건너뛰고 '+' 부호를 허용, 실패 시 0
+	inline const char* ParseFloat(const char* Cursor, const char* End, float& OutValue)
+	{
+		Cursor = SkipSpaces(Cursor, End);
+		const char* NumberBegin = (Cursor < End && *Cursor == '+') ? Cursor + 1 : Cursor;
+		const std::from_chars_result Result = std::from_chars(NumberBegin, End, OutValue);
+		if (Result.ec != std::errc())
+		{
+			OutValue = 0.0f;
+			return Result.ec == std::errc::result_out_of_range ? Result.ptr : End;
+		}
+		return Result.ptr;
+	}
+
+	// "12", "-3" 형태의 면 인덱스 한 칸 (스트림의 operator>>(uint32)와 같은 규칙: 부호 허용, 범위 초과 시 실패)
+	inline bool ParseIndexPart(const char* Cursor, const char* End, uint32& OutValue)
+	{
+		bool bNegative = false;
+		if (Cursor < End && (*Cursor == '+' || *Cursor == '-'))
+		{
+			bNegative = (*Cursor == '-');
+			++Cursor;
+		}
+		if (Cursor >= End || *Cursor < '0' || *Cursor > '9')
+		{
+			return false;
+		}
+
+		uint64 Value = 0;
+		while (Cursor < End && *Cursor >= '0' && *Cursor <= '9')
+		{
+			Value = Value * 10 + static_cast<uint64>(*Cursor - '0');
+			if (Value > 0xFFFFFFFFull) return false;
+			++Cursor;
+		}
+		OutValue = bNegative ? static_cast<uint32>(0u - static_cast<uint32>(Value)) : static_cast<uint32>(Value);
+		return true;
+	}
+
+	// "v/vt/vn", "v//vn", "v" 형태의 토큰 하나
+	inline FFaceVertex ParseFaceToken(const char* Cursor, const char* End)
+	{
+		uint32 Values[3] = { 0, 0, 0 };
+		for (int32 Part = 0; Part < 3 && Cursor <= End; ++Part)
+		{
+			const char* PartEnd = static_cast<const char*>(memchr(Cursor, '/', End - Cursor));
+			if (!PartEnd) PartEnd = End;
+
+			uint32 Value;
+			if (PartEnd > Cursor && ParseIndexPart(Cursor, PartEnd, Value))
+			{
+				Values[Part] = Value - 1;
+			}
+
+			if (PartEnd == End) break;
+			Cursor = PartEnd + 1;
+		}
+		return { Values[0], Values[1], Values[2] };
+	}
+
+	void ParseObjLine(std::string_view RawLine, bool bIsRightHanded, const FString& FileNameForLog,
+		TArray<FFaceVertex>& FaceScratch, FObjChunkResult& Out)
+	{
+		if (RawLine.empty()) return;
+
+		const std::string_view Line = ObjParser::TrimLeading(RawLine);
+		if (Line.empty() || Line[0] == '#') return;
+
+		const char* const End = Line.data() + Line.size();
+
+		if (StartsWith(Line, "v ")) // 정점 좌표 (v x y z)
+		{
+			float X, Y, Z;
+			const char* Cursor = ParseFloat(Line.data() + 2, End, X);
+			Cursor = ParseFloat(Cursor, End, Y);
+			ParseFloat(Cursor, End, Z);
+			Out.Positions.push_back(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+		}
+		else if (StartsWith(Line, "vt ")) // 텍스처 좌표 (vt u v), 상하 반전
+		{
+			float U, V;
+			const char* Cursor = ParseFloat(Line.data() + 3, End, U);
+			ParseFloat(Cursor, End, V);
+			Out.TexCoords.push_back(FVector2D(U, 1.0f - V));
+			Out.bHasTexcoord = true;
+		}
+		else if (StartsWith(Line, "vn ")) // 법선 (vn x y z)
+		{
+			float X, Y, Z;
+			const char* Cursor = ParseFloat(Line.data() + 3, End, X);
+			Cursor = ParseFloat(Cursor, End, Y);
+			ParseFloat(Cursor, End, Z);
+			Out.Normals.push_back(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+			Out.bHasNormal = true;
+		}
+		else if (StartsWith(Line, "g "))
+		{
+			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+		}
+		else if (StartsWith(Line, "f ")) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+		{
+			FaceScratch.clear();
+			const char* Cursor = Line.data() + 2;
+			while (true)
+			{
+				Cursor = SkipSpaces(Cursor, End);
+				if (Cursor >= End || *Cursor == '#') break;
+
+				const char* TokenEnd = Cursor;
+				while (TokenEnd < End && !IsSpace(*TokenEnd)) ++TokenEnd;
+				FaceScratch.push_back(ParseFaceToken(Cursor, TokenEnd));
+				Cursor = TokenEnd;
+			}
+
+			// 4각형 이상의 폴리곤은 팬 형태로 분할
+			for (size_t i = 1; i + 1 < FaceScratch.size(); ++i)
+			{
+				const FFaceVertex& V0 = FaceScratch[0];
+				const FFaceVertex& V1 = bIsRightHanded ? FaceScratch[i + 1] : FaceScratch[i];
+				const FFaceVertex& V2 = bIsRightHanded ? FaceScratch[i] : FaceScratch[i + 1];
+				for (const FFaceVertex* V : { &V0, &V1, &V2 })
+				{
+					Out.PositionIndices.push_back(V->PositionIndex);
+					Out.TexCoordIndices.push_back(V->TexCoordIndex);
+					Out.NormalIndices.push_back(V->NormalIndex);
+				}
+				Out.VIndex += 3;
+			}
+		}
+		else if (StartsWith(Line, "mtllib "))
+		{
+			Out.MtlLib.assign(Line.substr(7));
+			Out.bHasMtlLib = true;
+		}
+		else if (StartsWith(Line, "usemtl "))
+		{
+			Out.MaterialUses.push_back({ FString(Line.substr(7)), Out.VIndex });
+		}
+		else
+		{
+			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%.*s\'",
+				FileNameForLog.c_str(), static_cast<int>(Line.size()), Line.data());
+		}
+	}
+
+	template<typename T>
+	void AppendArray(TArray<T>& Dest, const TArray<T>& Src)
+	{
+		Dest.insert(Dest.end(), Src.begin(), Src.end());
+	}
+}
+
+std::string_view ObjParser::TrimLeading(std::string_view Line)
+{
+	const size_t First = Line.find_first_not_of(" \t\n\r");
+	return First == std::string_view::npos ? std::string_view() : Line.substr(First);
+}
+
+void ObjParser::ParseFloats(std::string_view Text, float* OutValues, int32 Count)
+{
+	const char* Cursor = Text.data();
+	const char* const End = Text.data() + Text.size();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Cursor = ParseFloat(Cursor, End, OutValues[i]);
+	}
+}
+
+void ObjParser::ParseObjBuffer(const char* Data, size_t Size, const FString& ObjDir, const FString& FileNameForLog,
+	bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlFileName)
+{
+	// 1) 줄 경계로 청크 분할
+	int32 NumChunks = 1;
+	if (Size >= ParallelParseThreshold)
+	{
+		const int32 MaxChunks = (ParallelFor::GetNumWorkers() + 1) * 4;
+		NumChunks = static_cast<int32>(std::min<size_t>(MaxChunks, Size / MinChunkSize));
+		NumChunks = std::max(NumChunks, 1);
+	}
+
+	TArray<size_t> ChunkStarts;
+	ChunkStarts.resize(NumChunks + 1);
+	ChunkStarts[0] = 0;
+	for (int32 i = 1; i < NumChunks; ++i)
+	{
+		size_t Start = std::max(Size * i / NumChunks, ChunkStarts[i - 1]);
+		const char* NewLine = static_cast<const char*>(memchr(Data + Start, '\n', Size - Start));
+		ChunkStarts[i] = NewLine ? static_cast<size_t>(NewLine - Data) + 1 : Size;
+	}
+	ChunkStarts[NumChunks] = Size;
+
+	// 2) 청크별 파싱 (워커 스레드)
+	TArray<FObjChunkResult> Chunks;
+	Chunks.resize(NumChunks);
+	ParallelFor::Run(NumChunks, 1, [&](int32 Begin, int32 End)
+		{
+			TArray<FFaceVertex> FaceScratch;
+			for (int32 ChunkIndex = Begin; ChunkIndex < End; ++ChunkIndex)
+			{
+				FObjChunkResult& Chunk = Chunks[ChunkIndex];
+				const size_t ChunkBegin = ChunkStarts[ChunkIndex];
+				ForEachLine(Data + ChunkBegin, ChunkStarts[ChunkIndex + 1] - ChunkBegin, [&](std::string_view Line)
+					{
+						ParseObjLine(Line, bIsRightHanded, FileNameForLog, FaceScratch, Chunk);
+					});
+			}
+		});
+
+	// 3) 파일 순서대로 이어 붙이기 (usemtl 그룹 시작 인덱스는 앞 청크의 인덱스 수만큼 보정)
+	size_t NumPositions = 0, NumTexCoords = 0, NumNormals = 0, NumIndices = 0;
+	for (const FObjChunkResult& Chunk : Chunks)
+	{
+		NumPositions += Chunk.Positions.size();
+		NumTexCoords += Chunk.TexCoords.size();
+		NumNormals += Chunk.Normals.size();
+		NumIndices += Chunk.PositionIndices.size();
+	}
+	OutObjInfo.Positions.reserve(NumPositions);
+	OutObjInfo.TexCoords.reserve(NumTexCoords + 1);
+	OutObjInfo.Normals.reserve(NumNormals + 1);
+	OutObjInfo.PositionIndices.reserve(NumIndices);
+	OutObjInfo.TexCoordIndices.reserve(NumIndices);
+	OutObjInfo.NormalIndices.reserve(NumIndices);
+
+	uint32 VIndex = 0;
+	uint32 SubsetCount = 0;
+	bool bHasTexcoord = false;
+	bool bHasNormal = false;
+	for (FObjChunkResult& Chunk : Chunks)
+	{
+		AppendArray(OutObjInfo.Positions, Chunk.Positions);
+		AppendArray(OutObjInfo.TexCoords, Chunk.TexCoords);
+		AppendArray(OutObjInfo.Normals, Chunk.Normals);
+		AppendArray(OutObjInfo.PositionIndices, Chunk.PositionIndices);
+		AppendArray(OutObjInfo.TexCoordIndices, Chunk.TexCoordIndices);
+		AppendArray(OutObjInfo.NormalIndices, Chunk.NormalIndices);
+
+		for (FObjChunkResult::FMaterialUse& Use : Chunk.MaterialUses)
+		{
+			OutObjInfo.MaterialNames.push_back(std::move(Use.Name));
+			OutObjInfo.GroupIndexStartArray.push_back(VIndex + Use.LocalVIndex);
+			++SubsetCount;
+		}
+
+		if (Chunk.bHasMtlLib)
+		{
+			OutMtlFileName = ObjDir + Chunk.MtlLib;
+		}
+
+		bHasTexcoord |= Chunk.bHasTexcoord;
+		bHasNormal |= Chunk.bHasNormal;
+		VIndex += Chunk.VIndex;
+
+		// 다음 청크를 붙이는 동안 메모리 사용량을 줄이기 위해 바로 해제
+		Chunk = FObjChunkResult();
+	}
+
+	// 4) 그룹 정리 (기존 파서와 동일)
+	if (SubsetCount == 0)
+	{
+		OutObjInfo.GroupIndexStartArray.push_back(0);
+		SubsetCount++;
+	}
+	OutObjInfo.GroupIndexStartArray.push_back(VIndex);
+
+	if (OutObjInfo.GroupIndexStartArray.size() > 1 && OutObjInfo.GroupIndexStartArray[1] == 0)
+	{
+		OutObjInfo.GroupIndexStartArray.erase(OutObjInfo.GroupIndexStartArray.begin() + 1);
+		SubsetCount--;
+	}
+
+	if (!bHasNormal)
+	{
+		OutObjInfo.Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
+	}
+	if (!bHasTexcoord)
+	{
+		OutObjInfo.TexCoords.push_back(FVector2D(0.0f, 0.0f));
+	}
+}
@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#include "UEContainer.h"
+#include <string_view>
+
+struct FObjInfo;
+
+// ─────────────────────────────────────────────
+// ObjParser
+//  - 파일 전체를 메모리에 올린 버퍼를 직접 훑는 OBJ/MTL 파서 (줄마다 stringstream을 만들지 않음)
+//  - 정수는 직접 파싱, 실수는 std::from_chars (스트림과 같은 반올림이라 결과가 비트 단위로 동일)
+//  - 큰 파일은 줄 경계로 청크를 나눠 ParallelFor로 파싱한 뒤 파일 순서대로 이어 붙임
+//  - 결과는 FObjImporter::LoadObjModelReference(기존 stringstream 파서)와 동일해야 함
+// ─────────────────────────────────────────────
+namespace ObjParser
+{
+	// OBJ 버퍼 파싱 (정점/면/usemtl 그룹까지), mtllib 경로는 ObjDir을 붙여서 반환
+	void ParseObjBuffer(const char* Data, size_t Size, const FString& ObjDir, const FString& FileNameForLog,
+		bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlFileName);
+
+	// 텍스트 모드 getline과 같은 규칙으로 줄을 나눔 ("\r\n"의 '\r'은 제거)
+	template<typename TFunc>
+	void ForEachLine(const char* Data, size_t Size, TFunc&& Func)
+	{
+		const char* Cursor = Data;
+		const char* const End = Data + Size;
+		while (Cursor < End)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(Cursor, '\n', End - Cursor));
+			const char* Next = LineEnd ? LineEnd + 1 : End;
+			if (!LineEnd) LineEnd = End;
+			if (LineEnd > Cursor && LineEnd < End && LineEnd[-1] == '\r') --LineEnd;
+			Func(std::string_view(Cursor, LineEnd - Cursor));
+			Cursor = Next;
+		}
+	}
+
+	// 앞쪽 " \t\n\r" 제거 (기존 파서의 find_first_not_of와 동일)
+	std::string_view TrimLeading(std::string_view Line);
+
+	// 공백을 건너뛰며 실수를 Count개 읽음, 읽지 못한 값은 0
+	void ParseFloats(std::string_view Text, float* OutValues, int32 Count);
+}
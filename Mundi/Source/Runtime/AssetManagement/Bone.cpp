@@ -59,53 +59,66 @@ const FTransform& UBone::GetRelativeTransform() const
 void UBone::SetRelativeLocation(const FVector& InLocation)
 {
     RelativeTransform.Translation = InLocation;
+    MarkWorldTransformDirty();
 }
 
 void UBone::SetRelativeRotation(const FQuat& InRotatation)
 {
     RelativeTransform.Rotation = InRotatation;
+    MarkWorldTransformDirty();
 }
 
 void UBone::SetRelativeScale(const FVector& InScale)
 {
     RelativeTransform.Scale3D = InScale;
+    MarkWorldTransformDirty();
 }
 
 void UBone::SetRelativeTransform(const FTransform& InRelativeTransform)
 {
     RelativeTransform = InRelativeTransform;
+    MarkWorldTransformDirty();
 }
 
 FVector UBone::GetWorldLocation() const
 {
-    if (!Parent)
-        return GetRelativeLocation();
-    FTransform ParentWorldTransform = Parent->GetWorldTransform();
-    return ParentWorldTransform.GetWorldTransform(RelativeTransform).Translation;
+    return GetWorldTransform().Translation;
 }
 
 FQuat UBone::GetWorldRotation() const
 {
-    if (!Parent)
-        return GetRelativeRotation();
-    FTransform ParentWorldTransform = Parent->GetWorldTransform();
-    return ParentWorldTransform.GetWorldTransform(RelativeTransform).Rotation;
+    return GetWorldTransform().Rotation;
 }
 
 FVector UBone::GetWorldScale() const
 {
-    if (!Parent)
-        return GetRelativeScale();
-    FTransform ParentWorldTransform = Parent->GetWorldTransform();
-    return ParentWorldTransform.GetWorldTransform(RelativeTransform).Scale3D;
+    return GetWorldTransform().Scale3D;
 }
 
-FTransform UBone::GetWorldTransform() const
+const FTransform& UBone::GetWorldTransform() const
 {
-    if (!Parent)
-        return RelativeTransform;
-    FTransform ParentWorldTransform = Parent->GetWorldTransform();
-    return ParentWorldTransform.GetWorldTransform(RelativeTransform);
+    if (bWorldTransformDirty)
+    {
+        // 부모 체인은 더티인 구간만 한 번씩 재계산되고 나머지는 캐시 재사용
+        CachedWorldTransform = Parent
+            ? Parent->GetWorldTransform().GetWorldTransform(RelativeTransform)
+            : RelativeTransform;
+        bWorldTransformDirty = false;
+    }
+    return CachedWorldTransform;
+}
+
+void UBone::MarkWorldTransformDirty()
+{
+    if (bWorldTransformDirty)
+        return;
+
+    bWorldTransformDirty = true;
+    for (UBone* Child : Children)
+    {
+        if (Child)
+            Child->MarkWorldTransformDirty();
+    }
 }
 
 // Local BindPos Getter Setter
@@ -223,6 +236,7 @@ void UBone::AddChild(UBone* InChild)
     if (!InChild)
         return;
     Children.push_back(InChild);
+    InChild->MarkWorldTransformDirty();
 }
 
 void UBone::RemoveChild(UBone* InChild)
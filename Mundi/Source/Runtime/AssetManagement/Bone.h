@@ -30,7 +30,7 @@ public:
     FVector GetWorldLocation() const;
     FQuat GetWorldRotation() const;
     FVector GetWorldScale() const;
-    FTransform GetWorldTransform() const;
+    const FTransform& GetWorldTransform() const;  // 캐시된 값 반환 (더티일 때만 재계산)
 
     // Local BindPos Getter Setter
     const FVector& GetRelativeBindPoseLocation() const;
@@ -57,7 +57,7 @@ public:
     FTransform GetBoneOffset();
     FMatrix GetSkinningMatrix();
 
-    void SetParent(UBone* InParent) { Parent = InParent; }
+    void SetParent(UBone* InParent) { Parent = InParent; MarkWorldTransformDirty(); }
     UBone* GetParent() const { return Parent; }
 
     void AddChild(UBone* InChild);
@@ -68,6 +68,9 @@ public:
     void DuplicateSubObjects() override;
     void PostDuplicate() override;
 private:
+    // 자신과 자식 뼈들의 월드 트랜스폼 캐시 무효화 (이미 더티면 자손도 더티이므로 전파 생략)
+    void MarkWorldTransformDirty();
+
     FName Name{};
 
     // 현재 뼈의 트랜스폼 정보를 저장
@@ -80,4 +83,8 @@ private:
 
     UBone* Parent{};
     TArray<UBone*> Children{};
+
+    // 월드 트랜스폼 캐시 (GetWorldTransform에서 지연 갱신)
+    mutable FTransform CachedWorldTransform{};
+    mutable bool bWorldTransformDirty = true;
 };
\ No newline at end of file
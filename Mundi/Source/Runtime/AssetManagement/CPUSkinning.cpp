@@ -0,0 +1,191 @@
+﻿#include "pch.h"
+#include "CPUSkinning.h"
+#include "ParallelFor.h"
+
+// SkinVertices는 FVertexDynamic을 16바이트 단위로 묶어서 씀
+// [Position.xyz, Normal.x] [Normal.yz, UV.xy] [Tangent] [Color]
+static_assert(sizeof(FVertexDynamic) == 64, "FVertexDynamic layout changed: update CPUSkinning::SkinVertices");
+static_assert(offsetof(FVertexDynamic, Normal) == 12, "FVertexDynamic layout changed: update CPUSkinning::SkinVertices");
+static_assert(offsetof(FVertexDynamic, UV) == 24, "FVertexDynamic layout changed: update CPUSkinning::SkinVertices");
+static_assert(offsetof(FVertexDynamic, Tangent) == 32, "FVertexDynamic layout changed: update CPUSkinning::SkinVertices");
+static_assert(offsetof(FVertexDynamic, Color) == 48, "FVertexDynamic layout changed: update CPUSkinning::SkinVertices");
+
+namespace
+{
+    // 정점 수가 이보다 적으면 스레드를 깨우지 않음
+    constexpr int32 SkinningMinBatchSize = 2048;
+
+    inline __m128 LoadVector3(const FVector& V)
+    {
+        return _mm_set_ps(0.0f, V.Z, V.Y, V.X);
+    }
+
+    inline __m128 Dot3(__m128 A, __m128 B)
+    {
+        return _mm_dp_ps(A, B, 0x7F);
+    }
+
+    // Len > KINDA_SMALL_NUMBER면 정규화, 아니면 Fallback (FVector::GetNormalized/Normalize와 동일한 규칙)
+    inline __m128 SafeNormalize3(__m128 V, __m128 Fallback)
+    {
+        const __m128 Len = _mm_sqrt_ps(Dot3(V, V));
+        const __m128 Mask = _mm_cmpgt_ps(Len, _mm_set1_ps(KINDA_SMALL_NUMBER));
+        return _mm_blendv_ps(Fallback, _mm_div_ps(V, Len), Mask);
+    }
+
+    // 16바이트 단위로 4번 써서 정점 하나를 채움 (Write-Combined 메모리에 유리)
+    inline void StoreVertex(FVertexDynamic& Dst, __m128 Position, __m128 Normal, __m128 UV, __m128 Tangent, __m128 Color)
+    {
+        float* Out = reinterpret_cast<float*>(&Dst);
+        const __m128 PosZNormX = _mm_shuffle_ps(Position, Normal, _MM_SHUFFLE(0, 0, 2, 2));         // (pz, pz, nx, nx)
+        const __m128 Row0 = _mm_shuffle_ps(Position, PosZNormX, _MM_SHUFFLE(2, 0, 1, 0));            // (px, py, pz, nx)
+        const __m128 Row1 = _mm_shuffle_ps(Normal, UV, _MM_SHUFFLE(1, 0, 2, 1));                     // (ny, nz, u, v)
+        _mm_storeu_ps(Out + 0, Row0);
+        _mm_storeu_ps(Out + 4, Row1);
+        _mm_storeu_ps(Out + 8, Tangent);
+        _mm_storeu_ps(Out + 12, Color);
+    }
+}
+
+void CPUSkinning::SkinVertices(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 Begin, int32 End, const FSkinningPalette& Palette)
+{
+    const __m128 Zero = _mm_setzero_ps();
+
+    for (int32 i = Begin; i < End; ++i)
+    {
+        const FSkinnedVertex& SrcVertex = Src[i];
+
+        const __m128 Position = LoadVector3(SrcVertex.Position);
+        const __m128 Normal = LoadVector3(SrcVertex.Normal);
+        const __m128 UV = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&SrcVertex.UV)));
+        const __m128 Tangent = SrcVertex.Tangent.SimdData;
+        const __m128 Color = SrcVertex.Color.SimdData;
+
+        // Weight가 없는 정점은 원본 유지 (Rigid Body)
+        if (SrcVertex.BoneWeights[0] == 0)
+        {
+            StoreVertex(Dst[i], Position, Normal, UV, Tangent, Color);
+            continue;
+        }
+
+        // 1. 영향 본 행렬을 가중 합성 (선형 블렌드 스키닝: sum(w * M) 한 번만 변환)
+        __m128 M0 = Zero, M1 = Zero, M2 = Zero, M3 = Zero;
+        __m128 N0 = Zero, N1 = Zero, N2 = Zero;
+        for (int j = 0; j < 4; ++j)
+        {
+            if (SrcVertex.BoneWeights[j] == 0)
+                break;
+
+            const uint16 BoneIndex = SrcVertex.BoneIndices[j];
+            if (BoneIndex >= Palette.NumBones)
+                continue;
+
+            const __m128 Weight = _mm_set1_ps(SrcVertex.GetBoneWeight(j));
+            const FMatrix& M = Palette.BoneMatrices[BoneIndex];
+            const FMatrix& N = Palette.NormalMatrices[BoneIndex];
+            M0 = _mm_add_ps(M0, _mm_mul_ps(Weight, M.Rows[0]));
+            M1 = _mm_add_ps(M1, _mm_mul_ps(Weight, M.Rows[1]));
+            M2 = _mm_add_ps(M2, _mm_mul_ps(Weight, M.Rows[2]));
+            M3 = _mm_add_ps(M3, _mm_mul_ps(Weight, M.Rows[3]));
+            N0 = _mm_add_ps(N0, _mm_mul_ps(Weight, N.Rows[0]));
+            N1 = _mm_add_ps(N1, _mm_mul_ps(Weight, N.Rows[1]));
+            N2 = _mm_add_ps(N2, _mm_mul_ps(Weight, N.Rows[2]));
+        }
+
+        // 2. 합성 행렬로 한 번씩 변환 (row-vector: v' = v * M)
+        const __m128 PX = _mm_shuffle_ps(Position, Position, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 PY = _mm_shuffle_ps(Position, Position, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 PZ = _mm_shuffle_ps(Position, Position, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 SkinnedPosition = _mm_add_ps(_mm_add_ps(_mm_mul_ps(PX, M0), _mm_mul_ps(PY, M1)), _mm_add_ps(_mm_mul_ps(PZ, M2), M3));
+
+        const __m128 NX = _mm_shuffle_ps(Normal, Normal, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 NY = _mm_shuffle_ps(Normal, Normal, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 NZ = _mm_shuffle_ps(Normal, Normal, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 SkinnedNormal = _mm_add_ps(_mm_add_ps(_mm_mul_ps(NX, N0), _mm_mul_ps(NY, N1)), _mm_mul_ps(NZ, N2));
+
+        // Tangent는 방향 벡터이므로 이동(M3) 제외
+        const __m128 TX = _mm_shuffle_ps(Tangent, Tangent, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 TY = _mm_shuffle_ps(Tangent, Tangent, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 TZ = _mm_shuffle_ps(Tangent, Tangent, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 SkinnedTangent = _mm_add_ps(_mm_add_ps(_mm_mul_ps(TX, M0), _mm_mul_ps(TY, M1)), _mm_mul_ps(TZ, M2));
+
+        // 3. Normal 정규화 + Gram-Schmidt로 Tangent 직교화, Handedness(w) 유지
+        const __m128 OutNormal = SafeNormalize3(SkinnedNormal, Zero);
+        const __m128 Orthogonal = _mm_sub_ps(SkinnedTangent, _mm_mul_ps(OutNormal, Dot3(SkinnedTangent, OutNormal)));
+        __m128 OutTangent = SafeNormalize3(Orthogonal, Orthogonal);
+        OutTangent = _mm_blend_ps(OutTangent, Tangent, 0x8);
+
+        StoreVertex(Dst[i], SkinnedPosition, OutNormal, UV, OutTangent, Color);
+    }
+}
+
+void CPUSkinning::SkinVerticesParallel(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 VertexCount, const FSkinningPalette& Palette)
+{
+    ParallelFor::Run(VertexCount, SkinningMinBatchSize, [&](int32 Begin, int32 End)
+    {
+        SkinVertices(Src, Dst, Begin, End, Palette);
+    });
+}
+
+void CPUSkinning::SkinVerticesReference(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 Begin, int32 End, const FSkinningPalette& Palette)
+{
+    for (int32 i = Begin; i < End; i++)
+    {
+        const FSkinnedVertex& SrcVertex = Src[i];
+        FVertexDynamic& DstVertex = Dst[i];
+
+        // 원본 데이터 복사 (UV, Color는 변환 안 함)
+        DstVertex.UV = SrcVertex.UV;
+        DstVertex.Color = SrcVertex.Color;
+
+        // Weight가 없는 정점은 원본 유지 (Rigid Body)
+        if (SrcVertex.BoneWeights[0] == 0)
+        {
+            DstVertex.Position = SrcVertex.Position;
+            DstVertex.Normal = SrcVertex.Normal;
+            DstVertex.Tangent = SrcVertex.Tangent;
+            continue;
+        }
+
+        FVector SkinnedPosition(0, 0, 0);
+        FVector SkinnedNormal(0, 0, 0);
+        FVector SkinnedTangent(0, 0, 0);
+        const FVector4 SrcTangentDir(SrcVertex.Tangent.X, SrcVertex.Tangent.Y, SrcVertex.Tangent.Z, 0.0f);
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (SrcVertex.BoneWeights[j] == 0)
+                break;
+
+            const uint16 BoneIndex = SrcVertex.BoneIndices[j];
+            if (BoneIndex >= Palette.NumBones)
+                continue;
+
+            const float Weight = SrcVertex.GetBoneWeight(j);
+            const FMatrix& SkinningMatrix = Palette.BoneMatrices[BoneIndex];
+            const FMatrix& InverseSkinningMatrix = Palette.NormalMatrices[BoneIndex];
+
+            // Position 변환
+            SkinnedPosition += (SrcVertex.Position * SkinningMatrix) * Weight;
+
+            // Normal 변환 (비균등 스케일 대응: Inverse Transpose 사용)
+            SkinnedNormal += (SrcVertex.Normal * InverseSkinningMatrix) * Weight;
+
+            // Tangent 변환 (방향 벡터: w = 0)
+            const FVector4 TransformedTangent = SrcTangentDir * SkinningMatrix;
+            SkinnedTangent += FVector(TransformedTangent.X, TransformedTangent.Y, TransformedTangent.Z) * Weight;
+        }
+
+        // Normal 정규화
+        DstVertex.Position = SkinnedPosition;
+        DstVertex.Normal = SkinnedNormal.GetNormalized();
+
+        // Gram-Schmidt 직교화: Tangent를 Normal에 대해 직교하게 만듦
+        FVector OrthogonalTangent = SkinnedTangent - DstVertex.Normal * FVector::Dot(SkinnedTangent, DstVertex.Normal);
+        OrthogonalTangent.Normalize();
+
+        // Handedness(w값) 유지
+        float Handedness = SrcVertex.Tangent.W;
+        DstVertex.Tangent = FVector4(OrthogonalTangent.X, OrthogonalTangent.Y, OrthogonalTangent.Z, Handedness);
+    }
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+
+// ─────────────────────────────────────────────
+// CPU 스키닝 커널
+//  - 본 팔레트(USkeleton::GetBones() 순서)와 FSkinnedVertex를 받아 FVertexDynamic으로 변환
+//  - SkinVertices: 정점마다 영향 본 행렬을 먼저 가중 합성한 뒤 위치/노멀/탄젠트를 한 번씩만 변환 (SSE)
+//  - SkinVerticesParallel: 정점 구간을 워커 스레드에 나눠 SkinVertices 실행
+//  - SkinVerticesReference: 기존 스칼라 구현 (검증용)
+// ─────────────────────────────────────────────
+struct FSkinningPalette
+{
+    const FMatrix* BoneMatrices = nullptr;      // InverseBindPose * CurrentWorld
+    const FMatrix* NormalMatrices = nullptr;    // BoneMatrices의 Inverse Transpose
+    int32 NumBones = 0;
+};
+
+namespace CPUSkinning
+{
+    // [Begin, End) 정점 변환. Dst는 쓰기 전용으로만 접근 (매핑된 동적 버텍스 버퍼에 바로 써도 됨)
+    void SkinVertices(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 Begin, int32 End, const FSkinningPalette& Palette);
+
+    void SkinVerticesParallel(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 VertexCount, const FSkinningPalette& Palette);
+
+    void SkinVerticesReference(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 Begin, int32 End, const FSkinningPalette& Palette);
+}
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "SkeletalMesh.h"
+#include "CPUSkinning.h"
 
 #include "FbxManager.h"
 
@@ -212,136 +213,59 @@ void USkeletalMesh::UpdateCPUSkinning(ID3D11DeviceContext* DeviceContext)
     if (SkinnedVerts.IsEmpty())
         return;
 
-    // 1. 변환된 정점 버퍼 준비
-    int VertexCount = SkinnedVerts.Num();
-    if (TransformedVertices.Num() != VertexCount)
-    {
-        TransformedVertices.resize(VertexCount);
-    }
-
-    // 2. Bone Skinning Matrix 배열 캐싱 (프레임당 한 번만 계산!)
-    // ========================================================================
-    // 최적화 핵심: 각 본의 스키닝 행렬을 미리 계산해서 캐시
-    // - 이전: 매 정점마다 본 행렬 계산 (5000정점 × 4본 = 20000번)
-    // - 최적화: 프레임당 한 번만 계산 (50본 = 50번)
-    // ========================================================================
-
-    // 2.1 Bone 포인터 → 인덱스 매핑 생성
-    TMap<UBone*, int32> BoneToIndexMap;
-    TArray<FMatrix> BoneMatrices;
-    TArray<FMatrix> BoneInverseMatrices;  // Normal 변환용 Inverse 행렬 캐시
-
-    int32 BoneIndex = 0;
-    SkeletalMeshAsset->Skeleton->ForEachBone([&](UBone* Bone)
-    {
-        if (Bone)
-        {
-            // Bone 포인터를 인덱스로 매핑
-            BoneToIndexMap.Add(Bone, BoneIndex);
-
-            // 스키닝 행렬 계산 및 캐시
-            FMatrix InverseBindPoseMatrix = Bone->GetInverseBindPoseMatrix();
-            FMatrix CurrentWorldMatrix = Bone->GetWorldTransform().ToMatrix();
-            FMatrix SkinningMatrix = InverseBindPoseMatrix * CurrentWorldMatrix;
-            BoneMatrices.Add(SkinningMatrix);
-
-            // Normal 변환용 Inverse 행렬 계산 (비균등 스케일 대응)
-            FMatrix InverseSkinningMatrix = SkinningMatrix.Transpose().InverseAffine();
-            BoneInverseMatrices.Add(InverseSkinningMatrix);
-
-            BoneIndex++;
-        }
-    });
-
-    // 3. 각 정점마다 CPU Skinning 수행
-    for (int i = 0; i < VertexCount; i++)
-    {
-        const FSkinnedVertex& SrcVertex = SkinnedVerts[i];
-        FVertexDynamic& DstVertex = TransformedVertices[i];
+    if (!VertexBuffer || !DeviceContext)
+        return;
 
-        // 원본 데이터 복사 (UV, Color는 변환 안 함)
-        DstVertex.UV = SrcVertex.UV;
-        DstVertex.Color = SrcVertex.Color;
+    // 1. Bone Skinning Matrix 팔레트 계산 (프레임당 본 개수만큼 한 번)
+    BuildBonePalette(SkeletalMeshAsset->Skeleton);
 
-        // Skinning 계산: Position, Normal, Tangent를 Bone Matrix로 변환
-        // 먼저 총 Weight 확인
-        float TotalWeight = SrcVertex.BoneWeights[0] + SrcVertex.BoneWeights[1] +
-                           SrcVertex.BoneWeights[2] + SrcVertex.BoneWeights[3];
+    // 2. 매핑된 Dynamic Vertex Buffer에 바로 스키닝 결과 기록 (중간 정점 배열 복사 없음)
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    HRESULT hr = DeviceContext->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
+    if (FAILED(hr))
+        return;
 
-        // Weight가 없는 정점은 원본 유지 (Rigid Body)
-        if (TotalWeight < 0.0001f)
-        {
-            DstVertex.Position = SrcVertex.Position;
-            DstVertex.Normal = SrcVertex.Normal;
-            DstVertex.Tangent = SrcVertex.Tangent;
-            continue;
-        }
+    const FSkinningPalette Palette{ BonePalette.data(), BoneNormalPalette.data(), BonePalette.Num() };
+    CPUSkinning::SkinVerticesParallel(
+        SkinnedVerts.data(),
+        static_cast<FVertexDynamic*>(MappedResource.pData),
+        SkinnedVerts.Num(),
+        Palette
+    );
 
-        FVector SkinnedPosition(0, 0, 0);
-        FVector SkinnedNormal(0, 0, 0);
-        FVector SkinnedTangent(0, 0, 0);
+    DeviceContext->Unmap(VertexBuffer, 0);
 
-        for (int j = 0; j < 4; j++)
-        {
-            float Weight = SrcVertex.BoneWeights[j];
-            if (Weight <= 0.0001f)
-                continue;
-
-            UBone* Bone = SrcVertex.BonePointers[j];
-            if (!Bone)
-                continue;
-
-            // 캐시된 Skinning Matrix 가져오기 (매번 계산 안 함!)
-            int32* BoneIndexPtr = BoneToIndexMap.Find(Bone);
-            if (!BoneIndexPtr || *BoneIndexPtr >= BoneMatrices.Num())
-                continue;
-
-            const FMatrix& SkinningMatrix = BoneMatrices[*BoneIndexPtr];
-            const FMatrix& InverseSkinningMatrix = BoneInverseMatrices[*BoneIndexPtr];
-
-            // Position 변환
-            FVector TransformedPos = SrcVertex.Position * SkinningMatrix;
-            SkinnedPosition += TransformedPos * Weight;
-
-            // Normal 변환 (비균등 스케일 대응: Inverse Transpose 사용)
-            FVector TransformedNormal = SrcVertex.Normal * InverseSkinningMatrix;
-            SkinnedNormal += TransformedNormal * Weight;
-
-            // Tangent 변환 (Normal과 동일하게 Inverse Transpose 적용)
-            FVector SrcTangent3(SrcVertex.Tangent.X, SrcVertex.Tangent.Y, SrcVertex.Tangent.Z);
-            FVector TransformedTangent = SrcTangent3 * SkinningMatrix;
-            SkinnedTangent += TransformedTangent * Weight;
-        }
+    UpdateCPUSkinningDirty = false;
+}
 
-        // Normal 정규화
-        DstVertex.Position = SkinnedPosition;
-        DstVertex.Normal = SkinnedNormal.GetNormalized();
+void USkeletalMesh::MarkAsDirty()
+{
+    UpdateCPUSkinningDirty = true;
+}
 
-        // Gram-Schmidt 직교화: Tangent를 Normal에 대해 직교하게 만듦
-        FVector OrthogonalTangent = SkinnedTangent - DstVertex.Normal * FVector::Dot(SkinnedTangent, DstVertex.Normal);
-        OrthogonalTangent.Normalize();
+void USkeletalMesh::BuildBonePalette(const USkeleton* Skeleton)
+{
+    const TArray<UBone*>& Bones = Skeleton->GetBones();
+    const TArray<int32>& ParentIndices = Skeleton->GetParentIndices();
+    const int32 NumBones = Bones.Num();
 
-        // Handedness(w값) 유지
-        float Handedness = SrcVertex.Tangent.W;
-        DstVertex.Tangent = FVector4(OrthogonalTangent.X, OrthogonalTangent.Y, OrthogonalTangent.Z, Handedness);
-    }
+    BoneWorldTransforms.resize(NumBones);
+    BonePalette.resize(NumBones);
+    BoneNormalPalette.resize(NumBones);
 
-    // 4. Dynamic Vertex Buffer 업데이트
-    if (VertexBuffer && DeviceContext)
+    for (int32 i = 0; i < NumBones; ++i)
     {
-        D3D11_MAPPED_SUBRESOURCE MappedResource;
-        HRESULT hr = DeviceContext->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-        if (SUCCEEDED(hr))
-        {
-            memcpy(MappedResource.pData, TransformedVertices.data(), sizeof(FVertexDynamic) * VertexCount);
-            DeviceContext->Unmap(VertexBuffer, 0);
-        }
+        // 부모는 항상 앞 인덱스이므로 이미 계산된 부모 월드 트랜스폼을 재사용 (재귀 호출 없음)
+        const FTransform& RelativeTransform = Bones[i]->GetRelativeTransform();
+        const int32 ParentIndex = ParentIndices[i];
+        BoneWorldTransforms[i] = (ParentIndex >= 0)
+            ? BoneWorldTransforms[ParentIndex].GetWorldTransform(RelativeTransform)
+            : RelativeTransform;
+
+        const FMatrix SkinningMatrix = Bones[i]->GetInverseBindPoseMatrix() * BoneWorldTransforms[i].ToMatrix();
+        BonePalette[i] = SkinningMatrix;
+
+        // Normal 변환용 Inverse 행렬 계산 (비균등 스케일 대응)
+        BoneNormalPalette[i] = SkinningMatrix.Transpose().InverseAffine();
     }
-
-    UpdateCPUSkinningDirty = false;
 }
-
-void USkeletalMesh::MarkAsDirty()
-{
-    UpdateCPUSkinningDirty = true;
-}
\ No newline at end of file
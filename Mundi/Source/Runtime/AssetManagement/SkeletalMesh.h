@@ -43,8 +43,13 @@ public:
 private:
     FSkeletalMesh* SkeletalMeshAsset{};
 
-    // CPU Skinning용 변환된 정점 버퍼 (FVertexDynamic 형식으로 GPU 전송)
-    TArray<FVertexDynamic> TransformedVertices;
+    // 본 팔레트 (USkeleton::GetBones() 순서, 매 프레임 재할당 없이 재사용)
+    TArray<FTransform> BoneWorldTransforms;
+    TArray<FMatrix> BonePalette;            // InverseBindPose * CurrentWorld
+    TArray<FMatrix> BoneNormalPalette;      // Normal 변환용 Inverse Transpose
+
+    // 위상 정렬된 본 배열을 한 번 순회하며 월드 트랜스폼과 스키닝 행렬을 계산
+    void BuildBonePalette(const USkeleton* Skeleton);
 
     // Dynamic Vertex Buffer 생성 (CPU 쓰기 가능)
     void CreateDynamicVertexBuffer(ID3D11Device* Device, int VertexCount);
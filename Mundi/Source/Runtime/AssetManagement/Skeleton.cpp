@@ -10,6 +10,7 @@ END_PROPERTIES()
 USkeleton::USkeleton(UBone* InRoot)
 {
     Root = InRoot;
+    RebuildBoneArray();
 }
 
 USkeleton::~USkeleton()
@@ -24,6 +25,9 @@ void USkeleton::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
     Root = Root->Duplicate();
+
+    // 자식 순서가 그대로 복제되므로 본 인덱스도 원본과 동일하게 유지됨
+    RebuildBoneArray();
 }
 
 void USkeleton::PostDuplicate() {}
@@ -36,15 +40,55 @@ UBone* USkeleton::GetRoot() const
 void USkeleton::SetRoot(UBone* InRoot)
 {
     Root = InRoot;
+    RebuildBoneArray();
 }
 
 void USkeleton::CacheAllWorldBindPoses()
 {
-    ForEachBone([](UBone* Bone)
+    // 부모가 항상 앞에 있으므로 순서대로 처리하면 부모의 WorldBindPose가 먼저 갱신됨
+    for (UBone* Bone : Bones)
+    {
+        Bone->CacheWorldBindPose();
+    }
+}
+
+int32 USkeleton::FindBoneIndex(const FName& BoneName) const
+{
+    if (const int32* Found = BoneNameToIndex.Find(BoneName.ToString()))
+    {
+        return *Found;
+    }
+    return -1;
+}
+
+void USkeleton::RebuildBoneArray()
+{
+    Bones.Empty();
+    ParentIndices.Empty();
+    BoneNameToIndex.Empty();
+
+    TMap<UBone*, int32> BoneToIndex;
+    ForEachBone([&](UBone* Bone)
     {
-        if (Bone)
+        const int32 Index = Bones.Num();
+        Bones.Add(Bone);
+        BoneToIndex.Add(Bone, Index);
+
+        int32 ParentIndex = -1;
+        if (UBone* Parent = Bone->GetParent())
+        {
+            if (const int32* Found = BoneToIndex.Find(Parent))
+            {
+                ParentIndex = *Found;
+            }
+        }
+        ParentIndices.Add(ParentIndex);
+
+        // 이름이 중복되면 먼저 나온 본을 사용
+        const FString BoneName = Bone->GetName().ToString();
+        if (!BoneNameToIndex.Contains(BoneName))
         {
-            Bone->CacheWorldBindPose();
+            BoneNameToIndex.Add(BoneName, Index);
         }
     });
 }
\ No newline at end of file
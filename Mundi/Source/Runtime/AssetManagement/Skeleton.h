@@ -24,9 +24,26 @@ public:
     // CPU Skinning 최적화: 모든 본의 WorldBindPose와 InverseBindPoseMatrix 캐싱
     void CacheAllWorldBindPoses();
 
+    // 평탄화된 본 배열 (전위 순회 순서 = 부모가 항상 자식보다 앞)
+    // 정점의 BoneIndices는 이 배열의 인덱스이며, 본 팔레트도 이 순서로 한 번에 계산됨
+    const TArray<UBone*>& GetBones() const { return Bones; }
+    const TArray<int32>& GetParentIndices() const { return ParentIndices; }
+    int32 GetNumBones() const { return Bones.Num(); }
+
+    // 이름 -> 본 인덱스 (없으면 -1)
+    // FName 비교는 대소문자를 무시하므로 표시 문자열 기준으로 대소문자를 구분해 찾음
+    int32 FindBoneIndex(const FName& BoneName) const;
+
+    // 본 계층이 바뀐 뒤 호출 (SetRoot/복제 시 자동 호출)
+    void RebuildBoneArray();
+
 private:
     UBone* Root{};
 
+    TArray<UBone*> Bones;
+    TArray<int32> ParentIndices;
+    TMap<FString, int32> BoneNameToIndex;
+
     // Helper: 재귀적으로 Bone 트리 순회
     template<typename Func>
     void ForEachBoneRecursive(UBone* InBone, Func&& InFunc);
@@ -0,0 +1,93 @@
+﻿#include "pch.h"
+#include "FrameArena.h"
+#include <malloc.h>
+
+FFrameArena& FFrameArena::Get()
+{
+	static FFrameArena Instance;
+	return Instance;
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (FBlock& Block : Blocks)
+	{
+		_aligned_free(Block.Data);
+	}
+	Blocks.clear();
+}
+
+SIZE_T FFrameArena::GetCapacityBytes() const
+{
+	SIZE_T Total = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		Total += Block.Size;
+	}
+	return Total;
+}
+
+void FFrameArena::AddBlock(SIZE_T MinSize)
+{
+	FBlock Block;
+	Block.Size = std::max(MinSize, DefaultBlockSize);
+	Block.Data = static_cast<uint8*>(_aligned_malloc(Block.Size, 64));
+	Blocks.Add(Block);
+	CurrentBlock = Blocks.Num() - 1;
+	CurrentOffset = 0;
+}
+
+void* FFrameArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	if (Size == 0)
+	{
+		Size = 1;
+	}
+
+	// 현재 블록에 들어가면 오프셋만 밀고, 아니면 다음 블록(없으면 새 블록)으로
+	while (true)
+	{
+		if (CurrentBlock >= 0)
+		{
+			FBlock& Block = Blocks[CurrentBlock];
+			const SIZE_T AlignedOffset = (CurrentOffset + Alignment - 1) & ~(Alignment - 1);
+			if (AlignedOffset + Size <= Block.Size)
+			{
+				CurrentOffset = AlignedOffset + Size;
+				UsedBytes += Size;
+				return Block.Data + AlignedOffset;
+			}
+		}
+
+		if (CurrentBlock + 1 < Blocks.Num())
+		{
+			++CurrentBlock;
+			CurrentOffset = 0;
+		}
+		else
+		{
+			AddBlock(Size + Alignment);
+		}
+	}
+}
+
+void FFrameArena::Reset()
+{
+	PeakBytes = std::max(PeakBytes, UsedBytes);
+
+	// 이번 프레임에 블록이 여러 개 필요했다면 최대 사용량을 담는 블록 하나로 합침
+	if (Blocks.Num() > 1)
+	{
+		const SIZE_T Capacity = GetCapacityBytes();
+		for (FBlock& Block : Blocks)
+		{
+			_aligned_free(Block.Data);
+		}
+		Blocks.clear();
+		AddBlock(std::max(Capacity, PeakBytes));
+	}
+
+	CurrentBlock = Blocks.IsEmpty() ? -1 : 0;
+	CurrentOffset = 0;
+	UsedBytes = 0;
+}
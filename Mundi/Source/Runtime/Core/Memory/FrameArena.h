@@ -0,0 +1,71 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// ─────────────────────────────────────────────
+// FFrameArena
+//  - 한 프레임 동안만 쓰는 임시 메모리를 포인터 증가만으로 할당하는 선형 할당기
+//  - 개별 해제는 없고, URenderer::EndFrame에서 Reset()으로 한꺼번에 되돌림
+//  - 블록이 모자라면 새 블록을 잇고, Reset 때 전체 크기의 블록 하나로 합쳐서 다음 프레임부터는 한 블록으로 처리
+//  - 스레드 안전하지 않음: 게임/렌더 스레드(메인 스레드)에서만 사용
+// ─────────────────────────────────────────────
+class FFrameArena
+{
+public:
+	static FFrameArena& Get();
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	void Reset();
+
+	SIZE_T GetUsedBytes() const { return UsedBytes; }
+	SIZE_T GetCapacityBytes() const;
+
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+private:
+	FFrameArena() = default;
+	~FFrameArena();
+
+	struct FBlock
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+	};
+
+	void AddBlock(SIZE_T MinSize);
+
+	static constexpr SIZE_T DefaultBlockSize = 256 * 1024;
+
+	TArray<FBlock> Blocks;
+	int32 CurrentBlock = -1;
+	SIZE_T CurrentOffset = 0;
+	SIZE_T UsedBytes = 0;
+	SIZE_T PeakBytes = 0;
+};
+
+// TArray<T, TFrameAllocator<T>>용 STL 할당기 (deallocate는 아무것도 하지 않음)
+template<typename T>
+struct TFrameAllocator
+{
+	using value_type = T;
+
+	TFrameAllocator() = default;
+	template<typename U>
+	TFrameAllocator(const TFrameAllocator<U>&) {}
+
+	T* allocate(size_t Count)
+	{
+		return static_cast<T*>(FFrameArena::Get().Allocate(Count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, size_t) {}
+
+	template<typename U>
+	bool operator==(const TFrameAllocator<U>&) const { return true; }
+	template<typename U>
+	bool operator!=(const TFrameAllocator<U>&) const { return false; }
+};
+
+// 프레임 안에서만 살아야 하는 지역 임시 배열 (멤버나 다음 프레임까지 들고 가면 안 됨)
+template<typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
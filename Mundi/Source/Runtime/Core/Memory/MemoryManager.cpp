@@ -1,30 +1,341 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
 #include <cstddef>
-#include <malloc.h>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+namespace
+{
+	constexpr SIZE_T HeaderSize = 16;
+#if MUNDI_MEMORY_GUARD
+	constexpr SIZE_T GuardSize = 16;
+#else
+	constexpr SIZE_T GuardSize = 0;
+#endif
+	constexpr SIZE_T SlabSize = 64 * 1024;
+	constexpr SIZE_T SlabAlignment = 64;
+
+	constexpr uint16 LiveMagic = 0xA11C;
+	constexpr uint16 FreeMagic = 0xF5EE;
+	constexpr uint8 GuardByte = 0xFD;
+	constexpr uint8 FreedByte = 0xDD;
+
+	// 블록 크기(헤더 + 요청 + 가드)는 모두 16의 배수 → 사용자 포인터는 항상 16바이트 정렬
+	// 인접 클래스 간격을 12~25%로 두어 올림 낭비를 제한
+	constexpr SIZE_T BucketBlockSizes[] = {
+		32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024,
+		1280, 1536, 1792, 2048,
+		2560, 3072, 3584, 4096 };
+	constexpr int32 NumBuckets = static_cast<int32>(sizeof(BucketBlockSizes) / sizeof(BucketBlockSizes[0]));
+	constexpr SIZE_T MaxPooledBlockSize = BucketBlockSizes[NumBuckets - 1];
+	constexpr uint16 LargeBucket = static_cast<uint16>(NumBuckets);   // 통계 배열의 마지막 칸
+
+	// 사용자 포인터 바로 앞 16바이트. 해제된 풀 블록에서는 RequestedSize 자리를 Next로 씀
+	struct FBlockHeader
+	{
+		union
+		{
+			uint64 RequestedSize;
+			FBlockHeader* Next;
+		};
+		uint16 Bucket;
+		uint16 Magic;
+		uint32 RawOffset;   // 대형 블록: malloc 포인터에서 헤더까지의 거리
+	};
+	static_assert(sizeof(FBlockHeader) == HeaderSize, "FBlockHeader must stay 16 bytes to keep user pointers aligned");
+
+	struct FBucket
+	{
+		std::mutex Mutex;
+		FBlockHeader* FreeHead = nullptr;   // 스레드 캐시 밖의 빈 블록
+
+		std::atomic<uint64> LiveCount{ 0 };
+		std::atomic<uint64> PeakCount{ 0 };
+		std::atomic<uint64> TotalAllocs{ 0 };
+		std::atomic<uint64> RequestedBytes{ 0 };
+		std::atomic<uint64> ReservedBytes{ 0 };
+	};
+
+	struct FPoolState
+	{
+		FBucket Buckets[NumBuckets + 1];   // + 대형 할당
+
+		std::atomic<uint64> LiveBytes{ 0 };
+		std::atomic<uint64> PeakBytes{ 0 };
+
+		// 카운터 생성과 통계 순회만 잠금 (증감은 UClass::MemoryCounters로 직접)
+		std::mutex ClassMutex;
+		TArray<std::unique_ptr<FMemoryClassCounters>> Classes;
+
+		// 블록 크기 / 16 → 버킷 인덱스
+		uint8 BucketLookup[MaxPooledBlockSize / 16 + 1] = {};
+
+		FPoolState()
+		{
+			int32 Bucket = 0;
+			for (SIZE_T Slot = 0; Slot <= MaxPooledBlockSize / 16; ++Slot)
+			{
+				while (BucketBlockSizes[Bucket] < Slot * 16)
+				{
+					++Bucket;
+				}
+				BucketLookup[Slot] = static_cast<uint8>(Bucket);
+			}
+		}
+	};
+
+	// 정적 소멸 이후에도 UObject가 해제될 수 있으므로 일부러 해제하지 않음
+	FPoolState& GetState()
+	{
+		static FPoolState* State = new FPoolState();
+		return *State;
+	}
+
+	// 스레드별 빈 블록 캐시. 잠금 없이 할당/해제하고, 모자라거나 넘칠 때만 전역 버킷과 묶음으로 교환
+	struct FThreadCache
+	{
+		FBlockHeader* Heads[NumBuckets] = {};
+		uint32 Counts[NumBuckets] = {};
+
+		~FThreadCache();
+	};
+	thread_local FThreadCache GThreadCache;
+	// 스레드 종료 중 GThreadCache가 소멸된 뒤에 오는 할당/해제(다른 thread_local 소멸자 등)는 캐시를 건드리지 않고 전역 버킷으로 직접 처리
+	// (사소한 타입이라 소멸되지 않으므로 스레드가 끝날 때까지 안전하게 읽을 수 있음)
+	thread_local bool GThreadCacheTornDown = false;
+
+	// 한 번에 전역 버킷과 주고받을 블록 수 (약 16KB 분량)
+	uint32 GetBatchCount(int32 Bucket)
+	{
+		return static_cast<uint32>(std::clamp<SIZE_T>(16 * 1024 / BucketBlockSizes[Bucket], 4, 64));
+	}
+
+	void UpdatePeak(std::atomic<uint64>& Peak, uint64 Value)
+	{
+		uint64 Prev = Peak.load(std::memory_order_relaxed);
+		while (Value > Prev && !Peak.compare_exchange_weak(Prev, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	// 버킷 잠금을 잡은 상태에서 호출. 새 슬랩을 블록으로 잘라 FreeHead에 연결
+	void AddSlab(FPoolState& State, int32 Bucket)
+	{
+		const SIZE_T BlockSize = BucketBlockSizes[Bucket];
+		uint8* Slab = static_cast<uint8*>(::operator new(SlabSize, std::align_val_t(SlabAlignment)));
+
+		FBucket& Pool = State.Buckets[Bucket];
+		const SIZE_T NumBlocks = SlabSize / BlockSize;
+		for (SIZE_T i = NumBlocks; i-- > 0;)
+		{
+			FBlockHeader* Header = reinterpret_cast<FBlockHeader*>(Slab + i * BlockSize);
+			Header->Next = Pool.FreeHead;
+			Header->Bucket = static_cast<uint16>(Bucket);
+			Header->Magic = FreeMagic;
+			Header->RawOffset = 0;
+			Pool.FreeHead = Header;
+		}
+		Pool.ReservedBytes.fetch_add(SlabSize, std::memory_order_relaxed);
+	}
+
+	void RefillThreadCache(FThreadCache& Cache, int32 Bucket)
+	{
+		FPoolState& State = GetState();
+		FBucket& Pool = State.Buckets[Bucket];
+		const uint32 Batch = GetBatchCount(Bucket);
+
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		for (uint32 i = 0; i < Batch; ++i)
+		{
+			if (!Pool.FreeHead)
+			{
+				AddSlab(State, Bucket);
+			}
+			FBlockHeader* Header = Pool.FreeHead;
+			Pool.FreeHead = Header->Next;
+			Header->Next = Cache.Heads[Bucket];
+			Cache.Heads[Bucket] = Header;
+			++Cache.Counts[Bucket];
+		}
+	}
+
+	// 캐시에서 Count개를 떼어 전역 버킷으로 반환
+	void ReleaseFromThreadCache(FThreadCache& Cache, int32 Bucket, uint32 Count)
+	{
+		if (Count == 0)
+		{
+			return;
+		}
+
+		FBlockHeader* First = Cache.Heads[Bucket];
+		FBlockHeader* Last = First;
+		for (uint32 i = 1; i < Count; ++i)
+		{
+			Last = Last->Next;
+		}
+		Cache.Heads[Bucket] = Last->Next;
+		Cache.Counts[Bucket] -= Count;
+
+		FBucket& Pool = GetState().Buckets[Bucket];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Last->Next = Pool.FreeHead;
+		Pool.FreeHead = First;
+	}
+
+	// 스레드 캐시 없이 전역 버킷에서 한 블록을 꺼냄 (GThreadCacheTornDown 이후 경로)
+	FBlockHeader* AllocateFromGlobal(FPoolState& State, int32 Bucket)
+	{
+		FBucket& Pool = State.Buckets[Bucket];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		if (!Pool.FreeHead)
+		{
+			AddSlab(State, Bucket);
+		}
+		FBlockHeader* Header = Pool.FreeHead;
+		Pool.FreeHead = Header->Next;
+		return Header;
+	}
+
+	// 스레드 캐시 없이 전역 버킷으로 한 블록을 반환 (GThreadCacheTornDown 이후 경로)
+	void FreeToGlobal(FPoolState& State, FBlockHeader* Header, int32 Bucket)
+	{
+		FBucket& Pool = State.Buckets[Bucket];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Header->Next = Pool.FreeHead;
+		Pool.FreeHead = Header;
+	}
+
+	FThreadCache::~FThreadCache()
+	{
+		GThreadCacheTornDown = true;
+
+		// 스레드 종료 시 남은 블록을 다른 스레드가 쓸 수 있도록 반환
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			ReleaseFromThreadCache(*this, Bucket, Counts[Bucket]);
+		}
+	}
+
+	void RecordAllocation(FPoolState& State, uint16 Bucket, uint64 Size, uint64 Reserved)
+	{
+		FBucket& Pool = State.Buckets[Bucket];
+		UpdatePeak(Pool.PeakCount, Pool.LiveCount.fetch_add(1, std::memory_order_relaxed) + 1);
+		Pool.TotalAllocs.fetch_add(1, std::memory_order_relaxed);
+		Pool.RequestedBytes.fetch_add(Size, std::memory_order_relaxed);
+		if (Reserved)
+		{
+			Pool.ReservedBytes.fetch_add(Reserved, std::memory_order_relaxed);
+		}
+		UpdatePeak(State.PeakBytes, State.LiveBytes.fetch_add(Size, std::memory_order_relaxed) + Size);
+	}
+
+	void RecordFree(FPoolState& State, uint16 Bucket, uint64 Size, uint64 Reserved)
+	{
+		FBucket& Pool = State.Buckets[Bucket];
+		Pool.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+		Pool.RequestedBytes.fetch_sub(Size, std::memory_order_relaxed);
+		if (Reserved)
+		{
+			Pool.ReservedBytes.fetch_sub(Reserved, std::memory_order_relaxed);
+		}
+		State.LiveBytes.fetch_sub(Size, std::memory_order_relaxed);
+	}
+
+	// 대형 블록이 malloc에서 실제로 차지하는 바이트 (헤더 앞 정렬 여백 + 헤더 + 요청 + 가드)
+	uint64 GetLargeReservedBytes(const FBlockHeader* Header)
+	{
+		return Header->RawOffset + HeaderSize + Header->RequestedSize + GuardSize;
+	}
+
+#if MUNDI_MEMORY_GUARD
+	void WriteGuard(FBlockHeader* Header)
+	{
+		std::memset(reinterpret_cast<uint8*>(Header + 1) + Header->RequestedSize, GuardByte, GuardSize);
+	}
+
+	bool CheckGuard(const FBlockHeader* Header)
+	{
+		const uint8* Guard = reinterpret_cast<const uint8*>(Header + 1) + Header->RequestedSize;
+		for (SIZE_T i = 0; i < GuardSize; ++i)
+		{
+			if (Guard[i] != GuardByte)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+#endif
+
+	void* AllocateLarge(SIZE_T Size, SIZE_T Alignment)
+	{
+		const SIZE_T FinalAlignment = std::max(Alignment, HeaderSize);
+		uint8* Raw = static_cast<uint8*>(std::malloc(Size + FinalAlignment + HeaderSize + GuardSize));
+		if (!Raw)
+		{
+			return nullptr;
+		}
+
+		const uintptr_t User = (reinterpret_cast<uintptr_t>(Raw) + HeaderSize + FinalAlignment - 1) & ~(static_cast<uintptr_t>(FinalAlignment) - 1);
+		FBlockHeader* Header = reinterpret_cast<FBlockHeader*>(User) - 1;
+		Header->RequestedSize = Size;
+		Header->Bucket = LargeBucket;
+		Header->Magic = LiveMagic;
+		Header->RawOffset = static_cast<uint32>(reinterpret_cast<uint8*>(Header) - Raw);
+#if MUNDI_MEMORY_GUARD
+		WriteGuard(Header);
+#endif
+
+		RecordAllocation(GetState(), LargeBucket, Size, GetLargeReservedBytes(Header));
+		return reinterpret_cast<void*>(User);
+	}
+}
 
 void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// 헤더가 16바이트라 사용자 포인터는 16바이트 정렬까지만 보장 → 그 이상은 대형 경로에서 직접 맞춤
+	const SIZE_T BlockSize = HeaderSize + Size + GuardSize;
+	if (Alignment > HeaderSize || BlockSize > MaxPooledBlockSize)
+	{
+		return AllocateLarge(Size, Alignment);
+	}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
-#else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
-#endif
-	if (!Raw)
-		return nullptr;
+	FPoolState& State = GetState();
+	const int32 Bucket = State.BucketLookup[(BlockSize + 15) / 16];
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	FBlockHeader* Header = nullptr;
+	if (GThreadCacheTornDown)
+	{
+		Header = AllocateFromGlobal(State, Bucket);
+	}
+	else
+	{
+		FThreadCache& Cache = GThreadCache;
+		if (!Cache.Heads[Bucket])
+		{
+			RefillThreadCache(Cache, Bucket);
+		}
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+		Header = Cache.Heads[Bucket];
+		Cache.Heads[Bucket] = Header->Next;
+		--Cache.Counts[Bucket];
+	}
+
+	Header->RequestedSize = Size;
+	Header->Magic = LiveMagic;
+#if MUNDI_MEMORY_GUARD
+	WriteGuard(Header);
+#endif
+
+	RecordAllocation(State, static_cast<uint16>(Bucket), Size, 0);
+	return Header + 1;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +343,207 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
-
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	FBlockHeader* Header = static_cast<FBlockHeader*>(Ptr) - 1;
+	if (Header->Magic != LiveMagic)
+	{
+		// 이중 해제이거나 이 할당기가 준 포인터가 아님 - 풀 목록을 망가뜨리지 않도록 무시
+		UE_LOG("FMemoryManager: invalid or double free of %p (magic 0x%04X)", Ptr, Header->Magic);
+		assert(false && "FMemoryManager: invalid or double free");
+		return;
+	}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
+#if MUNDI_MEMORY_GUARD
+	if (!CheckGuard(Header))
+	{
+		UE_LOG("FMemoryManager: buffer overrun detected past %p (%llu bytes)", Ptr, static_cast<unsigned long long>(Header->RequestedSize));
+		assert(false && "FMemoryManager: guard bytes overwritten");
+	}
+	std::memset(Ptr, FreedByte, static_cast<SIZE_T>(Header->RequestedSize));
 #endif
-}
\ No newline at end of file
+
+	FPoolState& State = GetState();
+	const uint16 Bucket = Header->Bucket;
+	Header->Magic = FreeMagic;
+
+	if (Bucket == LargeBucket)
+	{
+		RecordFree(State, Bucket, Header->RequestedSize, GetLargeReservedBytes(Header));
+		std::free(reinterpret_cast<uint8*>(Header) - Header->RawOffset);
+		return;
+	}
+
+	RecordFree(State, Bucket, Header->RequestedSize, 0);
+
+	if (GThreadCacheTornDown)
+	{
+		FreeToGlobal(State, Header, Bucket);
+		return;
+	}
+
+	FThreadCache& Cache = GThreadCache;
+	Header->Next = Cache.Heads[Bucket];
+	Cache.Heads[Bucket] = Header;
+
+	// 한 스레드에서만 해제가 몰리면 캐시가 무한히 커지지 않도록 절반을 전역으로 반환
+	const uint32 Batch = GetBatchCount(Bucket);
+	if (++Cache.Counts[Bucket] > Batch * 2)
+	{
+		ReleaseFromThreadCache(Cache, Bucket, Batch);
+	}
+}
+
+void FMemoryManager::TrackObjectAllocated(const UClass* Class)
+{
+	if (!Class)
+		return;
+
+	FMemoryClassCounters* Counters = Class->MemoryCounters;
+	if (!Counters)
+	{
+		// 클래스의 첫 객체: 카운터를 만들어 UClass에 연결 (객체 등록은 Class->Instances를 갱신하는 스레드에서만 일어남)
+		FPoolState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.ClassMutex);
+		std::unique_ptr<FMemoryClassCounters> NewCounters = std::make_unique<FMemoryClassCounters>();
+		NewCounters->Class = Class;
+		Counters = NewCounters.get();
+		State.Classes.push_back(std::move(NewCounters));
+		Class->MemoryCounters = Counters;
+	}
+	UpdatePeak(Counters->PeakCount, Counters->LiveCount.fetch_add(1, std::memory_order_relaxed) + 1);
+}
+
+void FMemoryManager::TrackObjectFreed(const UClass* Class)
+{
+	if (!Class)
+		return;
+
+	if (FMemoryClassCounters* Counters = Class->MemoryCounters)
+	{
+		Counters->LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	return GetState().LiveBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	uint64 Count = 0;
+	for (const FBucket& Pool : GetState().Buckets)
+	{
+		Count += Pool.LiveCount.load(std::memory_order_relaxed);
+	}
+	return Count;
+}
+
+uint64 FMemoryManager::GetPeakAllocationBytes()
+{
+	return GetState().PeakBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetReservedBytes()
+{
+	uint64 Reserved = 0;
+	for (const FBucket& Pool : GetState().Buckets)
+	{
+		Reserved += Pool.ReservedBytes.load(std::memory_order_relaxed);
+	}
+	return Reserved;
+}
+
+double FMemoryManager::GetFragmentation()
+{
+	const uint64 Reserved = GetReservedBytes();
+	if (Reserved == 0)
+	{
+		return 0.0;
+	}
+	return 1.0 - static_cast<double>(GetTotalAllocationBytes()) / static_cast<double>(Reserved);
+}
+
+void FMemoryManager::GetBucketStats(TArray<FMemoryBucketStats>& OutStats)
+{
+	OutStats.clear();
+	const FPoolState& State = GetState();
+	for (int32 Bucket = 0; Bucket <= NumBuckets; ++Bucket)
+	{
+		const FBucket& Pool = State.Buckets[Bucket];
+		FMemoryBucketStats Stats;
+		Stats.BlockSize = Bucket < NumBuckets ? BucketBlockSizes[Bucket] : 0;
+		Stats.LiveCount = Pool.LiveCount.load(std::memory_order_relaxed);
+		Stats.PeakCount = Pool.PeakCount.load(std::memory_order_relaxed);
+		Stats.TotalAllocs = Pool.TotalAllocs.load(std::memory_order_relaxed);
+		Stats.RequestedBytes = Pool.RequestedBytes.load(std::memory_order_relaxed);
+		Stats.ReservedBytes = Pool.ReservedBytes.load(std::memory_order_relaxed);
+		OutStats.Add(Stats);
+	}
+}
+
+void FMemoryManager::GetClassStats(TArray<FMemoryClassStats>& OutStats)
+{
+	OutStats.clear();
+	FPoolState& State = GetState();
+	std::lock_guard<std::mutex> Lock(State.ClassMutex);
+	for (const std::unique_ptr<FMemoryClassCounters>& Counters : State.Classes)
+	{
+		FMemoryClassStats Stats;
+		Stats.Class = Counters->Class;
+		Stats.LiveCount = Counters->LiveCount.load(std::memory_order_relaxed);
+		Stats.PeakCount = Counters->PeakCount.load(std::memory_order_relaxed);
+		Stats.LiveBytes = Stats.LiveCount * Counters->Class->Size;
+		Stats.PeakBytes = Stats.PeakCount * Counters->Class->Size;
+		OutStats.Add(Stats);
+	}
+}
+
+void FMemoryManager::LogReport()
+{
+	constexpr double ToMB = 1.0 / (1024.0 * 1024.0);
+
+	UE_LOG("Memory: live %.2f MB (%llu allocs), peak %.2f MB, reserved %.2f MB, fragmentation %.1f%%",
+		GetTotalAllocationBytes() * ToMB, static_cast<unsigned long long>(GetTotalAllocationCount()),
+		GetPeakAllocationBytes() * ToMB, GetReservedBytes() * ToMB, GetFragmentation() * 100.0);
+
+	TArray<FMemoryBucketStats> Buckets;
+	GetBucketStats(Buckets);
+	UE_LOG("  Block   Live    Peak    Total     Requested KB  Reserved KB  Frag");
+	for (const FMemoryBucketStats& Stats : Buckets)
+	{
+		if (Stats.TotalAllocs == 0)
+		{
+			continue;
+		}
+		const double Frag = Stats.ReservedBytes ? 100.0 * (1.0 - static_cast<double>(Stats.RequestedBytes) / Stats.ReservedBytes) : 0.0;
+		if (Stats.BlockSize)
+		{
+			UE_LOG("  %5llu  %6llu  %6llu  %8llu  %12.1f  %11.1f  %5.1f%%",
+				static_cast<unsigned long long>(Stats.BlockSize), static_cast<unsigned long long>(Stats.LiveCount),
+				static_cast<unsigned long long>(Stats.PeakCount), static_cast<unsigned long long>(Stats.TotalAllocs),
+				Stats.RequestedBytes / 1024.0, Stats.ReservedBytes / 1024.0, Frag);
+		}
+		else
+		{
+			UE_LOG("  large  %6llu  %6llu  %8llu  %12.1f  %11.1f  %5.1f%%",
+				static_cast<unsigned long long>(Stats.LiveCount), static_cast<unsigned long long>(Stats.PeakCount),
+				static_cast<unsigned long long>(Stats.TotalAllocs), Stats.RequestedBytes / 1024.0, Stats.ReservedBytes / 1024.0, Frag);
+		}
+	}
+
+	// 최대치가 큰 UClass 상위 목록
+	TArray<FMemoryClassStats> Classes;
+	GetClassStats(Classes);
+	std::sort(Classes.begin(), Classes.end(), [](const FMemoryClassStats& A, const FMemoryClassStats& B)
+	{
+		return A.PeakBytes > B.PeakBytes;
+	});
+	UE_LOG("  Class                              Live     Peak   Peak KB");
+	const int32 NumShown = std::min(Classes.Num(), 20);
+	for (int32 i = 0; i < NumShown; ++i)
+	{
+		const FMemoryClassStats& Stats = Classes[i];
+		UE_LOG("  %-32s %7llu  %7llu  %8.1f", Stats.Class->Name,
+			static_cast<unsigned long long>(Stats.LiveCount), static_cast<unsigned long long>(Stats.PeakCount), Stats.PeakBytes / 1024.0);
+	}
+}
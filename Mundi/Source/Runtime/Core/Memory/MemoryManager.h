@@ -1,7 +1,56 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+struct UClass;
+
+// 1이면 블록 앞 헤더 매직/뒤 가드 바이트를 해제 시 검사하고, 해제된 메모리를 0xDD로 채움
+#ifndef MUNDI_MEMORY_GUARD
+#if defined(_DEBUG)
+#define MUNDI_MEMORY_GUARD 1
+#else
+#define MUNDI_MEMORY_GUARD 0
+#endif
+#endif
+
+// 크기 버킷 하나의 통계 스냅샷 (BlockSize == 0은 풀 밖의 대형/고정렬 할당)
+struct FMemoryBucketStats
+{
+	SIZE_T BlockSize = 0;
+	uint64 LiveCount = 0;
+	uint64 PeakCount = 0;
+	uint64 TotalAllocs = 0;
+	uint64 RequestedBytes = 0;   // 살아 있는 블록의 요청 크기 합
+	uint64 ReservedBytes = 0;    // 이 버킷이 확보한 슬랩 바이트 (대형은 실제 할당 크기)
+};
+
+// UClass 하나의 통계 스냅샷 (ObjectFactory로 등록된 객체 기준)
+struct FMemoryClassStats
+{
+	const UClass* Class = nullptr;
+	uint64 LiveCount = 0;
+	uint64 PeakCount = 0;
+	uint64 LiveBytes = 0;
+	uint64 PeakBytes = 0;
+};
+
+// UClass 하나의 실시간 카운터 (처음 등록될 때 FMemoryManager가 만들어 UClass::MemoryCounters에 연결)
+struct FMemoryClassCounters
+{
+	const UClass* Class = nullptr;
+	std::atomic<uint64> LiveCount{ 0 };
+	std::atomic<uint64> PeakCount{ 0 };
+};
+
+// ─────────────────────────────────────────────
+// FMemoryManager
+//  - UObject::operator new/delete의 백엔드
+//  - 작은 블록(4KB 이하)은 크기 클래스별 64KB 슬랩에서 잘라 쓰고, 해제된 블록은 스레드별 캐시에 모았다가 재사용
+//  - 스레드 캐시가 비거나 넘치면 묶음 단위로 전역 풀(버킷별 뮤텍스)과 주고받음
+//  - 큰 블록과 16바이트 초과 정렬은 malloc으로 바로 처리
+//  - 통계는 버킷별 64비트 원자 카운터 (스레드 안전)
+// ─────────────────────────────────────────────
 class FMemoryManager
 {
 public:
@@ -9,7 +58,21 @@ public:
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
-public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	// UClass별 통계 (ObjectFactory가 GUObjectArray 등록/삭제 시 호출)
+	// 카운터는 UClass에 붙어 있어 클래스의 첫 객체 이후로는 원자 연산 한 번
+	static void TrackObjectAllocated(const UClass* Class);
+	static void TrackObjectFreed(const UClass* Class);
+
+	// 전체 통계
+	static uint64 GetTotalAllocationBytes();   // 살아 있는 블록의 요청 크기 합
+	static uint64 GetTotalAllocationCount();
+	static uint64 GetPeakAllocationBytes();
+	static uint64 GetReservedBytes();          // 슬랩 + 대형 블록으로 확보한 바이트
+	static double GetFragmentation();          // 1 - 요청 / 확보 (헤더, 크기 클래스 올림, 빈 슬랩 블록 포함)
+
+	static void GetBucketStats(TArray<FMemoryBucketStats>& OutStats);
+	static void GetClassStats(TArray<FMemoryClassStats>& OutStats);
+
+	// 버킷/UClass 통계를 콘솔에 출력 (콘솔 "MEMORY REPORT")
+	static void LogReport();
+};
@@ -15,6 +15,10 @@ public:
     virtual size_t Tell() const = 0;*/
     virtual bool Close() = 0;
 
+    // 메모리 매핑처럼 원본 바이트가 이미 메모리에 있는 아카이브는 현재 위치의 Length 바이트를
+    // 가리키는 포인터를 반환하고 위치를 전진시킴 (복사 없이 읽기). 지원하지 않으면 nullptr
+    virtual const uint8* ReadView(int64 Length) { return nullptr; }
+
     // 상태 확인 함수
     bool IsLoading() const { return bIsLoading; }
     bool IsSaving() const { return bIsSaving; }
@@ -55,6 +59,12 @@ namespace Serialization
             throw std::runtime_error("Cache corrupt: String length is unreasonable.");
         }
 
+        if (const uint8* View = Ar.ReadView(Len))
+        {
+            Str.assign(reinterpret_cast<const char*>(View), Len);
+            return;
+        }
+
         Str.resize(Len);
         if (Len > 0)
             Ar.Serialize(&Str[0], Len);
@@ -83,6 +93,11 @@ namespace Serialization
 
         Arr.resize(Count);
         if (Count > 0)
-            Ar.Serialize((void*)Arr.data(), sizeof(T) * Count);
+        {
+            if (const uint8* View = Ar.ReadView(sizeof(T) * Count))
+                memcpy(Arr.data(), View, sizeof(T) * Count);
+            else
+                Ar.Serialize((void*)Arr.data(), sizeof(T) * Count);
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,798 @@
+﻿#include "pch.h"
+#include "BinarySerializer.h"
+#include "Archive.h"
+#include "WindowsMappedReader.h"
+#include <charconv>
+
+namespace
+{
+	constexpr uint32 BinaryMagic = 0x4E49424D; // "MBIN"
+	constexpr uint32 BinaryVersion = 1;
+
+	struct FBinaryFileHeader
+	{
+		uint32 Magic = BinaryMagic;
+		uint32 Version = BinaryVersion;
+		uint32 NumClasses = 0;
+		uint32 NumRecords = 0;
+		uint64 SchemaBytes = 0;
+		uint64 RecordBytes = 0;
+		uint64 SkeletonBytes = 0;
+	};
+
+	// TArray<uint8> 뒤에 이어 쓰는 아카이브
+	class FMemoryWriter : public FArchive
+	{
+	public:
+		explicit FMemoryWriter(TArray<uint8>& InBytes) : FArchive(false, true), Bytes(InBytes) {}
+
+		void Serialize(void* Data, int64 Length) override
+		{
+			const uint8* Source = static_cast<const uint8*>(Data);
+			Bytes.insert(Bytes.end(), Source, Source + Length);
+		}
+		bool Close() override { return true; }
+
+	private:
+		TArray<uint8>& Bytes;
+	};
+
+	// 메모리 구간을 읽는 아카이브 (레코드 하나, 매핑된 파일의 일부)
+	class FMemoryReader : public FArchive
+	{
+	public:
+		FMemoryReader(const uint8* InData, int64 InSize) : FArchive(true, false), Data(InData), Size(InSize) {}
+
+		void Serialize(void* OutData, int64 Length) override
+		{
+			const uint8* View = ReadView(Length);
+			if (Length > 0)
+				memcpy(OutData, View, static_cast<size_t>(Length));
+		}
+
+		const uint8* ReadView(int64 Length) override
+		{
+			if (Length < 0 || Length > Size - Position)
+			{
+				throw std::runtime_error("Binary file corrupt: Unexpected end of record.");
+			}
+			const uint8* View = Data + Position;
+			Position += Length;
+			return View;
+		}
+		bool Close() override { return true; }
+
+	private:
+		const uint8* Data = nullptr;
+		int64 Size = 0;
+		int64 Position = 0;
+	};
+
+	// JSON 경로(UObject::Serialize)가 처리하는 타입만 레코드에 기록
+	bool IsBinaryProperty(const FProperty& Prop)
+	{
+		switch (Prop.Type)
+		{
+		case EPropertyType::Bool:
+		case EPropertyType::Int32:
+		case EPropertyType::Float:
+		case EPropertyType::FVector:
+		case EPropertyType::FLinearColor:
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+		case EPropertyType::FName:
+		case EPropertyType::Texture:
+		case EPropertyType::StaticMesh:
+		case EPropertyType::SkeletalMesh:
+		case EPropertyType::Material:
+		case EPropertyType::Curve:
+			return true;
+		case EPropertyType::Array:
+			return Prop.InnerType == EPropertyType::Int32 || Prop.InnerType == EPropertyType::Float
+				|| Prop.InnerType == EPropertyType::Bool || Prop.InnerType == EPropertyType::FString
+				|| Prop.InnerType == EPropertyType::Sound;
+		default:
+			return false;
+		}
+	}
+
+	uint64 HashBytes(uint64 Hash, const void* Data, SIZE_T Size)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (SIZE_T i = 0; i < Size; ++i)
+		{
+			Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+		}
+		return Hash;
+	}
+
+	// 현재 클래스의 레코드 레이아웃 (GetAllProperties 순서 중 바이너리 대상만)
+	struct FClassSchema
+	{
+		TArray<const FProperty*> Properties;
+		uint64 Hash = 0;
+	};
+
+	const FClassSchema& GetClassSchema(const UClass* Class)
+	{
+		// 프로퍼티 테이블은 클래스 등록 이후 바뀌지 않으므로 한 번만 만듦
+		static TMap<const UClass*, FClassSchema> Schemas;
+		if (const FClassSchema* Found = Schemas.Find(Class))
+		{
+			return *Found;
+		}
+
+		FClassSchema Schema;
+		Schema.Hash = 14695981039346656037ull;
+		for (const FProperty& Prop : Class->GetAllProperties())
+		{
+			if (!IsBinaryProperty(Prop))
+			{
+				continue;
+			}
+			Schema.Properties.Add(&Prop);
+
+			const uint64 Offset = static_cast<uint64>(Prop.Offset);
+			Schema.Hash = HashBytes(Schema.Hash, Prop.Name, std::strlen(Prop.Name) + 1);
+			Schema.Hash = HashBytes(Schema.Hash, &Prop.Type, sizeof(Prop.Type));
+			Schema.Hash = HashBytes(Schema.Hash, &Prop.InnerType, sizeof(Prop.InnerType));
+			Schema.Hash = HashBytes(Schema.Hash, &Offset, sizeof(Offset));
+		}
+		return Schemas.emplace(Class, std::move(Schema)).first->second;
+	}
+
+	//====================================================================================
+	// 값 인코딩 (타입별 고정 순서, 문자열/배열은 길이 접두)
+	//====================================================================================
+
+	void WriteArrayValue(FArchive& Ar, const UObject* Object, const FProperty& Prop)
+	{
+		switch (Prop.InnerType)
+		{
+		case EPropertyType::Int32:
+			Serialization::WriteArray(Ar, *Prop.GetValuePtr<TArray<int32>>(Object));
+			break;
+		case EPropertyType::Float:
+			Serialization::WriteArray(Ar, *Prop.GetValuePtr<TArray<float>>(Object));
+			break;
+		case EPropertyType::Bool:
+		{
+			// TArray<bool>은 비트 압축 vector라 원소 단위로 기록
+			const TArray<bool>& Values = *Prop.GetValuePtr<TArray<bool>>(Object);
+			uint32 Count = static_cast<uint32>(Values.size());
+			Ar << Count;
+			for (bool bValue : Values)
+			{
+				uint8 Byte = bValue ? 1 : 0;
+				Ar << Byte;
+			}
+			break;
+		}
+		case EPropertyType::FString:
+		{
+			const TArray<FString>& Values = *Prop.GetValuePtr<TArray<FString>>(Object);
+			uint32 Count = static_cast<uint32>(Values.size());
+			Ar << Count;
+			for (const FString& Value : Values)
+			{
+				Serialization::WriteString(Ar, Value);
+			}
+			break;
+		}
+		case EPropertyType::Sound:
+		{
+			const TArray<USound*>& Values = *Prop.GetValuePtr<TArray<USound*>>(Object);
+			uint32 Count = static_cast<uint32>(Values.size());
+			Ar << Count;
+			for (USound* Sound : Values)
+			{
+				Serialization::WriteString(Ar, Sound ? Sound->GetFilePath() : FString());
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void WritePropertyValue(FArchive& Ar, const UObject* Object, const FProperty& Prop)
+	{
+		switch (Prop.Type)
+		{
+		case EPropertyType::Bool:
+		{
+			uint8 Byte = *Prop.GetValuePtr<bool>(Object) ? 1 : 0;
+			Ar << Byte;
+			break;
+		}
+		case EPropertyType::Int32:
+		{
+			int32 Value = *Prop.GetValuePtr<int32>(Object);
+			Ar << Value;
+			break;
+		}
+		case EPropertyType::Float:
+		{
+			float Value = *Prop.GetValuePtr<float>(Object);
+			Ar << Value;
+			break;
+		}
+		case EPropertyType::FVector:
+		{
+			FVector Value = *Prop.GetValuePtr<FVector>(Object);
+			Ar << Value.X << Value.Y << Value.Z;
+			break;
+		}
+		case EPropertyType::FLinearColor:
+		{
+			FLinearColor Value = *Prop.GetValuePtr<FLinearColor>(Object);
+			Ar << Value.R << Value.G << Value.B << Value.A;
+			break;
+		}
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+			Serialization::WriteString(Ar, *Prop.GetValuePtr<FString>(Object));
+			break;
+		case EPropertyType::FName:
+			Serialization::WriteString(Ar, Prop.GetValuePtr<FName>(Object)->ToString());
+			break;
+		case EPropertyType::Texture:
+		{
+			UTexture* Value = *Prop.GetValuePtr<UTexture*>(Object);
+			Serialization::WriteString(Ar, Value ? Value->GetFilePath() : FString());
+			break;
+		}
+		case EPropertyType::StaticMesh:
+		{
+			UStaticMesh* Value = *Prop.GetValuePtr<UStaticMesh*>(Object);
+			Serialization::WriteString(Ar, Value ? Value->GetAssetPathFileName() : FString());
+			break;
+		}
+		case EPropertyType::SkeletalMesh:
+		{
+			USkeletalMesh* Value = *Prop.GetValuePtr<USkeletalMesh*>(Object);
+			Serialization::WriteString(Ar, Value ? Value->GetAssetPathFileName() : FString());
+			break;
+		}
+		case EPropertyType::Material:
+		{
+			UMaterial* Value = *Prop.GetValuePtr<UMaterial*>(Object);
+			Serialization::WriteString(Ar, Value ? Value->GetFilePath() : FString());
+			break;
+		}
+		case EPropertyType::Curve:
+			Ar.Serialize(const_cast<float*>(Prop.GetValuePtr<float>(Object)), sizeof(float) * 4);
+			break;
+		case EPropertyType::Array:
+			WriteArrayValue(Ar, Object, Prop);
+			break;
+		default:
+			break;
+		}
+	}
+
+	template<typename TAsset>
+	void ReadAssetValue(FArchive& Ar, UObject* Object, const FProperty* Target)
+	{
+		FString AssetPath;
+		Serialization::ReadString(Ar, AssetPath);
+		if (Target)
+		{
+			*Target->GetValuePtr<TAsset*>(Object) = AssetPath.empty() ? nullptr : UResourceManager::GetInstance().Load<TAsset>(AssetPath);
+		}
+	}
+
+	uint32 ReadArrayCount(FArchive& Ar)
+	{
+		uint32 Count;
+		Ar << Count;
+		if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Binary file corrupt: Array size is unreasonable.");
+		}
+		return Count;
+	}
+
+	// Target이 nullptr이면 값을 읽고 버림 (현재 클래스에 없는 필드)
+	void ReadArrayValue(FArchive& Ar, UObject* Object, EPropertyType InnerType, const FProperty* Target)
+	{
+		switch (InnerType)
+		{
+		case EPropertyType::Int32:
+		{
+			TArray<int32> Values;
+			Serialization::ReadArray(Ar, Values);
+			if (Target) *Target->GetValuePtr<TArray<int32>>(Object) = std::move(Values);
+			break;
+		}
+		case EPropertyType::Float:
+		{
+			TArray<float> Values;
+			Serialization::ReadArray(Ar, Values);
+			if (Target) *Target->GetValuePtr<TArray<float>>(Object) = std::move(Values);
+			break;
+		}
+		case EPropertyType::Bool:
+		{
+			const uint32 Count = ReadArrayCount(Ar);
+			const uint8* Bytes = Ar.ReadView(Count);
+			TArray<bool> Values(Count);
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				uint8 Byte = 0;
+				if (Bytes) Byte = Bytes[i];
+				else Ar << Byte;
+				Values[i] = Byte != 0;
+			}
+			if (Target) *Target->GetValuePtr<TArray<bool>>(Object) = std::move(Values);
+			break;
+		}
+		case EPropertyType::FString:
+		{
+			const uint32 Count = ReadArrayCount(Ar);
+			TArray<FString> Values(Count);
+			for (FString& Value : Values)
+			{
+				Serialization::ReadString(Ar, Value);
+			}
+			if (Target) *Target->GetValuePtr<TArray<FString>>(Object) = std::move(Values);
+			break;
+		}
+		case EPropertyType::Sound:
+		{
+			const uint32 Count = ReadArrayCount(Ar);
+			TArray<USound*>* Sounds = Target ? Target->GetValuePtr<TArray<USound*>>(Object) : nullptr;
+			if (Sounds) Sounds->Empty();
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				FString Path;
+				Serialization::ReadString(Ar, Path);
+				if (Sounds) Sounds->Add(Path.empty() ? nullptr : UResourceManager::GetInstance().Load<USound>(Path));
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void ReadPropertyValue(FArchive& Ar, UObject* Object, EPropertyType Type, EPropertyType InnerType, const FProperty* Target)
+	{
+		switch (Type)
+		{
+		case EPropertyType::Bool:
+		{
+			uint8 Byte;
+			Ar << Byte;
+			if (Target) *Target->GetValuePtr<bool>(Object) = Byte != 0;
+			break;
+		}
+		case EPropertyType::Int32:
+		{
+			int32 Value;
+			Ar << Value;
+			if (Target) *Target->GetValuePtr<int32>(Object) = Value;
+			break;
+		}
+		case EPropertyType::Float:
+		{
+			float Value;
+			Ar << Value;
+			if (Target) *Target->GetValuePtr<float>(Object) = Value;
+			break;
+		}
+		case EPropertyType::FVector:
+		{
+			FVector Value;
+			Ar << Value.X << Value.Y << Value.Z;
+			if (Target) *Target->GetValuePtr<FVector>(Object) = Value;
+			break;
+		}
+		case EPropertyType::FLinearColor:
+		{
+			FLinearColor Value;
+			Ar << Value.R << Value.G << Value.B << Value.A;
+			if (Target) *Target->GetValuePtr<FLinearColor>(Object) = Value;
+			break;
+		}
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+		{
+			FString Value;
+			Serialization::ReadString(Ar, Value);
+			if (Target) *Target->GetValuePtr<FString>(Object) = std::move(Value);
+			break;
+		}
+		case EPropertyType::FName:
+		{
+			FString Value;
+			Serialization::ReadString(Ar, Value);
+			if (Target) *Target->GetValuePtr<FName>(Object) = FName(Value);
+			break;
+		}
+		case EPropertyType::Texture:
+			ReadAssetValue<UTexture>(Ar, Object, Target);
+			break;
+		case EPropertyType::StaticMesh:
+			ReadAssetValue<UStaticMesh>(Ar, Object, Target);
+			break;
+		case EPropertyType::SkeletalMesh:
+			ReadAssetValue<USkeletalMesh>(Ar, Object, Target);
+			break;
+		case EPropertyType::Material:
+			ReadAssetValue<UMaterial>(Ar, Object, Target);
+			break;
+		case EPropertyType::Curve:
+		{
+			float Values[4];
+			Ar.Serialize(Values, sizeof(Values));
+			if (Target) memcpy(Target->GetValuePtr<float>(Object), Values, sizeof(Values));
+			break;
+		}
+		case EPropertyType::Array:
+			ReadArrayValue(Ar, Object, InnerType, Target);
+			break;
+		default:
+			throw std::runtime_error("Binary file corrupt: Unsupported property type in schema.");
+		}
+	}
+
+	//====================================================================================
+	// 저장/로드 컨텍스트 (SaveToFile/LoadFromFile 동안만 활성)
+	//====================================================================================
+
+	struct FWriteContext
+	{
+		TArray<const UClass*> Classes;
+		TMap<const UClass*, uint32> ClassIndices;
+		TArray<uint8> RecordBytes;
+		uint32 NumRecords = 0;
+	};
+
+	struct FFileProperty
+	{
+		FString Name;
+		EPropertyType Type = EPropertyType::Unknown;
+		EPropertyType InnerType = EPropertyType::Unknown;
+	};
+
+	struct FFileClass
+	{
+		FString Name;
+		uint64 Hash = 0;
+		TArray<FFileProperty> Properties;
+
+		// 파일 프로퍼티 i -> 현재 클래스의 FProperty (없거나 타입이 바뀌었으면 nullptr)
+		const UClass* MappedClass = nullptr;
+		TArray<const FProperty*> Mapping;
+	};
+
+	struct FReadContext
+	{
+		TArray<FFileClass> Classes;
+		TArray<int64> RecordOffsets;
+		const uint8* RecordData = nullptr;
+		int64 RecordSize = 0;
+	};
+
+	thread_local FWriteContext* ActiveWriteContext = nullptr;
+	thread_local FReadContext* ActiveReadContext = nullptr;
+
+	template<typename TContext>
+	struct FContextScope
+	{
+		FContextScope(TContext*& InSlot, TContext* InContext) : Slot(InSlot), Previous(InSlot) { Slot = InContext; }
+		~FContextScope() { Slot = Previous; }
+
+		TContext*& Slot;
+		TContext* Previous;
+	};
+
+	void BuildMapping(FFileClass& FileClass, const UClass* Class)
+	{
+		const FClassSchema& Schema = GetClassSchema(Class);
+		FileClass.Mapping.assign(FileClass.Properties.Num(), nullptr);
+		FileClass.MappedClass = Class;
+
+		// 스키마가 같으면 순서 그대로 대응 (일반적인 경우)
+		if (Schema.Hash == FileClass.Hash && Schema.Properties.Num() == FileClass.Properties.Num())
+		{
+			for (int32 i = 0; i < Schema.Properties.Num(); ++i)
+			{
+				FileClass.Mapping[i] = Schema.Properties[i];
+			}
+			return;
+		}
+
+		// 필드가 추가/삭제/이동된 파일: 이름과 타입이 모두 같은 필드만 대응
+		for (int32 i = 0; i < FileClass.Properties.Num(); ++i)
+		{
+			const FFileProperty& FileProperty = FileClass.Properties[i];
+			for (const FProperty* Prop : Schema.Properties)
+			{
+				if (Prop->Type == FileProperty.Type && Prop->InnerType == FileProperty.InnerType && FileProperty.Name == Prop->Name)
+				{
+					FileClass.Mapping[i] = Prop;
+					break;
+				}
+			}
+		}
+	}
+
+	// SimpleJSON의 dump()보다 작고 빠른 한 줄 출력 (골격 저장용)
+	void AppendCompactJson(const JSON& Value, FString& Out)
+	{
+		switch (Value.JSONType())
+		{
+		case JSON::Class::Object:
+		{
+			Out += '{';
+			bool bFirst = true;
+			for (const auto& Pair : Value.ObjectRange())
+			{
+				if (!bFirst) Out += ',';
+				bFirst = false;
+				Out += '"';
+				Out += Pair.first;
+				Out += "\":";
+				AppendCompactJson(Pair.second, Out);
+			}
+			Out += '}';
+			break;
+		}
+		case JSON::Class::Array:
+		{
+			Out += '[';
+			bool bFirst = true;
+			for (const JSON& Element : Value.ArrayRange())
+			{
+				if (!bFirst) Out += ',';
+				bFirst = false;
+				AppendCompactJson(Element, Out);
+			}
+			Out += ']';
+			break;
+		}
+		case JSON::Class::String:
+			// ToString()은 이스케이프된 문자열을 반환
+			Out += '"';
+			Out += Value.ToString();
+			Out += '"';
+			break;
+		case JSON::Class::Floating:
+		{
+			char Buffer[32];
+			const std::to_chars_result Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value.ToFloat());
+			const std::string_view Text(Buffer, Result.ptr - Buffer);
+			Out += Text;
+			// 정수처럼 보이면 다시 읽을 때 Integral이 되므로 소수점을 붙임
+			if (Text.find_first_of(".en") == std::string_view::npos)
+			{
+				Out += ".0";
+			}
+			break;
+		}
+		case JSON::Class::Integral:
+			Out += std::to_string(Value.ToInt());
+			break;
+		case JSON::Class::Boolean:
+			Out += Value.ToBool() ? "true" : "false";
+			break;
+		default:
+			Out += "null";
+			break;
+		}
+	}
+}
+
+bool FBinarySerializer::IsBinaryFile(const FWideString& InFilePath)
+{
+	std::ifstream File(InFilePath, std::ios::binary);
+	uint32 Magic = 0;
+	return File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic)) && Magic == BinaryMagic;
+}
+
+bool FBinarySerializer::SaveToFile(const FWideString& InFilePath, const std::function<void(JSON&)>& SerializeRoot)
+{
+	FWriteContext Context;
+	JSON Skeleton = json::Object();
+	{
+		FContextScope<FWriteContext> Scope(ActiveWriteContext, &Context);
+		SerializeRoot(Skeleton);
+	}
+
+	FString SkeletonText;
+	AppendCompactJson(Skeleton, SkeletonText);
+
+	TArray<uint8> SchemaBytes;
+	FMemoryWriter SchemaWriter(SchemaBytes);
+	for (const UClass* Class : Context.Classes)
+	{
+		const FClassSchema& Schema = GetClassSchema(Class);
+		uint64 Hash = Schema.Hash;
+		uint32 NumProperties = static_cast<uint32>(Schema.Properties.Num());
+		Serialization::WriteString(SchemaWriter, Class->Name);
+		SchemaWriter << Hash << NumProperties;
+		for (const FProperty* Prop : Schema.Properties)
+		{
+			EPropertyType Type = Prop->Type;
+			EPropertyType InnerType = Prop->InnerType;
+			Serialization::WriteString(SchemaWriter, Prop->Name);
+			SchemaWriter << Type << InnerType;
+		}
+	}
+
+	FBinaryFileHeader Header;
+	Header.NumClasses = static_cast<uint32>(Context.Classes.Num());
+	Header.NumRecords = Context.NumRecords;
+	Header.SchemaBytes = SchemaBytes.size();
+	Header.RecordBytes = Context.RecordBytes.size();
+	Header.SkeletonBytes = SkeletonText.size();
+
+	std::ofstream File(InFilePath, std::ios::binary | std::ios::trunc);
+	if (!File.is_open())
+	{
+		return false;
+	}
+	File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+	File.write(reinterpret_cast<const char*>(SchemaBytes.data()), SchemaBytes.size());
+	File.write(reinterpret_cast<const char*>(Context.RecordBytes.data()), Context.RecordBytes.size());
+	File.write(SkeletonText.data(), SkeletonText.size());
+	return File.good();
+}
+
+bool FBinarySerializer::LoadFromFile(const FWideString& InFilePath, const std::function<void(const FJsonValue&)>& LoadRoot)
+{
+	FWindowsMappedReader Reader(WideToUTF8(InFilePath));
+	if (!Reader.IsOpen())
+	{
+		return false;
+	}
+
+	try
+	{
+		FBinaryFileHeader Header;
+		Reader << Header;
+		if (Header.Magic != BinaryMagic || Header.Version != BinaryVersion)
+		{
+			UE_LOG("[error] BinarySerializer: Unsupported file version: %s", WideToUTF8(InFilePath).c_str());
+			return false;
+		}
+
+		// 1) 클래스 스키마
+		FReadContext Context;
+		Context.Classes.resize(Header.NumClasses);
+		for (FFileClass& FileClass : Context.Classes)
+		{
+			uint32 NumProperties;
+			Serialization::ReadString(Reader, FileClass.Name);
+			Reader << FileClass.Hash << NumProperties;
+			if (NumProperties > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+			{
+				throw std::runtime_error("Binary file corrupt: Schema property count is unreasonable.");
+			}
+
+			FileClass.Properties.resize(NumProperties);
+			for (FFileProperty& FileProperty : FileClass.Properties)
+			{
+				Serialization::ReadString(Reader, FileProperty.Name);
+				Reader << FileProperty.Type << FileProperty.InnerType;
+			}
+		}
+
+		// 2) 레코드 위치 테이블 (레코드는 [클래스 번호][크기][값...])
+		Context.RecordSize = static_cast<int64>(Header.RecordBytes);
+		Context.RecordData = Reader.ReadView(Context.RecordSize);
+		Context.RecordOffsets.reserve(Header.NumRecords);
+		int64 Offset = 0;
+		for (uint32 i = 0; i < Header.NumRecords; ++i)
+		{
+			if (Context.RecordSize - Offset < static_cast<int64>(sizeof(uint32) * 2))
+			{
+				throw std::runtime_error("Binary file corrupt: Record table overflows.");
+			}
+			uint32 RecordSize;
+			memcpy(&RecordSize, Context.RecordData + Offset + sizeof(uint32), sizeof(uint32));
+			Context.RecordOffsets.Add(Offset);
+			Offset += sizeof(uint32) * 2 + RecordSize;
+		}
+		if (Offset != Context.RecordSize)
+		{
+			throw std::runtime_error("Binary file corrupt: Record sizes do not match header.");
+		}
+
+		// 3) JSON 골격
+		const uint8* SkeletonView = Reader.ReadView(static_cast<int64>(Header.SkeletonBytes));
+		FJsonDocument Skeleton;
+		if (!Skeleton.Parse(FString(reinterpret_cast<const char*>(SkeletonView), Header.SkeletonBytes)))
+		{
+			UE_LOG("[error] BinarySerializer: Skeleton parse failed: %s - %s", WideToUTF8(InFilePath).c_str(), Skeleton.GetError().c_str());
+			return false;
+		}
+
+		FContextScope<FReadContext> Scope(ActiveReadContext, &Context);
+		LoadRoot(Skeleton.GetRoot());
+		return true;
+	}
+	catch (const std::exception& Exception)
+	{
+		UE_LOG("[error] BinarySerializer: Load failed: %s - %s", WideToUTF8(InFilePath).c_str(), Exception.what());
+		return false;
+	}
+}
+
+bool FBinarySerializer::TrySaveProperties(const UObject* Object, JSON& OutHandle)
+{
+	FWriteContext* Context = ActiveWriteContext;
+	if (!Context)
+	{
+		return false;
+	}
+
+	const UClass* Class = Object->GetClass();
+	uint32 ClassIndex;
+	if (const uint32* Found = Context->ClassIndices.Find(Class))
+	{
+		ClassIndex = *Found;
+	}
+	else
+	{
+		ClassIndex = static_cast<uint32>(Context->Classes.Add(Class));
+		Context->ClassIndices.Add(Class, ClassIndex);
+	}
+
+	FMemoryWriter Writer(Context->RecordBytes);
+	uint32 RecordSize = 0;
+	Writer << ClassIndex;
+	const SIZE_T SizeOffset = Context->RecordBytes.size();
+	Writer << RecordSize;
+
+	for (const FProperty* Prop : GetClassSchema(Class).Properties)
+	{
+		WritePropertyValue(Writer, Object, *Prop);
+	}
+
+	// 값을 다 쓴 뒤 크기 채우기 (로드 시 레코드 테이블을 만들 때 사용)
+	RecordSize = static_cast<uint32>(Context->RecordBytes.size() - SizeOffset - sizeof(uint32));
+	memcpy(Context->RecordBytes.data() + SizeOffset, &RecordSize, sizeof(uint32));
+
+	OutHandle[RecordKey] = static_cast<int32>(Context->NumRecords++);
+	return true;
+}
+
+bool FBinarySerializer::TryLoadProperties(UObject* Object, int32 RecordIndex)
+{
+	FReadContext* Context = ActiveReadContext;
+	if (!Context || RecordIndex < 0 || RecordIndex >= Context->RecordOffsets.Num())
+	{
+		return false;
+	}
+
+	const int64 Offset = Context->RecordOffsets[RecordIndex];
+	uint32 ClassIndex, RecordSize;
+	memcpy(&ClassIndex, Context->RecordData + Offset, sizeof(uint32));
+	memcpy(&RecordSize, Context->RecordData + Offset + sizeof(uint32), sizeof(uint32));
+	if (ClassIndex >= static_cast<uint32>(Context->Classes.Num()))
+	{
+		throw std::runtime_error("Binary file corrupt: Record class index out of range.");
+	}
+
+	FFileClass& FileClass = Context->Classes[ClassIndex];
+	if (FileClass.MappedClass != Object->GetClass())
+	{
+		BuildMapping(FileClass, Object->GetClass());
+	}
+
+	FMemoryReader Reader(Context->RecordData + Offset + sizeof(uint32) * 2, RecordSize);
+	for (int32 i = 0; i < FileClass.Properties.Num(); ++i)
+	{
+		const FFileProperty& FileProperty = FileClass.Properties[i];
+		ReadPropertyValue(Reader, Object, FileProperty.Type, FileProperty.InnerType, FileClass.Mapping[i]);
+	}
+	return true;
+}
+
+bool FBinarySerializer::IsLoading()
+{
+	return ActiveReadContext != nullptr;
+}
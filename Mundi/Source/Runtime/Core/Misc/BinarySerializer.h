@@ -0,0 +1,43 @@
+﻿#pragma once
+#include <functional>
+#include "UEContainer.h"
+#include "nlohmann/json.hpp"
+
+class UObject;
+class FJsonValue;
+
+/**
+ * @class FBinarySerializer
+ * @brief FProperty 리플렉션 테이블로 읽고 쓰는 레벨/프리팹 바이너리 포맷
+ *
+ * 저장은 기존 Serialize(false) 경로를 그대로 타되, UObject::Serialize의 리플렉션 프로퍼티는 텍스트 대신
+ * 바이너리 레코드로 기록하고 JSON에는 레코드 번호만 남깁니다. 액터/컴포넌트 구조와 오버라이드가 직접 쓰는 값
+ * (컴포넌트 목록, Id/ParentId, 머티리얼 슬롯 등)은 작은 JSON 골격으로 같은 파일에 들어갑니다.
+ * 로드 중에는 UObject의 프로퍼티 루프가 레코드 번호를 보고 바이너리에서 오프셋으로 바로 값을 씁니다.
+ *
+ * 파일 구조: 헤더 | 클래스 스키마 | 프로퍼티 레코드 | JSON 골격
+ *  - 클래스 스키마: 클래스 이름 + (프로퍼티 이름, 타입, 내부 타입) 목록 + 이름/타입/오프셋 해시
+ *  - 해시가 현재 클래스와 같으면 순서대로 대응시키고, 다르면(필드 추가/삭제) 이름+타입으로 맞춰 없는 값은 건너뜀
+ * 읽을 수 있는 JSON 파일은 에디터의 "JSON으로 내보내기" 동작으로만 따로 씁니다. (로드는 두 포맷 모두 가능)
+ * 로드 중 레코드가 손상돼 예외가 나면 LoadFromFile이 false를 반환하고, 호출자가 그때까지 만든 객체를 정리합니다.
+ */
+class FBinarySerializer
+{
+public:
+	// JSON 골격에서 레코드 번호를 담는 키
+	static constexpr const char* RecordKey = "PropertyRecord";
+
+	// 파일 앞 4바이트로 바이너리 포맷인지 판별 (.scene/.prefab 확장자는 JSON/바이너리 모두 가능)
+	static bool IsBinaryFile(const FWideString& InFilePath);
+
+	// SerializeRoot 안에서 일어나는 Serialize(false)의 리플렉션 프로퍼티를 레코드로 모아 파일로 저장
+	static bool SaveToFile(const FWideString& InFilePath, const std::function<void(JSON&)>& SerializeRoot);
+
+	// 파일의 JSON 골격을 FJsonDocument로 파싱해 LoadRoot에 넘김. LoadRoot가 끝날 때까지 레코드 읽기가 활성화됨
+	static bool LoadFromFile(const FWideString& InFilePath, const std::function<void(const FJsonValue&)>& LoadRoot);
+
+	// UObject::Serialize에서 호출: 저장/로드 중이 아니면 false를 반환하고 기존 JSON 경로를 사용
+	static bool TrySaveProperties(const UObject* Object, JSON& OutHandle);
+	static bool TryLoadProperties(UObject* Object, int32 RecordIndex);
+	static bool IsLoading();
+};
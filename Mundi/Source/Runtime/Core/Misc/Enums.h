@@ -153,7 +153,30 @@ namespace Serialization {
     inline void ReadArray<FNormalVertex>(FArchive& Ar, TArray<FNormalVertex>& Arr) {
         uint32 Count;
         Ar << Count;
+
+        if (Count > MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Vertex array size is unreasonable.");
+        }
+
         Arr.resize(Count);
+
+        // 매핑된 아카이브면 디스크 순서(pos, normal, Tangent, color, tex)를 그대로 풀어서 복사
+        constexpr int64 DiskStride = sizeof(float) * (3 + 3 + 4 + 4 + 2);
+        if (const uint8* View = Ar.ReadView(DiskStride * Count))
+        {
+            for (auto& Vtx : Arr)
+            {
+                memcpy(&Vtx.pos, View, sizeof(float) * 3);
+                memcpy(&Vtx.normal, View + 12, sizeof(float) * 3);
+                memcpy(&Vtx.Tangent, View + 24, sizeof(float) * 4);
+                memcpy(&Vtx.color, View + 40, sizeof(float) * 4);
+                memcpy(&Vtx.tex, View + 56, sizeof(float) * 2);
+                View += DiskStride;
+            }
+            return;
+        }
+
         for (auto& Vtx : Arr) Ar << Vtx;
     }
 }
@@ -417,6 +440,8 @@ enum class EEngineShowFlags : uint64
     SF_Shadows = 1ull << 16,
     SF_ShadowAntiAliasing = 1ull << 17,
 
+    SF_OcclusionCulling = 1ull << 18, // Enable/disable CPU HZB occlusion culling
+
     // Default enabled flags
     SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_SkeletalMeshes | SF_Grid | SF_Lighting | SF_Decals | SF_Fog | SF_FXAA |SF_Billboard | SF_Shadows | SF_ShadowAntiAliasing,
 
@@ -487,6 +512,17 @@ enum class ECameraProjectionMode
     Orthographic
 };
 
+// 액터/컴포넌트 틱 순서 그룹 - 그룹 순서대로 실행되며, 그룹 내부에서는 순서를 보장하지 않음
+enum class ETickGroup : uint8
+{
+    PrePhysics,     // 기본 그룹 - 액터 Tick과 대부분의 컴포넌트
+    DuringPhysics,  // 충돌/이동 처리와 함께 도는 컴포넌트
+    PostPhysics,    // 이동 결과를 읽는 컴포넌트 (카메라 추적 등)
+    PostUpdate,     // 프레임 마지막 정리
+
+    Max,
+};
+
 enum class EWorldType : uint8
 {
     None = 0,
@@ -1,62 +1,170 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    constexpr uint32 NameChunkBits = 12;
+    constexpr uint32 NameChunkSize = 1u << NameChunkBits;
+    constexpr uint32 MaxNameChunks = 1024;   // 최대 4M개 이름
+
+    struct FNamePoolState
+    {
+        std::shared_mutex Mutex;
+
+        // 대소문자 무시 해시 -> 같은 해시의 첫 항목, NextInBucket으로 충돌 체인
+        TMap<uint32, uint32> HashToIndex;
+        TArray<uint32> NextInBucket;
+
+        // 청크는 한 번 할당되면 해제/이동하지 않으므로 Get()이 반환한 참조가 계속 유효
+        std::atomic<FNameEntry*> Chunks[MaxNameChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+    };
+
+    // 정적 객체 소멸 순서와 무관하게 종료 시점까지 FName이 유효하도록 해제하지 않음
+    FNamePoolState& GetPoolState()
+    {
+        static FNamePoolState* State = new FNamePoolState();
+        return *State;
+    }
+
+    inline char ToLowerAscii(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // Comparison(소문자 원문)과 대소문자 무시 비교
+    bool EqualsLower(const FString& Lower, const char* InStr, size_t InLen)
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        if (Lower.size() != InLen)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InLen; ++i)
+        {
+            if (Lower[i] != ToLowerAscii(InStr[i]))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    const FNameEntry& GetEntryUnchecked(const FNamePoolState& State, uint32 Index)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        return State.Chunks[Index >> NameChunkBits].load(std::memory_order_acquire)[Index & (NameChunkSize - 1)];
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    // 호출자가 공유/배타 락을 잡고 있어야 함
+    uint32 FindLocked(const FNamePoolState& State, const char* InStr, size_t InLen, uint32 InHash)
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        const uint32* First = State.HashToIndex.Find(InHash);
+        for (uint32 Index = First ? *First : FNamePool::InvalidIndex; Index != FNamePool::InvalidIndex; Index = State.NextInBucket[Index])
+        {
+            if (EqualsLower(GetEntryUnchecked(State, Index).Comparison, InStr, InLen))
+            {
+                return Index;
+            }
+        }
+        return FNamePool::InvalidIndex;
     }
 }
 
+uint32 FNamePool::ComputeHash(const char* InStr, size_t InLen)
+{
+    // FNV-1a (소문자 기준)
+    uint32 Hash = 2166136261u;
+    for (size_t i = 0; i < InLen; ++i)
+    {
+        Hash ^= static_cast<uint8>(ToLowerAscii(InStr[i]));
+        Hash *= 16777619u;
+    }
+    return Hash;
+}
+
 uint32 FNamePool::Add(const FString& InStr)
 {
-    FString Lower = ToLower(InStr);
+    return Add(InStr.data(), InStr.size(), ComputeHash(InStr.data(), InStr.size()));
+}
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+uint32 FNamePool::Find(const char* InStr, size_t InLen, uint32 InHash)
+{
+    FNamePoolState& State = GetPoolState();
+    std::shared_lock<std::shared_mutex> Lock(State.Mutex);
+    return FindLocked(State, InStr, InLen, InHash);
+}
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+uint32 FNamePool::Add(const char* InStr, size_t InLen, uint32 InHash)
+{
+    FNamePoolState& State = GetPoolState();
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    // 대부분은 이미 등록된 이름: 공유 락으로 조회만
+    {
+        std::shared_lock<std::shared_mutex> Lock(State.Mutex);
+        const uint32 Found = FindLocked(State, InStr, InLen, InHash);
+        if (Found != InvalidIndex)
+        {
+            return Found;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> Lock(State.Mutex);
+
+    // 락을 바꾸는 사이 다른 스레드가 등록했을 수 있음
+    const uint32 Found = FindLocked(State, InStr, InLen, InHash);
+    if (Found != InvalidIndex)
+    {
+        return Found;
+    }
+
+    const uint32 NewIndex = State.NumEntries.load(std::memory_order_relaxed);
+    const uint32 ChunkIndex = NewIndex >> NameChunkBits;
+    if (ChunkIndex >= MaxNameChunks)
+    {
+        UE_LOG("FNamePool: name table is full");
+        return InvalidIndex;
+    }
+
+    FNameEntry* Chunk = State.Chunks[ChunkIndex].load(std::memory_order_relaxed);
+    if (!Chunk)
+    {
+        Chunk = new FNameEntry[NameChunkSize];
+        State.Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+    }
+
+    // 소문자 사본은 새 이름을 등록할 때만 만듦
+    FNameEntry& Entry = Chunk[NewIndex & (NameChunkSize - 1)];
+    Entry.Display.assign(InStr, InLen);
+    Entry.Comparison.resize(InLen);
+    for (size_t i = 0; i < InLen; ++i)
+    {
+        Entry.Comparison[i] = ToLowerAscii(InStr[i]);
+    }
+
+    const uint32* First = State.HashToIndex.Find(InHash);
+    State.NextInBucket.Add(First ? *First : InvalidIndex);
+    State.HashToIndex.Add(InHash, NewIndex);
+
+    State.NumEntries.store(NewIndex + 1, std::memory_order_release);
     return NewIndex;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    const FNamePoolState& State = GetPoolState();
 
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    if (Index >= State.NumEntries.load(std::memory_order_acquire))
     {
         static FNameEntry InvalidEntry = { "Invalid", "invalid" };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return GetEntryUnchecked(State, Index);
+}
+
+uint32 FNamePool::Num()
+{
+    return GetPoolState().NumEntries.load(std::memory_order_acquire);
+}
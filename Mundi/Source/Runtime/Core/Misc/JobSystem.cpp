@@ -0,0 +1,239 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace
+{
+    struct FJob
+    {
+        std::function<void()> Function;
+        FJobGroup* Group = nullptr;
+    };
+
+    // 덱 하나 (소유 워커는 뒤에서, 도둑은 앞에서 꺼냄)
+    struct FJobQueue
+    {
+        std::mutex Mutex;
+        std::deque<FJob> Jobs;
+
+        void PushBack(FJob&& Job)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Jobs.push_back(std::move(Job));
+        }
+
+        bool PopBack(FJob& OutJob)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (Jobs.empty())
+            {
+                return false;
+            }
+            OutJob = std::move(Jobs.back());
+            Jobs.pop_back();
+            return true;
+        }
+
+        bool StealFront(FJob& OutJob)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (Jobs.empty())
+            {
+                return false;
+            }
+            OutJob = std::move(Jobs.front());
+            Jobs.pop_front();
+            return true;
+        }
+    };
+
+    // 워커는 0 ~ NumWorkers-1, 그 외 스레드는 공용 덱(NumWorkers)을 사용
+    thread_local int32 GJobQueueIndex = -1;
+
+    // 작업 하나 실행. 예외가 나도 NumPending은 반드시 내려가야 Wait가 끝나므로 가드에서 감소
+    void RunJob(std::function<void()>& Function, FJobGroup& Group)
+    {
+        struct FPendingGuard
+        {
+            FJobGroup& Group;
+            ~FPendingGuard() { Group.NumPending.fetch_sub(1, std::memory_order_acq_rel); }
+        } Guard{ Group };
+
+        try
+        {
+            Function();
+        }
+        catch (...)
+        {
+            // 워커 스레드 밖으로 빠져나가면 프로세스가 종료되므로 첫 예외만 보관해 Wait 쪽으로 넘김
+            if (!Group.bHasException.exchange(true, std::memory_order_relaxed))
+            {
+                Group.Exception = std::current_exception();
+            }
+        }
+    }
+}
+
+struct FJobSystem::FImpl
+{
+    std::vector<std::thread> Workers;
+    std::vector<std::unique_ptr<FJobQueue>> Queues;    // Workers.size() + 1 (마지막이 공용 덱)
+
+    // 큐에 들어 있는 작업 수 (잠든 워커를 깨울지 판단)
+    std::atomic<int32> NumQueuedJobs{ 0 };
+
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+    bool bShutdown = false;
+
+    int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+    int32 GetQueueIndex() const
+    {
+        return GJobQueueIndex >= 0 ? GJobQueueIndex : GetNumWorkers();
+    }
+
+    void Push(FJob&& Job)
+    {
+        Queues[GetQueueIndex()]->PushBack(std::move(Job));
+        NumQueuedJobs.fetch_add(1, std::memory_order_release);
+
+        // 잠들기 직전 조건 검사와 엇갈리지 않도록 WakeMutex를 거친 뒤 깨움
+        {
+            std::lock_guard<std::mutex> Lock(WakeMutex);
+        }
+        WakeCondition.notify_one();
+    }
+
+    // 자기 덱 → 다른 덱 순서로 작업 하나를 찾아 실행
+    bool TryExecuteOne()
+    {
+        const int32 NumQueues = static_cast<int32>(Queues.size());
+        const int32 Self = GetQueueIndex();
+
+        FJob Job;
+        bool bFound = Queues[Self]->PopBack(Job);
+        for (int32 Offset = 1; !bFound && Offset < NumQueues; ++Offset)
+        {
+            bFound = Queues[(Self + Offset) % NumQueues]->StealFront(Job);
+        }
+        if (!bFound)
+        {
+            return false;
+        }
+
+        NumQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        RunJob(Job.Function, *Job.Group);
+        return true;
+    }
+
+    void WorkerLoop(int32 WorkerIndex)
+    {
+        GJobQueueIndex = WorkerIndex;
+        while (true)
+        {
+            if (TryExecuteOne())
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> Lock(WakeMutex);
+            WakeCondition.wait(Lock, [this]()
+            {
+                return bShutdown || NumQueuedJobs.load(std::memory_order_acquire) > 0;
+            });
+            if (bShutdown)
+            {
+                return;
+            }
+        }
+    }
+};
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::FJobSystem()
+    : Impl(new FImpl())
+{
+    // 호출 스레드도 Wait 중에 작업을 처리하므로 코어 수 - 1 (최대 15개)
+    const uint32 HardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const uint32 NumWorkers = std::min(HardwareThreads - 1, 15u);
+
+    for (uint32 i = 0; i <= NumWorkers; ++i)
+    {
+        Impl->Queues.push_back(std::make_unique<FJobQueue>());
+    }
+    for (uint32 i = 0; i < NumWorkers; ++i)
+    {
+        Impl->Workers.emplace_back([this, i]() { Impl->WorkerLoop(static_cast<int32>(i)); });
+    }
+}
+
+FJobSystem::~FJobSystem()
+{
+    {
+        std::lock_guard<std::mutex> Lock(Impl->WakeMutex);
+        Impl->bShutdown = true;
+    }
+    Impl->WakeCondition.notify_all();
+    for (std::thread& Worker : Impl->Workers)
+    {
+        Worker.join();
+    }
+    delete Impl;
+}
+
+void FJobSystem::Dispatch(FJobGroup& Group, std::function<void()> Job)
+{
+    Group.NumPending.fetch_add(1, std::memory_order_relaxed);
+
+    // 워커가 없으면 바로 실행
+    if (Impl->Workers.empty())
+    {
+        RunJob(Job, Group);
+        return;
+    }
+
+    Impl->Push(FJob{ std::move(Job), &Group });
+}
+
+void FJobSystem::Wait(FJobGroup& Group)
+{
+    while (!Group.IsDone())
+    {
+        // 남은 작업이 다른 스레드에서 실행 중이면 잠깐 양보
+        if (!Impl->TryExecuteOne())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // 모든 작업이 끝난 뒤라 Exception을 쓰는 스레드가 없음 (NumPending 감소가 release)
+    if (Group.bHasException.load(std::memory_order_relaxed))
+    {
+        std::exception_ptr Exception = Group.Exception;
+        Group.Exception = nullptr;
+        Group.bHasException.store(false, std::memory_order_relaxed);
+
+        UE_LOG("[error] JobSystem: a job threw an exception, rethrowing on the waiting thread");
+        std::rethrow_exception(Exception);
+    }
+}
+
+int32 FJobSystem::GetNumWorkers() const
+{
+    return Impl->GetNumWorkers();
+}
+
+bool FJobSystem::IsWorkerThread()
+{
+    return GJobQueueIndex >= 0;
+}
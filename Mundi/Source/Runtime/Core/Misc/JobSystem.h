@@ -0,0 +1,53 @@
+﻿#pragma once
+#include <functional>
+#include <atomic>
+#include <exception>
+
+// ─────────────────────────────────────────────
+// FJobSystem
+//  - 워커 스레드마다 작업 덱을 두는 work-stealing 작업 시스템
+//  - 워커가 넣은 작업은 자기 덱 뒤에서 꺼내고(LIFO), 할 일이 없으면 다른 덱 앞에서 훔쳐옴(FIFO)
+//  - 워커가 아닌 스레드(메인 스레드)가 넣은 작업은 공용 덱으로 들어가고 워커들이 훔쳐감
+//  - Wait 중인 스레드는 잠들지 않고 남은 작업을 대신 실행하므로, 작업 안에서 다시 Dispatch/Wait 해도 교착되지 않음
+//  - 작업이 던진 예외는 워커에서 잡아 두었다가 Wait가 호출 스레드에서 다시 던짐 (여러 개면 처음 것만)
+// ─────────────────────────────────────────────
+
+// Dispatch한 작업들이 모두 끝났는지 추적하는 카운터 (Wait가 끝날 때까지 살아 있어야 함)
+struct FJobGroup
+{
+    std::atomic<int32> NumPending{ 0 };
+
+    // 작업에서 처음 던져진 예외 (NumPending이 0이 된 뒤 Wait에서만 읽음)
+    std::exception_ptr Exception;
+    std::atomic<bool> bHasException{ false };
+
+    bool IsDone() const { return NumPending.load(std::memory_order_acquire) == 0; }
+};
+
+class FJobSystem
+{
+public:
+    static FJobSystem& Get();
+
+    // 작업 하나를 Group에 추가해서 큐에 넣음
+    void Dispatch(FJobGroup& Group, std::function<void()> Job);
+
+    // Group의 작업이 모두 끝날 때까지 남은 작업을 함께 처리하며 대기 (작업이 예외를 던졌으면 여기서 다시 던짐)
+    void Wait(FJobGroup& Group);
+
+    // 호출 스레드를 제외한 워커 수
+    int32 GetNumWorkers() const;
+
+    // 현재 스레드가 작업 시스템의 워커인지
+    static bool IsWorkerThread();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+
+private:
+    FJobSystem();
+    ~FJobSystem();
+
+    struct FImpl;
+    FImpl* Impl = nullptr;
+};
@@ -0,0 +1,535 @@
+﻿#include "pch.h"
+#include "JsonDocument.h"
+#include <charconv>
+#include <cstring>
+
+namespace
+{
+	constexpr SIZE_T ArenaBlockSize = 64 * 1024;
+	constexpr uint32 MaxParseDepth = 512;
+
+	static_assert(std::is_trivially_copyable_v<FJsonValue>, "FJsonValue는 아레나로 memcpy 됩니다");
+	static_assert(std::is_trivially_copyable_v<FJsonMember>, "FJsonMember는 아레나로 memcpy 됩니다");
+
+	bool ParseHex4(const char* InText, uint32& OutCode)
+	{
+		OutCode = 0;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const char C = InText[i];
+			uint32 Digit;
+			if (C >= '0' && C <= '9') Digit = C - '0';
+			else if (C >= 'a' && C <= 'f') Digit = C - 'a' + 10;
+			else if (C >= 'A' && C <= 'F') Digit = C - 'A' + 10;
+			else return false;
+			OutCode = (OutCode << 4) | Digit;
+		}
+		return true;
+	}
+
+	// UTF-8 인코딩 결과는 항상 원본 이스케이프(\uXXXX 6바이트, 서로게이트 쌍 12바이트)보다 짧아 제자리 기록이 가능
+	char* WriteUtf8(char* Write, uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			*Write++ = static_cast<char>(CodePoint);
+		}
+		else if (CodePoint < 0x800)
+		{
+			*Write++ = static_cast<char>(0xC0 | (CodePoint >> 6));
+			*Write++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			*Write++ = static_cast<char>(0xE0 | (CodePoint >> 12));
+			*Write++ = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+			*Write++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+		}
+		else
+		{
+			*Write++ = static_cast<char>(0xF0 | (CodePoint >> 18));
+			*Write++ = static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F));
+			*Write++ = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+			*Write++ = static_cast<char>(0x80 | (CodePoint & 0x3F));
+		}
+		return Write;
+	}
+}
+
+//====================================================================================
+// FJsonValue
+//====================================================================================
+
+const FJsonValue* FJsonValue::Find(std::string_view InKey) const
+{
+	if (Type != Class::Object)
+	{
+		return nullptr;
+	}
+
+	// 중복 키는 json::JSON(std::map 덮어쓰기)과 같이 마지막 값이 이김
+	for (uint32 i = Length; i-- > 0;)
+	{
+		const FJsonMember& Member = Members[i];
+		if (Member.KeyLength == InKey.size() && std::memcmp(Member.Key, InKey.data(), InKey.size()) == 0)
+		{
+			return &Member.Value;
+		}
+	}
+	return nullptr;
+}
+
+const FJsonValue& FJsonValue::at(uint32 InIndex) const
+{
+	static const FJsonValue NullValue;
+	return (Type == Class::Array && InIndex < Length) ? Elements[InIndex] : NullValue;
+}
+
+std::span<const FJsonMember> FJsonValue::ObjectRange() const
+{
+	if (Type != Class::Object || Length == 0)
+	{
+		return {};
+	}
+	return std::span<const FJsonMember>(Members, Length);
+}
+
+std::span<const FJsonValue> FJsonValue::ArrayRange() const
+{
+	if (Type != Class::Array || Length == 0)
+	{
+		return {};
+	}
+	return std::span<const FJsonValue>(Elements, Length);
+}
+
+JSON FJsonValue::ToJSON() const
+{
+	switch (Type)
+	{
+	case Class::Object:
+	{
+		JSON Object = JSON::Make(Class::Object);
+		for (const FJsonMember& Member : ObjectRange())
+		{
+			Object[FString(Member.GetKey())] = Member.Value.ToJSON();
+		}
+		return Object;
+	}
+	case Class::Array:
+	{
+		JSON Array = JSON::Make(Class::Array);
+		for (uint32 i = 0; i < Length; ++i)
+		{
+			Array[i] = Elements[i].ToJSON();
+		}
+		return Array;
+	}
+	case Class::String:
+		return JSON(ToString());
+	case Class::Floating:
+		return JSON(Float);
+	case Class::Integral:
+		return JSON(static_cast<long>(Int));
+	case Class::Boolean:
+		return JSON(Bool);
+	default:
+		return JSON();
+	}
+}
+
+//====================================================================================
+// FJsonDocument
+//====================================================================================
+
+bool FJsonDocument::Parse(FString&& InText)
+{
+	Reset();
+
+	Buffer = std::move(InText);
+	Cursor = Buffer.data();
+	End = Cursor + Buffer.size();
+
+	SkipWhitespace();
+	bool bSuccess = ParseValue(Root, 0);
+	if (bSuccess)
+	{
+		SkipWhitespace();
+		if (Cursor != End)
+		{
+			bSuccess = Fail("Unexpected trailing characters");
+		}
+	}
+
+	// 스크래치 스택은 파싱 중에만 필요 (큰 객체의 멤버 수만큼 커질 수 있음)
+	ElementStack.Empty();
+	ElementStack.Shrink();
+	MemberStack.Empty();
+	MemberStack.Shrink();
+
+	if (!bSuccess)
+	{
+		Root = FJsonValue();
+	}
+	return bSuccess;
+}
+
+void FJsonDocument::Reset()
+{
+	FString().swap(Buffer);
+	Cursor = nullptr;
+	End = nullptr;
+	Root = FJsonValue();
+	Error.clear();
+	ElementStack.Empty();
+	MemberStack.Empty();
+	ArenaBlocks.Empty();
+	ArenaCursor = nullptr;
+	ArenaRemaining = 0;
+	ArenaReservedBytes = 0;
+}
+
+bool FJsonDocument::Fail(const char* InMessage)
+{
+	const uint64 Offset = Cursor ? static_cast<uint64>(Cursor - Buffer.data()) : 0;
+	Error = FString(InMessage) + " (offset " + std::to_string(Offset) + ")";
+	return false;
+}
+
+void FJsonDocument::SkipWhitespace()
+{
+	while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t'))
+	{
+		++Cursor;
+	}
+}
+
+void* FJsonDocument::AllocateArena(SIZE_T Size)
+{
+	Size = (Size + 7) & ~static_cast<SIZE_T>(7);
+	if (Size > ArenaRemaining)
+	{
+		// 블록보다 큰 요청(원소가 수천 개인 배열 등)은 전용 블록을 받음
+		const SIZE_T BlockSize = std::max(ArenaBlockSize, Size);
+		ArenaBlocks.Emplace(std::make_unique<uint8[]>(BlockSize));
+		ArenaCursor = ArenaBlocks.Last().get();
+		ArenaRemaining = BlockSize;
+		ArenaReservedBytes += BlockSize;
+	}
+
+	void* Result = ArenaCursor;
+	ArenaCursor += Size;
+	ArenaRemaining -= Size;
+	return Result;
+}
+
+bool FJsonDocument::ParseValue(FJsonValue& OutValue, uint32 Depth)
+{
+	if (Depth > MaxParseDepth)
+	{
+		return Fail("Nesting too deep");
+	}
+	if (Cursor >= End)
+	{
+		return Fail("Unexpected end of input");
+	}
+
+	switch (*Cursor)
+	{
+	case '{':
+		return ParseObject(OutValue, Depth);
+	case '[':
+		return ParseArray(OutValue, Depth);
+	case '"':
+		OutValue.Type = FJsonValue::Class::String;
+		return ParseString(OutValue.String, OutValue.Length);
+	case 't':
+		OutValue.Type = FJsonValue::Class::Boolean;
+		OutValue.Bool = true;
+		return ParseLiteral("true", 4);
+	case 'f':
+		OutValue.Type = FJsonValue::Class::Boolean;
+		OutValue.Bool = false;
+		return ParseLiteral("false", 5);
+	case 'n':
+		OutValue.Type = FJsonValue::Class::Null;
+		return ParseLiteral("null", 4);
+	default:
+		if (*Cursor == '-' || (*Cursor >= '0' && *Cursor <= '9'))
+		{
+			return ParseNumber(OutValue);
+		}
+		return Fail("Unexpected character");
+	}
+}
+
+bool FJsonDocument::ParseObject(FJsonValue& OutValue, uint32 Depth)
+{
+	++Cursor; // '{'
+	const int32 StackBase = MemberStack.Num();
+
+	SkipWhitespace();
+	if (Cursor < End && *Cursor == '}')
+	{
+		++Cursor;
+	}
+	else
+	{
+		while (true)
+		{
+			SkipWhitespace();
+			if (Cursor >= End || *Cursor != '"')
+			{
+				return Fail("Object: expected key");
+			}
+
+			// 자식 컨테이너가 스택을 다 쓰고 되돌린 뒤에 넣어야 하므로 값까지 읽고 추가
+			FJsonMember Member;
+			if (!ParseString(Member.Key, Member.KeyLength))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if (Cursor >= End || *Cursor != ':')
+			{
+				return Fail("Object: expected ':'");
+			}
+			++Cursor;
+			SkipWhitespace();
+
+			if (!ParseValue(Member.Value, Depth + 1))
+			{
+				return false;
+			}
+			MemberStack.Add(Member);
+
+			SkipWhitespace();
+			if (Cursor < End && *Cursor == ',')
+			{
+				++Cursor;
+				continue;
+			}
+			if (Cursor < End && *Cursor == '}')
+			{
+				++Cursor;
+				break;
+			}
+			return Fail("Object: expected ',' or '}'");
+		}
+	}
+
+	const uint32 Count = static_cast<uint32>(MemberStack.Num() - StackBase);
+	FJsonMember* Members = nullptr;
+	if (Count > 0)
+	{
+		Members = static_cast<FJsonMember*>(AllocateArena(sizeof(FJsonMember) * Count));
+		std::memcpy(Members, MemberStack.data() + StackBase, sizeof(FJsonMember) * Count);
+		MemberStack.resize(StackBase);
+	}
+
+	OutValue.Type = FJsonValue::Class::Object;
+	OutValue.Length = Count;
+	OutValue.Members = Members;
+	return true;
+}
+
+bool FJsonDocument::ParseArray(FJsonValue& OutValue, uint32 Depth)
+{
+	++Cursor; // '['
+	const int32 StackBase = ElementStack.Num();
+
+	SkipWhitespace();
+	if (Cursor < End && *Cursor == ']')
+	{
+		++Cursor;
+	}
+	else
+	{
+		while (true)
+		{
+			SkipWhitespace();
+
+			FJsonValue Element;
+			if (!ParseValue(Element, Depth + 1))
+			{
+				return false;
+			}
+			ElementStack.Add(Element);
+
+			SkipWhitespace();
+			if (Cursor < End && *Cursor == ',')
+			{
+				++Cursor;
+				continue;
+			}
+			if (Cursor < End && *Cursor == ']')
+			{
+				++Cursor;
+				break;
+			}
+			return Fail("Array: expected ',' or ']'");
+		}
+	}
+
+	const uint32 Count = static_cast<uint32>(ElementStack.Num() - StackBase);
+	FJsonValue* Elements = nullptr;
+	if (Count > 0)
+	{
+		Elements = static_cast<FJsonValue*>(AllocateArena(sizeof(FJsonValue) * Count));
+		std::memcpy(Elements, ElementStack.data() + StackBase, sizeof(FJsonValue) * Count);
+		ElementStack.resize(StackBase);
+	}
+
+	OutValue.Type = FJsonValue::Class::Array;
+	OutValue.Length = Count;
+	OutValue.Elements = Elements;
+	return true;
+}
+
+bool FJsonDocument::ParseString(const char*& OutString, uint32& OutLength)
+{
+	++Cursor; // '"'
+
+	// 버퍼를 제자리에서 언이스케이프 (Write는 항상 Cursor보다 앞서지 않음)
+	char* const Begin = Cursor;
+	char* Write = Cursor;
+	while (true)
+	{
+		if (Cursor >= End)
+		{
+			return Fail("String: unterminated");
+		}
+
+		const char C = *Cursor;
+		if (C == '"')
+		{
+			break;
+		}
+		if (C != '\\')
+		{
+			*Write++ = *Cursor++;
+			continue;
+		}
+
+		if (Cursor + 1 >= End)
+		{
+			return Fail("String: unterminated escape");
+		}
+		const char Escaped = Cursor[1];
+		Cursor += 2;
+		switch (Escaped)
+		{
+		case '"':  *Write++ = '"';  break;
+		case '\\': *Write++ = '\\'; break;
+		case '/':  *Write++ = '/';  break;
+		case 'b':  *Write++ = '\b'; break;
+		case 'f':  *Write++ = '\f'; break;
+		case 'n':  *Write++ = '\n'; break;
+		case 'r':  *Write++ = '\r'; break;
+		case 't':  *Write++ = '\t'; break;
+		case 'u':
+		{
+			uint32 CodePoint;
+			if (End - Cursor < 4 || !ParseHex4(Cursor, CodePoint))
+			{
+				return Fail("String: invalid unicode escape");
+			}
+			Cursor += 4;
+
+			// 서로게이트 쌍
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && End - Cursor >= 6 && Cursor[0] == '\\' && Cursor[1] == 'u')
+			{
+				uint32 Low;
+				if (ParseHex4(Cursor + 2, Low) && Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					Cursor += 6;
+				}
+			}
+			Write = WriteUtf8(Write, CodePoint);
+			break;
+		}
+		default:
+			return Fail("String: invalid escape");
+		}
+	}
+
+	OutString = Begin;
+	OutLength = static_cast<uint32>(Write - Begin);
+	*Write = '\0'; // 닫는 따옴표 위치 이하이므로 안전. 뷰를 C 문자열로도 쓸 수 있게 함
+	++Cursor;
+	return true;
+}
+
+bool FJsonDocument::ParseNumber(FJsonValue& OutValue)
+{
+	const char* Begin = Cursor;
+	bool bIsFloating = false;
+
+	if (*Cursor == '-')
+	{
+		++Cursor;
+	}
+	while (Cursor < End && *Cursor >= '0' && *Cursor <= '9')
+	{
+		++Cursor;
+	}
+	if (Cursor < End && *Cursor == '.')
+	{
+		bIsFloating = true;
+		++Cursor;
+		while (Cursor < End && *Cursor >= '0' && *Cursor <= '9')
+		{
+			++Cursor;
+		}
+	}
+	if (Cursor < End && (*Cursor == 'e' || *Cursor == 'E'))
+	{
+		// json::JSON과 같이 지수가 붙으면 정수 표기여도 실수로 취급
+		bIsFloating = true;
+		++Cursor;
+		if (Cursor < End && (*Cursor == '+' || *Cursor == '-'))
+		{
+			++Cursor;
+		}
+		while (Cursor < End && *Cursor >= '0' && *Cursor <= '9')
+		{
+			++Cursor;
+		}
+	}
+
+	if (!bIsFloating)
+	{
+		int64 IntValue = 0;
+		const std::from_chars_result Result = std::from_chars(Begin, Cursor, IntValue);
+		if (Result.ec == std::errc() && Result.ptr == Cursor)
+		{
+			OutValue.Type = FJsonValue::Class::Integral;
+			OutValue.Int = IntValue;
+			return true;
+		}
+		// int64 범위를 넘으면 실수로 읽음
+	}
+
+	double FloatValue = 0.0;
+	const std::from_chars_result Result = std::from_chars(Begin, Cursor, FloatValue);
+	if (Result.ec != std::errc() || Result.ptr != Cursor)
+	{
+		Cursor = const_cast<char*>(Begin);
+		return Fail("Number: invalid format");
+	}
+	OutValue.Type = FJsonValue::Class::Floating;
+	OutValue.Float = FloatValue;
+	return true;
+}
+
+bool FJsonDocument::ParseLiteral(const char* InLiteral, uint32 InLength)
+{
+	if (static_cast<uint64>(End - Cursor) < InLength || std::memcmp(Cursor, InLiteral, InLength) != 0)
+	{
+		return Fail("Unexpected literal");
+	}
+	Cursor += InLength;
+	return true;
+}
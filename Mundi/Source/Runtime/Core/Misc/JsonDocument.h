@@ -0,0 +1,135 @@
+﻿#pragma once
+#include <span>
+#include <string_view>
+#include "UEContainer.h"
+#include "nlohmann/json.hpp"
+
+struct FJsonMember;
+
+/**
+ * @class FJsonValue
+ * @brief FJsonDocument 아레나에 올라가는 읽기 전용 JSON 노드 (16 bytes)
+ *
+ * 객체 멤버/배열 원소는 아레나의 연속 배열에 놓이고, 문자열은 문서 버퍼를 제자리에서 언이스케이프한 뷰입니다.
+ * json::JSON과 같은 이름의 읽기 함수(size/at/ToFloat/...)를 제공해서 같은 템플릿 코드가 두 DOM을 모두 읽을 수 있습니다.
+ * 노드는 소유한 FJsonDocument보다 오래 살 수 없습니다.
+ */
+class FJsonValue
+{
+public:
+	using Class = json::JSON::Class;
+
+	Class JSONType() const { return Type; }
+	bool IsNull() const { return Type == Class::Null; }
+	bool IsObject() const { return Type == Class::Object; }
+	bool IsArray() const { return Type == Class::Array; }
+
+	// 객체 멤버 수 / 배열 원소 수 (그 외 -1, json::JSON과 동일)
+	int size() const { return (Type == Class::Object || Type == Class::Array) ? static_cast<int>(Length) : -1; }
+
+	// 객체 멤버 검색 (선형 탐색, 없거나 객체가 아니면 nullptr)
+	const FJsonValue* Find(std::string_view InKey) const;
+	bool hasKey(std::string_view InKey) const { return Find(InKey) != nullptr; }
+
+	// 배열 원소 (범위 밖이면 Null 노드)
+	const FJsonValue& at(uint32 InIndex) const;
+	const FJsonValue& operator[](uint32 InIndex) const { return at(InIndex); }
+
+	// 객체 멤버 순회: for (const FJsonMember& Member : Node.ObjectRange())
+	std::span<const FJsonMember> ObjectRange() const;
+	std::span<const FJsonValue> ArrayRange() const;
+
+	std::string_view ToStringView() const { return Type == Class::String ? std::string_view(String, Length) : std::string_view(); }
+	FString ToString() const { return FString(ToStringView()); }
+	// json::JSON과 달리 정수 노드도 실수로 읽음
+	double ToFloat() const { return Type == Class::Floating ? Float : (Type == Class::Integral ? static_cast<double>(Int) : 0.0); }
+	long ToInt() const { return Type == Class::Integral ? static_cast<long>(Int) : 0; }
+	int64 ToInt64() const { return Type == Class::Integral ? Int : 0; }
+	bool ToBool() const { return Type == Class::Boolean ? Bool : false; }
+
+	// 이 노드 이하를 json::JSON으로 만듦 (자식은 이동으로 붙임). json::JSON만 받는 드문 경로(MID 슬롯, LoadFromFile 호환)용
+	JSON ToJSON() const;
+
+private:
+	friend class FJsonDocument;
+
+	Class Type = Class::Null;
+	uint32 Length = 0;         // 문자열 길이 / 멤버 수 / 원소 수
+	union
+	{
+		double Float;
+		int64 Int = 0;
+		bool Bool;
+		const char* String;
+		const FJsonValue* Elements;
+		const FJsonMember* Members;
+	};
+};
+
+struct FJsonMember
+{
+	const char* Key = nullptr;
+	uint32 KeyLength = 0;
+	FJsonValue Value;
+
+	std::string_view GetKey() const { return std::string_view(Key, KeyLength); }
+};
+
+/**
+ * @class FJsonDocument
+ * @brief 레벨/프리팹 로드용 아레나 할당 JSON 파서
+ *
+ * SimpleJSON(json::JSON)은 노드마다 map/deque/string을 힙에 할당하고 파싱 중 하위 트리를 통째로 복사합니다.
+ * FJsonDocument는 파일 버퍼를 소유한 채 제자리에서 파싱하고, 노드는 64KB 블록 아레나에 연속으로 놓습니다.
+ * 컨테이너의 자식은 파싱 동안 스크래치 스택에 쌓였다가 닫힐 때 아레나로 한 번에 복사됩니다.
+ *
+ * 레벨 루트/액터 목록/프리팹은 물론 액터/컴포넌트도 UObject::LoadFromNode로 문서 노드를 바로 읽으므로
+ * 로드 경로에서 SimpleJSON 트리를 만들지 않습니다. (MID 머티리얼 슬롯만 예외적으로 ToJSON()을 거침)
+ */
+class FJsonDocument
+{
+public:
+	FJsonDocument() = default;
+	FJsonDocument(const FJsonDocument&) = delete;
+	FJsonDocument& operator=(const FJsonDocument&) = delete;
+
+	// 텍스트를 넘겨받아 파싱 (이전 내용은 버림). 실패 시 false, GetError()에 위치와 원인
+	bool Parse(FString&& InText);
+	bool Parse(const FString& InText) { return Parse(FString(InText)); }
+
+	void Reset();
+
+	const FJsonValue& GetRoot() const { return Root; }
+	const FString& GetError() const { return Error; }
+
+	// 버퍼 + 아레나 블록 바이트 (파싱 결과가 차지하는 메모리)
+	uint64 GetAllocatedBytes() const { return Buffer.capacity() + ArenaReservedBytes; }
+
+private:
+	bool ParseValue(FJsonValue& OutValue, uint32 Depth);
+	bool ParseObject(FJsonValue& OutValue, uint32 Depth);
+	bool ParseArray(FJsonValue& OutValue, uint32 Depth);
+	bool ParseString(const char*& OutString, uint32& OutLength);
+	bool ParseNumber(FJsonValue& OutValue);
+	bool ParseLiteral(const char* InLiteral, uint32 InLength);
+	void SkipWhitespace();
+	bool Fail(const char* InMessage);
+
+	void* AllocateArena(SIZE_T Size);
+
+	FString Buffer;
+	char* Cursor = nullptr;
+	char* End = nullptr;
+
+	FJsonValue Root;
+	FString Error;
+
+	// 닫히지 않은 컨테이너의 자식들 (깊이와 무관하게 하나의 스택을 공유)
+	TArray<FJsonValue> ElementStack;
+	TArray<FJsonMember> MemberStack;
+
+	TArray<std::unique_ptr<uint8[]>> ArenaBlocks;
+	uint8* ArenaCursor = nullptr;
+	SIZE_T ArenaRemaining = 0;
+	uint64 ArenaReservedBytes = 0;
+};
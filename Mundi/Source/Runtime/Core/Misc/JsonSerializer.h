@@ -14,9 +14,11 @@
 // #include "Core/Public/Object.h" // UE_LOG 등
 #include "UEContainer.h"
 #include "GlobalConsole.h"
+#include "PathUtils.h"
 #include "Vector.h"
 #include "Enums.h"
 #include "nlohmann/json.hpp"  // 사용하는 JSON 라이브러리
+#include "JsonDocument.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -313,6 +315,197 @@ public:
 		return false;
 	}
 
+	//====================================================================================
+	// Reading from FJsonDocument
+	//  - 위 함수들과 같은 이름/규칙. 키는 string_view로 받아 임시 FString을 만들지 않음
+	//  - Object/Array는 복사 대신 문서 안의 노드 포인터를 돌려줌
+	//====================================================================================
+
+	static bool ReadInt64(const FJsonValue& InJson, std::string_view InKey, int64& OutValue, int64 InDefaultValue = 0, bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->JSONType() == JSON::Class::Integral)
+		{
+			OutValue = Value->ToInt64();
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s int64 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadInt32(const FJsonValue& InJson, std::string_view InKey, int32& OutValue, int32 InDefaultValue = 0, bool bInUseLog = true)
+	{
+		int64 Value_i64;
+		if (ReadInt64(InJson, InKey, Value_i64, 0, false) && Value_i64 >= INT32_MIN && Value_i64 <= INT32_MAX)
+		{
+			OutValue = static_cast<int32>(Value_i64);
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s int32 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadUint32(const FJsonValue& InJson, std::string_view InKey, uint32& OutValue, uint32 InDefaultValue = 0, bool bInUseLog = true)
+	{
+		int64 Value_i64;
+		if (ReadInt64(InJson, InKey, Value_i64, 0, false) && Value_i64 >= 0 && Value_i64 <= UINT32_MAX)
+		{
+			OutValue = static_cast<uint32>(Value_i64);
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s uint32 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadFloat(const FJsonValue& InJson, std::string_view InKey, float& OutValue, float InDefaultValue = 0.0f, bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->JSONType() == JSON::Class::Floating)
+		{
+			OutValue = static_cast<float>(Value->ToFloat());
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s float 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadBool(const FJsonValue& InJson, std::string_view InKey, bool& OutValue, bool InDefaultValue = false, bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->JSONType() == JSON::Class::Boolean)
+		{
+			OutValue = Value->ToBool();
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s Bool 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadString(const FJsonValue& InJson, std::string_view InKey, FString& OutValue, const FString& InDefaultValue = "", bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->JSONType() == JSON::Class::String)
+		{
+			OutValue.assign(Value->ToStringView());
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s String 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadObject(const FJsonValue& InJson, std::string_view InKey, const FJsonValue*& OutValue, bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->IsObject())
+		{
+			OutValue = Value;
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s Object 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = nullptr;
+		return false;
+	}
+
+	static bool ReadArray(const FJsonValue& InJson, std::string_view InKey, const FJsonValue*& OutValue, bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->IsArray())
+		{
+			OutValue = Value;
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s Array 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = nullptr;
+		return false;
+	}
+
+	static bool ReadArrayFloat(const FJsonValue& InJson, std::string_view InKey, float& OutValue, const float& InDefaultValue = 0.0f, bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->IsArray() && Value->size() == 1)
+		{
+			OutValue = static_cast<float>(Value->at(0).ToFloat());
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s Array Float 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadVector(const FJsonValue& InJson, std::string_view InKey, FVector& OutValue, const FVector& InDefaultValue = FVector::Zero(), bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->IsArray() && Value->size() == 3)
+		{
+			OutValue = {
+				static_cast<float>(Value->at(0).ToFloat()),
+				static_cast<float>(Value->at(1).ToFloat()),
+				static_cast<float>(Value->at(2).ToFloat())
+			};
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s Vector 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
+	static bool ReadVector4(const FJsonValue& InJson, std::string_view InKey, FVector4& OutValue, const FVector4& InDefaultValue = FVector4(0,0,0,0), bool bInUseLog = true)
+	{
+		const FJsonValue* Value = InJson.Find(InKey);
+		if (Value && Value->IsArray() && Value->size() == 4)
+		{
+			OutValue = {
+				static_cast<float>(Value->at(0).ToFloat()),
+				static_cast<float>(Value->at(1).ToFloat()),
+				static_cast<float>(Value->at(2).ToFloat()),
+				static_cast<float>(Value->at(3).ToFloat())
+			};
+			return true;
+		}
+
+		if (bInUseLog)
+			UE_LOG("[JsonSerializer] %.*s Vector4 파싱에 실패했습니다 (기본값 사용)", static_cast<int>(InKey.size()), InKey.data());
+
+		OutValue = InDefaultValue;
+		return false;
+	}
+
 	//====================================================================================
 	// Converting To JSON
 	//====================================================================================
@@ -362,21 +555,46 @@ public:
 		}
 	}
 
+	/**
+	 * @brief 파일 전체를 읽어 FJsonDocument로 파싱합니다. 레벨/프리팹 로드는 이 경로를 사용합니다.
+	 * @return 파일을 열 수 없거나 문법 오류가 있으면 false (오류는 로그로 남김)
+	 */
+	static bool LoadJsonDocumentFromFile(FJsonDocument& OutDocument, const FWideString& InFilePath)
+	{
+		std::ifstream File(InFilePath, std::ios::binary | std::ios::ate);
+		if (!File.is_open())
+		{
+			return false;
+		}
+
+		FString FileContent;
+		FileContent.resize(static_cast<size_t>(File.tellg()));
+		File.seekg(0);
+		File.read(FileContent.data(), static_cast<std::streamsize>(FileContent.size()));
+		File.close();
+
+		if (!OutDocument.Parse(std::move(FileContent)))
+		{
+			UE_LOG("[error] [JsonSerializer] JSON 파싱 실패: %s - %s", WideToUTF8(InFilePath).c_str(), OutDocument.GetError().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 파일을 json::JSON으로 읽습니다. 파싱은 FJsonDocument로 하고 결과를 이동으로 옮겨 붙입니다.
+	 */
 	static bool LoadJsonFromFile(JSON& OutJson, const FWideString& InFilePath)
 	{
 		try
 		{
-			std::ifstream File(InFilePath);
-			if (!File.is_open())
+			FJsonDocument Document;
+			if (!LoadJsonDocumentFromFile(Document, InFilePath))
 			{
 				return false;
 			}
 
-			FString FileContent((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
-			File.close();
-
-			std::cout << "[JsonSerializer] File Content Length: " << FileContent.length() << "\n";
-			OutJson = JSON::Load(FileContent);
+			OutJson = Document.GetRoot().ToJSON();
 			return true;
 		}
 		catch (const std::exception&)
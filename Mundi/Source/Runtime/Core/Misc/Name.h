@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -15,11 +16,21 @@ struct FNameEntry
     FString Comparison; // lower-case
 };
 
+// 스레드 안전: 조회는 공유 락, 새 이름 등록만 배타 락. 항목은 청크에 저장되어 주소가 바뀌지 않음
 class FNamePool
 {
 public:
+    static constexpr uint32 InvalidIndex = UINT32_MAX;
+
     static uint32 Add(const FString& InStr);
+    // 소문자 사본 없이 대소문자 무시 해시(ComputeHash)로 조회, 없을 때만 등록
+    static uint32 Add(const char* InStr, size_t InLen, uint32 InHash);
+    // 등록하지 않고 조회만 (없으면 InvalidIndex)
+    static uint32 Find(const char* InStr, size_t InLen, uint32 InHash);
+    static uint32 ComputeHash(const char* InStr, size_t InLen);
+
     static const FNameEntry& Get(uint32 Index);
+    static uint32 Num();
 };
 
 // ──────────────────────────────
@@ -31,18 +42,30 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(InStr ? InStr : "", InStr ? std::strlen(InStr) : 0); }
+    FName(const FString& InStr) { Init(InStr.data(), InStr.size()); }
 
-    void Init(const FString& InStr)
+    void Init(const char* InStr, size_t InLen)
     {
-        int32_t Index = FNamePool::Add(InStr);
+        uint32 Index = FNamePool::Add(InStr, InLen, FNamePool::ComputeHash(InStr, InLen));
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
 
+    // 풀에 없는 이름이면 새로 등록하지 않고 None(빈 FName) 반환
+    static FName Find(const FString& InStr)
+    {
+        FName Result;
+        const uint32 Index = FNamePool::Find(InStr.data(), InStr.size(), FNamePool::ComputeHash(InStr.data(), InStr.size()));
+        Result.DisplayIndex = Index;
+        Result.ComparisonIndex = Index;
+        return Result;
+    }
+
+    bool IsNone() const { return ComparisonIndex == FNamePool::InvalidIndex; }
+
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    const FString& ToString() const { return FNamePool::Get(DisplayIndex).Display; }
 
     bool Empty() const { return ToString().empty(); }
     
@@ -2,26 +2,42 @@
 
 #include "ObjectFactory.h"
 
+// TObject와 그 하위 클래스의 살아 있는 객체를 순회
+// - 클래스 트리가 구성된 경우: TObject의 DFS 구간에 속한 클래스들의 Instances만 방문 (GUObjectArray 전체 스캔 없음)
+// - 그 외(BuildClassTree 이전, 늦게 등록된 TObject): GUObjectArray를 IsA로 스캔
+// 주의: 순회 중 TObject 계열 객체를 즉시 삭제하면 swap-remove로 인해 일부 객체를 건너뛸 수 있음 (Destroy 등 지연 삭제 사용)
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
 	{
+		bUseClassTree = TObject::StaticClass()->TreeIndexBegin >= 0;
 		++(*this); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
-		AdvanceToNextValidObject();
+		if (bUseClassTree)
+		{
+			AdvanceInClassTree();
+		}
+		else
+		{
+			++CurrentIndex;
+			AdvanceToNextValidObject();
+		}
 		return *this;
 	}
 
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
+		if (bUseClassTree)
+		{
+			return static_cast<TObject*>(CurrentObject);
+		}
 		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
 		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
 	}
@@ -35,17 +51,67 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return CurrentIndex != Other.CurrentIndex || CurrentObject != Other.CurrentObject;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
+		if (bUseClassTree)
+		{
+			return CurrentObject != nullptr;
+		}
 		// CurrentIndex가 배열 범위 내에 있는지 확인
 		return CurrentIndex < GUObjectArray.Num();
 	}
 
 private:
+	// 현재 클래스의 다음 인스턴스, 없으면 다음 하위 클래스로 이동
+	void AdvanceInClassTree()
+	{
+		++InstanceIndex;
+		while (true)
+		{
+			if (CurrentClass && InstanceIndex < CurrentClass->Instances.Num())
+			{
+				CurrentObject = CurrentClass->Instances[InstanceIndex];
+				return;
+			}
+
+			CurrentClass = NextClass();
+			InstanceIndex = 0;
+			if (!CurrentClass)
+			{
+				CurrentObject = nullptr;
+				return;
+			}
+		}
+	}
+
+	// DFS 구간 [TreeIndexBegin, TreeIndexEnd)의 클래스 다음, 트리 생성 이후 등록된 하위 클래스
+	UClass* NextClass()
+	{
+		const UClass* Base = TObject::StaticClass();
+		const TArray<UClass*>& TreeOrder = UClass::GetClassTreeOrder();
+		const TArray<UClass*>& LateClasses = UClass::GetLateClasses();
+		const int32 NumTreeClasses = Base->TreeIndexEnd - Base->TreeIndexBegin;
+
+		while (++ClassCursor < NumTreeClasses + LateClasses.Num())
+		{
+			if (ClassCursor < NumTreeClasses)
+			{
+				return TreeOrder[Base->TreeIndexBegin + ClassCursor];
+			}
+
+			UClass* LateClass = LateClasses[ClassCursor - NumTreeClasses];
+			if (LateClass->IsChildOf(Base))
+			{
+				return LateClass;
+			}
+		}
+		return nullptr;
+	}
+
 	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
 	void AdvanceToNextValidObject()
 	{
@@ -64,5 +130,14 @@ private:
 	}
 
 private:
+	bool bUseClassTree = false;
+
+	// GUObjectArray 스캔 상태
 	int32 CurrentIndex = -1;
+
+	// 클래스 트리 순회 상태
+	int32 ClassCursor = -1;
+	int32 InstanceIndex = -1;
+	UClass* CurrentClass = nullptr;
+	UObject* CurrentObject = nullptr;
 };
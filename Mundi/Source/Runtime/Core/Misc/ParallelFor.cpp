@@ -0,0 +1,69 @@
+﻿#include "pch.h"
+#include "ParallelFor.h"
+#include "JobSystem.h"
+
+void ParallelFor::Run(int32 Num, int32 MinBatchSize, const std::function<void(int32 Begin, int32 End)>& Body)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    FJobSystem& JobSystem = FJobSystem::Get();
+    const int32 NumThreads = JobSystem.GetNumWorkers() + 1;
+    MinBatchSize = std::max(1, MinBatchSize);
+
+    // 작업이 작거나 워커가 없으면 그냥 호출 스레드에서 실행
+    if (NumThreads <= 1 || Num <= MinBatchSize)
+    {
+        Body(0, Num);
+        return;
+    }
+
+    // 스레드당 4개 정도의 청크로 나눠 불균형을 줄임
+    const int32 ChunkSize = std::max(MinBatchSize, (Num + NumThreads * 4 - 1) / (NumThreads * 4));
+    const int32 NumChunks = (Num + ChunkSize - 1) / ChunkSize;
+
+    // 청크는 작업마다 고정하지 않고 공유 카운터에서 꺼내감 (먼저 끝난 스레드가 더 가져감)
+    std::atomic<int32> NextChunk{ 0 };
+    auto ProcessChunks = [&]()
+    {
+        while (true)
+        {
+            const int32 Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (Chunk >= NumChunks)
+            {
+                return;
+            }
+
+            const int32 Begin = Chunk * ChunkSize;
+            const int32 End = std::min(Begin + ChunkSize, Num);
+            Body(Begin, End);
+        }
+    };
+
+    // 호출 스레드가 하나를 맡으므로 나머지 스레드 수만큼만 작업을 배포
+    FJobGroup Group;
+    const int32 NumJobs = std::min(NumChunks, NumThreads) - 1;
+    for (int32 i = 0; i < NumJobs; ++i)
+    {
+        JobSystem.Dispatch(Group, ProcessChunks);
+    }
+
+    // 호출 스레드 몫이 예외를 던져도 Group(스택)을 쥔 작업이 남아 있으므로 먼저 기다린 뒤 다시 던짐
+    try
+    {
+        ProcessChunks();
+    }
+    catch (...)
+    {
+        JobSystem.Wait(Group);
+        throw;
+    }
+    JobSystem.Wait(Group);
+}
+
+int32 ParallelFor::GetNumWorkers()
+{
+    return FJobSystem::Get().GetNumWorkers();
+}
@@ -0,0 +1,18 @@
+﻿#pragma once
+#include <functional>
+
+// ─────────────────────────────────────────────
+// ParallelFor
+//  - [0, Num) 구간을 청크로 나눠 FJobSystem 워커와 호출 스레드가 함께 처리
+//  - 모든 청크가 끝날 때까지 호출 스레드는 반환하지 않음
+//  - Body는 서로 겹치지 않는 구간만 받으므로, 구간 밖 공유 상태를 쓰지 않으면 동기화가 필요 없음
+//  - 작업(또는 다른 ParallelFor) 안에서 다시 호출해도 대기 스레드가 작업을 대신 처리하므로 교착되지 않음
+// ─────────────────────────────────────────────
+namespace ParallelFor
+{
+    // 청크 하나의 최소 원소 수 (너무 작은 작업은 스레드 깨우는 비용이 더 큼)
+    void Run(int32 Num, int32 MinBatchSize, const std::function<void(int32 Begin, int32 End)>& Body);
+
+    // 호출 스레드를 제외한 워커 수
+    int32 GetNumWorkers();
+}
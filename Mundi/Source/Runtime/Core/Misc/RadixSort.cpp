@@ -0,0 +1,86 @@
+﻿#include "pch.h"
+#include "RadixSort.h"
+
+namespace
+{
+    // 이보다 작으면 히스토그램 비용이 더 크므로 삽입 정렬 (역시 안정 정렬)
+    constexpr int32 InsertionSortThreshold = 64;
+
+    void InsertionSortByKey(TArray<FRadixSortEntry>& Entries)
+    {
+        const int32 Num = Entries.Num();
+        for (int32 i = 1; i < Num; ++i)
+        {
+            const FRadixSortEntry Item = Entries[i];
+            int32 j = i - 1;
+            while (j >= 0 && Entries[j].Key > Item.Key)
+            {
+                Entries[j + 1] = Entries[j];
+                --j;
+            }
+            Entries[j + 1] = Item;
+        }
+    }
+}
+
+void RadixSort::SortByKey(TArray<FRadixSortEntry>& Entries, TArray<FRadixSortEntry>& Scratch)
+{
+    const int32 Num = Entries.Num();
+    if (Num < InsertionSortThreshold)
+    {
+        InsertionSortByKey(Entries);
+        return;
+    }
+
+    // 1. 8개 바이트 자리의 히스토그램을 한 번의 순회로 계산
+    uint32 Histograms[8][256] = {};
+    for (const FRadixSortEntry& Entry : Entries)
+    {
+        const uint64 Key = Entry.Key;
+        for (int32 Pass = 0; Pass < 8; ++Pass)
+        {
+            ++Histograms[Pass][(Key >> (Pass * 8)) & 0xFF];
+        }
+    }
+
+    Scratch.resize(Num);
+    FRadixSortEntry* Src = Entries.data();
+    FRadixSortEntry* Dst = Scratch.data();
+
+    for (int32 Pass = 0; Pass < 8; ++Pass)
+    {
+        uint32* Counts = Histograms[Pass];
+
+        // 모든 키가 이 바이트에서 같은 값이면 순서가 바뀌지 않으므로 건너뜀
+        const uint8 FirstByte = static_cast<uint8>((Src[0].Key >> (Pass * 8)) & 0xFF);
+        if (Counts[FirstByte] == static_cast<uint32>(Num))
+        {
+            continue;
+        }
+
+        // 2. 누적합으로 버킷 시작 위치 계산
+        uint32 Offset = 0;
+        for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+        {
+            const uint32 Count = Counts[Bucket];
+            Counts[Bucket] = Offset;
+            Offset += Count;
+        }
+
+        // 3. 안정적으로 흩뿌리기
+        const int32 Shift = Pass * 8;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            const FRadixSortEntry& Entry = Src[i];
+            Dst[Counts[(Entry.Key >> Shift) & 0xFF]++] = Entry;
+        }
+
+        std::swap(Src, Dst);
+    }
+
+    // 홀수 번 흩뿌렸으면 결과가 Scratch에 있음 (벡터 교환은 포인터만 바꿈)
+    if (Src != Entries.data())
+    {
+        Entries.swap(Scratch);
+    }
+}
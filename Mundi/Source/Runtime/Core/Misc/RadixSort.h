@@ -0,0 +1,20 @@
+﻿#pragma once
+
+// ─────────────────────────────────────────────
+// RadixSort
+//  - 64비트 키를 8비트씩 8패스로 나눠 정렬하는 LSD 기수 정렬
+//  - 안정 정렬: 키가 같으면 입력 순서를 유지
+//  - 모든 원소가 같은 값을 갖는 바이트 자리는 패스를 건너뜀 (키 상위 비트가 비어 있으면 그만큼 빨라짐)
+// ─────────────────────────────────────────────
+struct FRadixSortEntry
+{
+    uint64 Key = 0;
+    uint32 Index = 0;   // 정렬 대상 배열에서의 원래 위치
+};
+
+namespace RadixSort
+{
+    // Entries를 Key 오름차순으로 정렬
+    // Scratch는 핑퐁용 임시 버퍼 (크기는 내부에서 맞추므로 프레임 간 재사용하면 재할당이 없음)
+    void SortByKey(TArray<FRadixSortEntry>& Entries, TArray<FRadixSortEntry>& Scratch);
+}
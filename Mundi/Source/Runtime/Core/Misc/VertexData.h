@@ -109,17 +109,56 @@ struct FBillboardVertex
 // FVertexDynamic을 상속하여 Skinning 데이터만 추가
 struct FSkinnedVertex : public FVertexDynamic
 {
-    // Skinning 데이터 (최대 4개의 본 영향)
-    class UBone* BonePointers[4];   // 영향을 주는 본의 포인터 (직접 참조)
-    float BoneWeights[4];            // 각 본의 가중치 (합=1.0)
+    static constexpr uint16 InvalidBoneIndex = 0xFFFF;
+    static constexpr float WeightScale = 1.0f / 255.0f;
+
+    // Skinning 데이터 (최대 4개의 본 영향, 가중치 내림차순)
+    uint16 BoneIndices[4];          // USkeleton::GetBones() 기준 본 인덱스
+    uint8 BoneWeights[4];           // 0~255로 양자화된 가중치 (합=255)
 
     FSkinnedVertex()
         : FVertexDynamic()
     {
         for (int i = 0; i < 4; i++)
         {
-            BonePointers[i] = nullptr;
-            BoneWeights[i] = 0.0f;
+            BoneIndices[i] = InvalidBoneIndex;
+            BoneWeights[i] = 0;
+        }
+    }
+
+    float GetBoneWeight(int InfluenceIndex) const
+    {
+        return BoneWeights[InfluenceIndex] * WeightScale;
+    }
+
+    // 정규화된 가중치(합=1)를 양자화해서 저장, 반올림 오차는 가장 큰 가중치에 몰아줌
+    void SetBoneInfluences(const uint16 InBoneIndices[4], const float InWeights[4], int InfluenceCount)
+    {
+        int Total = 0;
+        int Largest = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            if (i < InfluenceCount)
+            {
+                const float Clamped = InWeights[i] < 0.0f ? 0.0f : (InWeights[i] > 1.0f ? 1.0f : InWeights[i]);
+                BoneIndices[i] = InBoneIndices[i];
+                BoneWeights[i] = static_cast<uint8>(Clamped * 255.0f + 0.5f);
+                Total += BoneWeights[i];
+                if (BoneWeights[i] > BoneWeights[Largest])
+                {
+                    Largest = i;
+                }
+            }
+            else
+            {
+                BoneIndices[i] = InvalidBoneIndex;
+                BoneWeights[i] = 0;
+            }
+        }
+
+        if (InfluenceCount > 0 && Total > 0)
+        {
+            BoneWeights[Largest] = static_cast<uint8>(BoneWeights[Largest] + (255 - Total));
         }
     }
 };
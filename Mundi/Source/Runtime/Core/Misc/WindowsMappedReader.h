@@ -0,0 +1,100 @@
+﻿#pragma once
+#include "Archive.h"
+#include "UEContainer.h"
+#include "PathUtils.h"
+
+// 메모리 매핑 파일 기반 읽기 아카이브
+// - 파일 전체를 한 번에 매핑하고 Serialize/ReadView는 매핑된 메모리에서 바로 읽음 (스트림 버퍼 복사 없음)
+// - GetData()/GetSize()로 캐시 블롭을 제자리에서 해석할 수 있음 (리더가 살아있는 동안만 유효)
+// - 파일 끝을 넘어서 읽으면 예외를 던져 캐시 손상으로 처리됨
+class FWindowsMappedReader : public FArchive
+{
+public:
+    FWindowsMappedReader(const FString& Filename)
+        : FArchive(true, false) // Loading 모드
+    {
+        FileHandle = ::CreateFileW(UTF8ToWide(Filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (FileHandle == INVALID_HANDLE_VALUE)
+        {
+            FileHandle = nullptr;
+            return;
+        }
+
+        LARGE_INTEGER FileSize = {};
+        if (!::GetFileSizeEx(FileHandle, &FileSize))
+        {
+            Close();
+            return;
+        }
+        Size = static_cast<int64>(FileSize.QuadPart);
+
+        // 빈 파일은 매핑할 수 없으므로 열린 상태로만 둠 (읽기 시도 시 예외)
+        if (Size > 0)
+        {
+            MappingHandle = ::CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (MappingHandle)
+            {
+                Data = static_cast<const uint8*>(::MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+            }
+            if (!Data)
+            {
+                Close();
+                return;
+            }
+        }
+        bIsOpen = true;
+    }
+    ~FWindowsMappedReader() { Close(); }
+
+    FWindowsMappedReader(const FWindowsMappedReader&) = delete;
+    FWindowsMappedReader& operator=(const FWindowsMappedReader&) = delete;
+
+    // 파일이 성공적으로 열렸는지 확인하는 메서드
+    bool IsOpen() const
+    {
+        return bIsOpen;
+    }
+
+    void Serialize(void* OutData, int64 Length) override
+    {
+        const uint8* View = ReadView(Length);
+        if (Length > 0)
+            memcpy(OutData, View, static_cast<size_t>(Length));
+    }
+
+    const uint8* ReadView(int64 Length) override
+    {
+        if (Length < 0 || Length > Size - Position)
+        {
+            throw std::runtime_error("Cache corrupt: Unexpected end of file.");
+        }
+        const uint8* View = Data + Position;
+        Position += Length;
+        return View;
+    }
+
+    bool Close() override
+    {
+        const bool bWasOpen = bIsOpen;
+        if (Data) { ::UnmapViewOfFile(Data); Data = nullptr; }
+        if (MappingHandle) { ::CloseHandle(MappingHandle); MappingHandle = nullptr; }
+        if (FileHandle) { ::CloseHandle(FileHandle); FileHandle = nullptr; }
+        Size = 0;
+        Position = 0;
+        bIsOpen = false;
+        return bWasOpen;
+    }
+
+    const uint8* GetData() const { return Data; }
+    int64 GetSize() const { return Size; }
+    int64 Tell() const { return Position; }
+
+private:
+    HANDLE FileHandle = nullptr;
+    HANDLE MappingHandle = nullptr;
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    int64 Position = 0;
+    bool bIsOpen = false;
+};
@@ -61,15 +61,32 @@ void AActor::Tick(float DeltaSeconds)
 	// 에디터에서 틱 Off면 스킵
 	if (!bTickInEditor && World->bPie == false) return;
 	
+	// PrePhysics 그룹의 직렬 컴포넌트만 여기서 틱 (나머지는 FTickTaskManager가 그룹 순서대로 처리)
+	TickComponentsInGroup(ETickGroup::PrePhysics, DeltaSeconds);
+}
+
+void AActor::TickComponentsInGroup(ETickGroup Group, float DeltaSeconds)
+{
 	for (UActorComponent* Comp : OwnedComponents)
 	{
-		if (Comp && Comp->IsComponentTickEnabled())
+		if (Comp && Comp->GetTickGroup() == Group && !Comp->CanTickInParallel() && Comp->IsComponentTickEnabled())
 		{
 			Comp->TickComponent(DeltaSeconds /*, … 필요 인자*/);
 		}
 	}
 }
 
+void AActor::TickParallelComponentsInGroup(ETickGroup Group, float DeltaSeconds)
+{
+	for (UActorComponent* Comp : OwnedComponents)
+	{
+		if (Comp && Comp->GetTickGroup() == Group && Comp->CanTickInParallel() && Comp->IsComponentTickEnabled())
+		{
+			Comp->TickComponent(DeltaSeconds);
+		}
+	}
+}
+
 void AActor::EndPlay()
 {
 	for (UActorComponent* Comp : OwnedComponents)
@@ -575,6 +592,7 @@ void AActor::DuplicateSubObjects()
 	// 기본 프로퍼티 초기화
 	bIsPicked = false;
 	bIsCulled = false;
+	bIsArchetype = false;
 	World = nullptr; // PIE World는 복제 프로세스의 상위 레벨에서 설정해 주어야 합니다.
 
 	if (OwnedComponents.IsEmpty())
@@ -686,51 +704,7 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		JSON ComponentsJson;
 		if (FJsonSerializer::ReadArray(InOutHandle, "OwnedComponents", ComponentsJson))
 		{
-			// 1) OwnedComponents와 SceneComponents에 Component들 추가
-			for (uint32 i = 0; i < static_cast<uint32>(ComponentsJson.size()); ++i)
-			{
-				JSON ComponentJson = ComponentsJson.at(i);
-				
-				FString TypeString;
-				FJsonSerializer::ReadString(ComponentJson, "Type", TypeString);
-	
-				UClass* NewClass = UClass::FindClass(TypeString);
-	
-				UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(NewClass));
-	
-				NewComponent->Serialize(bInIsLoading, ComponentJson);
-	
-				// RootComponent 설정
-				if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
-				{
-					if (RootUUID == NewSceneComponent->GetSceneId())
-					{
-						assert(NewSceneComponent);
-						SetRootComponent(NewSceneComponent);
-					}
-				}
-	
-				// OwnedComponents와 SceneComponents에 Component 추가
-				AddOwnedComponent(NewComponent);
-			}
-	
-			// 2) 컴포넌트 간 부모 자식 관계 설정
-			for (auto& Component : OwnedComponents)
-			{
-				USceneComponent* SceneComp = Cast<USceneComponent>(Component);
-				if (!SceneComp)
-				{
-					continue;
-				}
-				uint32 ParentId = SceneComp->GetParentId();
-				if (ParentId != 0) // RootComponent가 아니면 부모 설정
-				{
-					USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
-					USceneComponent* Parent = *ParentP;
-	
-					SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
-				}
-			}
+			LoadOwnedComponents(ComponentsJson, RootUUID);
 		}
 	}
 	else if (RootComponent)
@@ -758,6 +732,73 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void AActor::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+
+	// Serialize 로드 분기와 같은 순서 (컴포넌트 노드도 json::JSON으로 바꾸지 않고 LoadFromNode로 넘김)
+	DestroyAllComponents();
+
+	uint32 RootUUID;
+	FJsonSerializer::ReadUint32(InNode, "RootComponentId", RootUUID);
+
+	const FJsonValue* ComponentsNode = nullptr;
+	if (FJsonSerializer::ReadArray(InNode, "OwnedComponents", ComponentsNode))
+	{
+		LoadOwnedComponents(*ComponentsNode, RootUUID);
+	}
+}
+
+template<typename TJsonArray>
+void AActor::LoadOwnedComponents(TJsonArray& ComponentsArray, uint32 RootUUID)
+{
+	// 1) OwnedComponents와 SceneComponents에 Component들 추가
+	for (uint32 i = 0; i < static_cast<uint32>(ComponentsArray.size()); ++i)
+	{
+		auto& ComponentJson = ComponentsArray.at(i);
+
+		FString TypeString;
+		FJsonSerializer::ReadString(ComponentJson, "Type", TypeString);
+
+		UClass* NewClass = UClass::FindClass(TypeString);
+
+		UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(NewClass));
+
+		NewComponent->LoadFrom(ComponentJson);
+
+		// RootComponent 설정
+		if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
+		{
+			if (RootUUID == NewSceneComponent->GetSceneId())
+			{
+				assert(NewSceneComponent);
+				SetRootComponent(NewSceneComponent);
+			}
+		}
+
+		// OwnedComponents와 SceneComponents에 Component 추가
+		AddOwnedComponent(NewComponent);
+	}
+
+	// 2) 컴포넌트 간 부모 자식 관계 설정
+	for (auto& Component : OwnedComponents)
+	{
+		USceneComponent* SceneComp = Cast<USceneComponent>(Component);
+		if (!SceneComp)
+		{
+			continue;
+		}
+		uint32 ParentId = SceneComp->GetParentId();
+		if (ParentId != 0) // RootComponent가 아니면 부모 설정
+		{
+			USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
+			USceneComponent* Parent = *ParentP;
+
+			SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
+		}
+	}
+}
+
 void AActor::RegisterComponentTree(USceneComponent* SceneComp, UWorld* InWorld)
 {
 	if (!SceneComp)
@@ -33,6 +33,8 @@ public:
     // 수명
     virtual void BeginPlay();   // Override 시 Super::BeginPlay() 권장
     virtual void Tick(float DeltaSeconds);   // Override 시 Super::Tick() 권장
+    void TickComponentsInGroup(ETickGroup Group, float DeltaSeconds);          // 직렬 컴포넌트 (메인 스레드)
+    void TickParallelComponentsInGroup(ETickGroup Group, float DeltaSeconds);  // CanTickInParallel 컴포넌트 (워커 가능)
     virtual void EndPlay();   // Override 시 Super::EndPlay() 권장
     virtual void Destroy();
 
@@ -80,6 +82,11 @@ public:
     bool IsPendingDestroy() const { return bPendingDestroy; }
     void MarkPendingDestroy() { bPendingDestroy = true; }
 
+    // ===== 프리팹 아키타입 (FPrefabCache가 보관하는 복제 원본, 월드/레벨에 속하지 않음) =====
+    // TObjectIterator<AActor> 같은 전역 순회에서는 건너뛰어야 함. Duplicate()로 만든 사본에는 전달되지 않음
+    bool IsArchetype() const { return bIsArchetype; }
+    void MarkAsArchetype() { bIsArchetype = true; }
+
     // ───────────────
     // Transform API
     // ───────────────
@@ -165,6 +172,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
 
     FGameObject* GetGameObject() const
     {
@@ -195,6 +203,7 @@ protected:
     bool bHiddenInEditor = false;
 
     bool bPendingDestroy = false;
+    bool bIsArchetype = false;
 
     bool bIsPicked = false;
     bool bCanEverTick = true;   // Tick을 허용하는 Actor 라는 뜻 (생성자 시점에만 변경해야 됨)
@@ -203,5 +212,9 @@ protected:
     float CustomTimeDillation;
 
 private:
+    // 생성자 컴포넌트를 지우고 저장된 컴포넌트 목록으로 다시 구성 (json::JSON / 문서 노드 공용)
+    template<typename TJsonArray>
+    void LoadOwnedComponents(TJsonArray& ComponentsArray, uint32 RootUUID);
+
     FGameObject* LuaGameObject = nullptr;
 };
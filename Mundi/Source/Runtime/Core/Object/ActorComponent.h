@@ -29,6 +29,11 @@ public:
     virtual void OnUnregister();                       // 내부 훅 (오버라이드 지점)
     void DestroyComponent();                           // 소멸
 
+    // ─────────────── 액터 풀 (FActorPool)
+    // 등록 상태와 할당은 유지한 채 렌더/충돌에서만 빠지거나 다시 참여
+    virtual void OnReleasedToPool() {}                 // 반납 시: 일시 상태 초기화 (오버라이드 시 Super 호출)
+    virtual void OnAcquiredFromPool() {}               // 재사용 시
+
     // ─────────────── 활성화/틱
     void SetActive(bool bNewActive) { bIsActive = bNewActive; }
     bool IsActive() const { return bIsActive; }
@@ -44,6 +49,15 @@ public:
 
     bool CanEverTick() const { return bCanEverTick; }
 
+    // 틱 그룹 - FTickTaskManager가 그룹 순서대로 실행
+    void SetTickGroup(ETickGroup InGroup) { TickGroup = InGroup; }
+    ETickGroup GetTickGroup() const { return TickGroup; }
+
+    // true면 워커 스레드에서 다른 컴포넌트와 동시에 틱될 수 있음
+    // 자기 소유 상태(자신/Owner 트랜스폼)만 쓰고 월드/다른 액터를 건드리지 않는 컴포넌트만 켤 것
+    // 켜면 같은 틱 그룹의 직렬 컴포넌트가 모두 틱한 뒤에 틱함 (OwnedComponents 순서와 무관, FTickTaskManager 참고)
+    virtual bool CanTickInParallel() const { return bTickInParallel; }
+
     bool IsComponentTickEnabled() const
     {
         // 틱을 진짜 돌릴지 최종 판단(액터 Tick에서 이걸로 거른다)
@@ -79,6 +93,8 @@ protected:
     bool bIsNative = false;      // 액터의 기본 구성 컴포넌트인지 여부. 활성화되면 보호되어 UI에서 삭제 불가 상태가 됨 
     bool bIsEditable = true;    //UI에서 Edit이 가능한가
     bool bCanEverTick = false;   // 컴포넌트 설계상 틱 지원 여부
+    bool bTickInParallel = false; // 워커 스레드 병렬 틱 허용 여부
+    ETickGroup TickGroup = ETickGroup::PrePhysics;
 
     // 설정 가능한 데이터
     bool bIsActive = true;       // 활성 상태(사용자 on/off), 물리 적용
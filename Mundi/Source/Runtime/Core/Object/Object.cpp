@@ -1,4 +1,69 @@
 ﻿#include "pch.h"
+#include "Actor.h"
+#include "ObjectIterator.h"
+#include "BinarySerializer.h"
+
+namespace
+{
+    void AssignClassTreeIndex(UClass* Class, const TMap<const UClass*, TArray<UClass*>>& Children, TArray<UClass*>& OutOrder)
+    {
+        Class->TreeIndexBegin = OutOrder.Add(Class);
+        if (const TArray<UClass*>* ChildClasses = Children.Find(Class))
+        {
+            for (UClass* Child : *ChildClasses)
+            {
+                AssignClassTreeIndex(Child, Children, OutOrder);
+            }
+        }
+        Class->TreeIndexEnd = OutOrder.Num();
+    }
+}
+
+void UClass::BuildClassTree()
+{
+    // 등록된 클래스 + 부모 체인 (UObject처럼 SignUpClass를 거치지 않는 루트 포함)
+    TArray<UClass*> Classes;
+    TSet<const UClass*> Visited;
+    for (UClass* Class : GetAllClasses())
+    {
+        for (const UClass* It = Class; It && !Visited.Contains(It); It = It->Super)
+        {
+            Visited.Add(It);
+            Classes.Add(const_cast<UClass*>(It));
+        }
+    }
+
+    // 이름순 정렬: 정적 초기화 순서와 무관하게 같은 인덱스가 나오도록
+    std::sort(Classes.begin(), Classes.end(), [](const UClass* A, const UClass* B)
+    {
+        return FString(A->Name) < FString(B->Name);
+    });
+
+    TMap<const UClass*, TArray<UClass*>> Children;
+    TArray<UClass*> Roots;
+    for (UClass* Class : Classes)
+    {
+        if (Class->Super)
+        {
+            Children[Class->Super].Add(Class);
+        }
+        else
+        {
+            Roots.Add(Class);
+        }
+    }
+
+    TArray<UClass*>& TreeOrder = GetClassTreeOrder();
+    TreeOrder.clear();
+    TreeOrder.reserve(Classes.Num());
+    for (UClass* Root : Roots)
+    {
+        AssignClassTreeIndex(Root, Children, TreeOrder);
+    }
+    GetLateClasses().clear();
+
+    UE_LOG("ClassTree: %d classes indexed", TreeOrder.Num());
+}
 
 FString UObject::GetName()
 {
@@ -10,9 +75,235 @@ FString UObject::GetComparisonName()
     return FString();
 }
 
+namespace
+{
+    // 배열 프로퍼티 노드 (복사하지 않고 원본을 가리킴)
+    const JSON* FindArrayProperty(const JSON& InNode, const char* InKey)
+    {
+        if (InNode.hasKey(InKey))
+        {
+            const JSON& Value = InNode.at(InKey);
+            if (Value.JSONType() == JSON::Class::Array)
+            {
+                return &Value;
+            }
+        }
+        return nullptr;
+    }
+
+    const FJsonValue* FindArrayProperty(const FJsonValue& InNode, const char* InKey)
+    {
+        const FJsonValue* Value = InNode.Find(InKey);
+        return (Value && Value->IsArray()) ? Value : nullptr;
+    }
+
+    template<typename TAsset>
+    void LoadAssetProperty(TAsset** Value, const FString& AssetPath)
+    {
+        if (!AssetPath.empty())
+        {
+            *Value = UResourceManager::GetInstance().Load<TAsset>(AssetPath);
+        }
+        else
+        {
+            *Value = nullptr;
+        }
+    }
+
+    // 리플렉션 프로퍼티 로드 루프 (json::JSON / FJsonValue 공용)
+    // FJsonSerializer::Read* 오버로드와 두 노드 타입의 같은 이름 읽기 함수(size/at/ToFloat...)로 동작
+    template<typename TJsonNode>
+    void LoadPropertiesFrom(UObject* Object, const TJsonNode& InNode)
+    {
+        // 바이너리 파일 로드 중이면 JSON 골격에는 레코드 번호만 있으므로 레코드에서 바로 읽음
+        int32 RecordIndex;
+        if (FBinarySerializer::IsLoading()
+            && FJsonSerializer::ReadInt32(InNode, FBinarySerializer::RecordKey, RecordIndex, -1, false)
+            && FBinarySerializer::TryLoadProperties(Object, RecordIndex))
+        {
+            return;
+        }
+
+        const TArray<FProperty>& Properties = Object->GetClass()->GetAllProperties();
+
+        for (const FProperty& Prop : Properties)
+        {
+            switch (Prop.Type)
+            {
+            case EPropertyType::Bool:
+            {
+                bool ReadValue;
+                if (FJsonSerializer::ReadBool(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<bool>(Object) = ReadValue;
+                }
+                break;
+            }
+            case EPropertyType::Int32:
+            {
+                int32 ReadValue;
+                if (FJsonSerializer::ReadInt32(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<int32>(Object) = ReadValue;
+                }
+                break;
+            }
+            case EPropertyType::Float:
+            {
+                float ReadValue;
+                if (FJsonSerializer::ReadFloat(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<float>(Object) = ReadValue;
+                }
+                break;
+            }
+            case EPropertyType::FVector:
+            {
+                FVector ReadValue;
+                if (FJsonSerializer::ReadVector(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<FVector>(Object) = ReadValue;
+                }
+                break;
+            }
+            case EPropertyType::FLinearColor:
+            {
+                FVector4 ReadValue;
+                if (FJsonSerializer::ReadVector4(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<FLinearColor>(Object) = FLinearColor(ReadValue);
+                }
+                break;
+            }
+            case EPropertyType::FString:
+            case EPropertyType::ScriptFile:
+            {
+                FString ReadValue;
+                if (FJsonSerializer::ReadString(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<FString>(Object) = ReadValue;
+                }
+                break;
+            }
+            case EPropertyType::FName:
+            {
+                FString ReadValue;
+                if (FJsonSerializer::ReadString(InNode, Prop.Name, ReadValue))
+                {
+                    *Prop.GetValuePtr<FName>(Object) = FName(ReadValue);
+                }
+                break;
+            }
+            case EPropertyType::Texture:
+            {
+                FString TexturePath;
+                FJsonSerializer::ReadString(InNode, Prop.Name, TexturePath);
+                LoadAssetProperty(Prop.GetValuePtr<UTexture*>(Object), TexturePath);
+                break;
+            }
+            case EPropertyType::StaticMesh:
+            {
+                FString MeshPath;
+                FJsonSerializer::ReadString(InNode, Prop.Name, MeshPath);
+                LoadAssetProperty(Prop.GetValuePtr<UStaticMesh*>(Object), MeshPath);
+                break;
+            }
+            case EPropertyType::SkeletalMesh:
+            {
+                FString MeshPath;
+                FJsonSerializer::ReadString(InNode, Prop.Name, MeshPath);
+                LoadAssetProperty(Prop.GetValuePtr<USkeletalMesh*>(Object), MeshPath);
+                break;
+            }
+            case EPropertyType::Material:
+            {
+                FString MaterialPath;
+                FJsonSerializer::ReadString(InNode, Prop.Name, MaterialPath);
+                LoadAssetProperty(Prop.GetValuePtr<UMaterial*>(Object), MaterialPath);
+                break;
+            }
+            case EPropertyType::Curve:
+            {
+                // Curve 프로퍼티는 float[4] 배열입니다. 따라서 FVector4로 처리
+                FVector4 TempVec4;
+                if (FJsonSerializer::ReadVector4(InNode, Prop.Name, TempVec4))
+                {
+                    memcpy(Prop.GetValuePtr<float>(Object), &TempVec4, sizeof(float) * 4);
+                }
+                break;
+            }
+            case EPropertyType::Array:
+            {
+                if (Prop.InnerType == EPropertyType::Unknown)
+                {
+                    UE_LOG("[AutoSerialize] Array property '%s' has Unknown InnerType, skipping.", Prop.Name);
+                    break;
+                }
+
+                const TJsonNode* ArrayJson = FindArrayProperty(InNode, Prop.Name);
+                if (!ArrayJson)
+                {
+                    break; // 배열이 없거나 유효하지 않음
+                }
+
+                switch (Prop.InnerType)
+                {
+                case EPropertyType::Int32:
+                    LoadPrimitiveArray(Prop.GetValuePtr<TArray<int32>>(Object), *ArrayJson);
+                    break;
+                case EPropertyType::Float:
+                    LoadPrimitiveArray(Prop.GetValuePtr<TArray<float>>(Object), *ArrayJson);
+                    break;
+                case EPropertyType::Bool:
+                    LoadPrimitiveArray(Prop.GetValuePtr<TArray<bool>>(Object), *ArrayJson);
+                    break;
+                case EPropertyType::FString:
+                    LoadPrimitiveArray(Prop.GetValuePtr<TArray<FString>>(Object), *ArrayJson);
+                    break;
+                case EPropertyType::Sound:
+                {
+                    TArray<USound*>* ArrayPtr = Prop.GetValuePtr<TArray<USound*>>(Object);
+                    ArrayPtr->Empty();
+                    for (uint32 i = 0; i < static_cast<uint32>(ArrayJson->size()); ++i)
+                    {
+                        const TJsonNode& Elem = ArrayJson->at(i);
+                        if (Elem.JSONType() == JSON::Class::String)
+                        {
+                            FString Path = Elem.ToString();
+                            if (!Path.empty()) ArrayPtr->Add(UResourceManager::GetInstance().Load<USound>(Path));
+                            else ArrayPtr->Add(nullptr);
+                        }
+                    }
+                    break;
+                }
+                default:
+                    break;
+                }
+                break;
+            }
+            // ObjectPtr, Struct 등은 필요시 추가
+            default:
+                break;
+            }
+        }
+    }
+}
+
 // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
+	if (bInIsLoading)
+	{
+		LoadPropertiesFrom(this, static_cast<const JSON&>(InOutHandle));
+		return;
+	}
+
+	// FBinarySerializer::SaveToFile 중이면 프로퍼티를 바이너리 레코드로 기록하고 번호만 남김
+	if (FBinarySerializer::TrySaveProperties(this, InOutHandle))
+	{
+		return;
+	}
+
 	const TArray<FProperty>& Properties = this->GetClass()->GetAllProperties();
 
 	for (const FProperty& Prop : Properties)
@@ -20,269 +311,57 @@ void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		switch (Prop.Type)
 		{
 		case EPropertyType::Bool:
-		{
-			bool* Value = Prop.GetValuePtr<bool>(this);
-			if (bInIsLoading)
-			{
-				bool ReadValue;
-				if (FJsonSerializer::ReadBool(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = ReadValue;
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = *Value;
-			}
+			InOutHandle[Prop.Name] = *Prop.GetValuePtr<bool>(this);
 			break;
-		}
 		case EPropertyType::Int32:
-		{
-			int32* Value = Prop.GetValuePtr<int32>(this);
-			if (bInIsLoading)
-			{
-				int32 ReadValue;
-				if (FJsonSerializer::ReadInt32(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = ReadValue;
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = *Value;
-			}
+			InOutHandle[Prop.Name] = *Prop.GetValuePtr<int32>(this);
 			break;
-		}
 		case EPropertyType::Float:
-		{
-			float* Value = Prop.GetValuePtr<float>(this);
-			if (bInIsLoading)
-			{
-				float ReadValue;
-				if (FJsonSerializer::ReadFloat(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = ReadValue;
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = *Value;
-			}
+			InOutHandle[Prop.Name] = *Prop.GetValuePtr<float>(this);
 			break;
-		}
 		case EPropertyType::FVector:
-		{
-			FVector* Value = Prop.GetValuePtr<FVector>(this);
-			if (bInIsLoading)
-			{
-				FVector ReadValue;
-				if (FJsonSerializer::ReadVector(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = ReadValue;
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = FJsonSerializer::VectorToJson(*Value);
-			}
+			InOutHandle[Prop.Name] = FJsonSerializer::VectorToJson(*Prop.GetValuePtr<FVector>(this));
 			break;
-		}
 		case EPropertyType::FLinearColor:
-		{
-			FLinearColor* Value = Prop.GetValuePtr<FLinearColor>(this);
-			if (bInIsLoading)
-			{
-				FVector4 ReadValue;
-				if (FJsonSerializer::ReadVector4(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = FLinearColor(ReadValue);
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = FJsonSerializer::Vector4ToJson(Value->ToFVector4());
-			}
+			InOutHandle[Prop.Name] = FJsonSerializer::Vector4ToJson(Prop.GetValuePtr<FLinearColor>(this)->ToFVector4());
 			break;
-		}
 		case EPropertyType::FString:
 		case EPropertyType::ScriptFile:
-		{
-			FString* Value = Prop.GetValuePtr<FString>(this);
-			if (bInIsLoading)
-			{
-				FString ReadValue;
-				if (FJsonSerializer::ReadString(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = ReadValue;
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = Value->c_str();
-			}
+			InOutHandle[Prop.Name] = Prop.GetValuePtr<FString>(this)->c_str();
 			break;
-		}
 		case EPropertyType::FName:
-		{
-			FName* Value = Prop.GetValuePtr<FName>(this);
-			if (bInIsLoading)
-			{
-				FString ReadValue;
-				if (FJsonSerializer::ReadString(InOutHandle, Prop.Name, ReadValue))
-				{
-					*Value = FName(ReadValue);
-				}
-			}
-			else
-			{
-				InOutHandle[Prop.Name] = Value->ToString().c_str();
-			}
+			InOutHandle[Prop.Name] = Prop.GetValuePtr<FName>(this)->ToString().c_str();
 			break;
-		}
 		case EPropertyType::Texture:
 		{
-			UTexture** Value = Prop.GetValuePtr<UTexture*>(this);
-			if (bInIsLoading)
-			{
-				FString TexturePath;
-				FJsonSerializer::ReadString(InOutHandle, Prop.Name, TexturePath);
-				if (!TexturePath.empty())
-				{
-					*Value = UResourceManager::GetInstance().Load<UTexture>(TexturePath);
-				}
-				else
-				{
-					*Value = nullptr;
-				}
-			}
-			else
-			{
-				if (*Value)
-				{
-					InOutHandle[Prop.Name] = (*Value)->GetFilePath().c_str();
-				}
-				else
-				{
-					InOutHandle[Prop.Name] = "";
-				}
-			}
+			UTexture* Value = *Prop.GetValuePtr<UTexture*>(this);
+			InOutHandle[Prop.Name] = Value ? Value->GetFilePath().c_str() : "";
 			break;
 		}
 		case EPropertyType::StaticMesh:
 		{
-			UStaticMesh** Value = Prop.GetValuePtr<UStaticMesh*>(this);
-			if (bInIsLoading)
-			{
-				FString MeshPath;
-				FJsonSerializer::ReadString(InOutHandle, Prop.Name, MeshPath);
-				if (!MeshPath.empty())
-				{
-					*Value = UResourceManager::GetInstance().Load<UStaticMesh>(MeshPath);
-				}
-				else
-				{
-					*Value = nullptr;
-				}
-			}
-			else
-			{
-				if (*Value)
-				{
-					InOutHandle[Prop.Name] = (*Value)->GetAssetPathFileName().c_str();
-				}
-				else
-				{
-					InOutHandle[Prop.Name] = "";
-				}
-			}
+			UStaticMesh* Value = *Prop.GetValuePtr<UStaticMesh*>(this);
+			InOutHandle[Prop.Name] = Value ? Value->GetAssetPathFileName().c_str() : "";
 			break;
 		}
 		case EPropertyType::SkeletalMesh:
 		{
-			USkeletalMesh** Value = Prop.GetValuePtr<USkeletalMesh*>(this);
-			if (bInIsLoading)
-			{
-				FString MeshPath;
-				FJsonSerializer::ReadString(InOutHandle, Prop.Name, MeshPath);
-				if (!MeshPath.empty())
-				{
-					*Value = UResourceManager::GetInstance().Load<USkeletalMesh>(MeshPath);
-				}
-				else
-				{
-					*Value = nullptr;
-				}
-			}
-			else
-			{
-				if (*Value)
-				{
-					InOutHandle[Prop.Name] = (*Value)->GetAssetPathFileName().c_str();
-				}
-				else
-				{
-					InOutHandle[Prop.Name] = "";
-				}
-			}
+			USkeletalMesh* Value = *Prop.GetValuePtr<USkeletalMesh*>(this);
+			InOutHandle[Prop.Name] = Value ? Value->GetAssetPathFileName().c_str() : "";
 			break;
 		}
 		case EPropertyType::Material:
 		{
-			UMaterial** Value = Prop.GetValuePtr<UMaterial*>(this);
-			if (bInIsLoading)
-			{
-				FString MaterialPath;
-				FJsonSerializer::ReadString(InOutHandle, Prop.Name, MaterialPath);
-				if (!MaterialPath.empty())
-				{
-					*Value = UResourceManager::GetInstance().Load<UMaterial>(MaterialPath);
-				}
-				else
-				{
-					*Value = nullptr;
-				}
-			}
-			else
-			{
-				if (*Value)
-				{
-					InOutHandle[Prop.Name] = (*Value)->GetFilePath().c_str();
-				}
-				else
-				{
-					InOutHandle[Prop.Name] = "";
-				}
-			}
+			UMaterial* Value = *Prop.GetValuePtr<UMaterial*>(this);
+			InOutHandle[Prop.Name] = Value ? Value->GetFilePath().c_str() : "";
 			break;
 		}
 		case EPropertyType::Curve:
 		{
-			// Curve 프로퍼티는 float[4] 배열입니다. 따라서 FVector4로 처리
-			if (bInIsLoading)
-			{
-				FVector4 TempVec4;
-
-				// 1. FJsonSerializer::ReadVector4를 사용해 JSON에서 4개 요소를 읽어옵니다.
-				if (FJsonSerializer::ReadVector4(InOutHandle, Prop.Name, TempVec4))
-				{
-					// 2. 프로퍼티(float[4])의 실제 주소를 가져옵니다.
-					float* PropData = Prop.GetValuePtr<float>(this);
-
-					// 3. 읽어온 FVector4의 내용을 float[4] 메모리 위치에 복사합니다.
-					memcpy(PropData, &TempVec4, sizeof(float) * 4);
-				}
-			}
-			else // Saving
-			{
-				// 1. 프로퍼티(float[4])의 실제 주소를 가져옵니다.
-				float* PropData = Prop.GetValuePtr<float>(this);
-
-				// 2. float[4] 배열의 값으로 임시 FVector4 객체를 생성합니다.
-				FVector4 TempVec4(PropData[0], PropData[1], PropData[2], PropData[3]);
-
-				// 3. FJsonSerializer::Vector4ToJson을 사용해 JSON 배열로 변환하고 씁니다.
-				InOutHandle[Prop.Name] = FJsonSerializer::Vector4ToJson(TempVec4);
-			}
+			// Curve 프로퍼티는 float[4] 배열 -> FVector4로 저장
+			float* PropData = Prop.GetValuePtr<float>(this);
+			FVector4 TempVec4(PropData[0], PropData[1], PropData[2], PropData[3]);
+			InOutHandle[Prop.Name] = FJsonSerializer::Vector4ToJson(TempVec4);
 			break;
 		}
 		case EPropertyType::Array:
@@ -294,95 +373,55 @@ void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				break;
 			}
 
-			JSON ArrayJson;
-			if (bInIsLoading)
-			{
-				// JSON에서 배열 읽기
-				if (!FJsonSerializer::ReadArray(InOutHandle, Prop.Name, ArrayJson))
-				{
-					break; // 배열이 없거나 유효하지 않음
-				}
-			}
-			else
-			{
-				// 저장용 빈 배열 생성
-				ArrayJson = JSON::Make(JSON::Class::Array);
-			}
+			// 저장용 빈 배열 생성
+			JSON ArrayJson = JSON::Make(JSON::Class::Array);
 
 			// InnerType에 따라 처리
 			switch (Prop.InnerType)
 			{
 			case EPropertyType::Int32:
-			{
-				TArray<int32>* ArrayPtr = Prop.GetValuePtr<TArray<int32>>(this);
-				SerializePrimitiveArray<int32>(ArrayPtr, bInIsLoading, ArrayJson);
+				SerializePrimitiveArray<int32>(Prop.GetValuePtr<TArray<int32>>(this), false, ArrayJson);
 				break;
-			}
 			case EPropertyType::Float:
-			{
-				TArray<float>* ArrayPtr = Prop.GetValuePtr<TArray<float>>(this);
-				SerializePrimitiveArray<float>(ArrayPtr, bInIsLoading, ArrayJson);
+				SerializePrimitiveArray<float>(Prop.GetValuePtr<TArray<float>>(this), false, ArrayJson);
 				break;
-			}
 			case EPropertyType::Bool:
-			{
-				TArray<bool>* ArrayPtr = Prop.GetValuePtr<TArray<bool>>(this);
-				SerializePrimitiveArray<bool>(ArrayPtr, bInIsLoading, ArrayJson);
+				SerializePrimitiveArray<bool>(Prop.GetValuePtr<TArray<bool>>(this), false, ArrayJson);
 				break;
-			}
 			case EPropertyType::FString:
-			{
-				TArray<FString>* ArrayPtr = Prop.GetValuePtr<TArray<FString>>(this);
-				SerializePrimitiveArray<FString>(ArrayPtr, bInIsLoading, ArrayJson);
+				SerializePrimitiveArray<FString>(Prop.GetValuePtr<TArray<FString>>(this), false, ArrayJson);
 				break;
-			}
-			
 			case EPropertyType::Sound:
-			{
-				TArray<USound*>* ArrayPtr = Prop.GetValuePtr<TArray<USound*>>(this);
-				if (bInIsLoading)
+				for (USound* Snd : *Prop.GetValuePtr<TArray<USound*>>(this))
 				{
-					ArrayPtr->Empty();
-					for (size_t i = 0; i < ArrayJson.size(); ++i)
-					{
-						const JSON& Elem = ArrayJson.at(i);
-						if (Elem.JSONType() == JSON::Class::String)
-						{
-							FString Path = Elem.ToString();
-							if (!Path.empty()) ArrayPtr->Add(UResourceManager::GetInstance().Load<USound>(Path));
-							else ArrayPtr->Add(nullptr);
-						}
-					}
+					ArrayJson.append((Snd) ? Snd->GetFilePath().c_str() : "");
 				}
-				else
-				{
-					for (USound* Snd : *ArrayPtr)
-					{
-						ArrayJson.append((Snd) ? Snd->GetFilePath().c_str() : "");
-					}
-				}
-
 				break;
-			}
 			default:
-			{
-				//UE_LOG("[AutoSerialize] Array property '%s' has unsupported InnerType: %d", Prop.Name, static_cast<int>(Prop.InnerType));
 				break;
 			}
-			}
 
-			// 저장 시 JSON에 배열 쓰기
-			if (!bInIsLoading)
-			{
-				InOutHandle[Prop.Name] = ArrayJson;
-			}
+			// JSON에 배열 쓰기
+			InOutHandle[Prop.Name] = std::move(ArrayJson);
 			break;
 		}
 		// ObjectPtr, Struct 등은 필요시 추가
+		default:
+			break;
 		}
 	}
 }
 
+void UObject::LoadProperties(const FJsonValue& InNode)
+{
+	LoadPropertiesFrom(this, InNode);
+}
+
+void UObject::LoadFromNode(const FJsonValue& InNode)
+{
+	LoadProperties(InNode);
+}
+
 void UObject::DuplicateSubObjects()
 {
     UUID = GenerateUUID(); // UUID는 고유값이므로 새로 생성
@@ -12,6 +12,7 @@ using JSON = json::JSON;
 
 // 전방 선언/외부 심볼 (네 프로젝트 환경 유지)
 class UObject;
+class FJsonValue;
 class UWorld;
 // ── UClass: 간단한 타입 디스크립터 ─────────────────────────────
 struct UClass
@@ -29,6 +30,17 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 클래스 트리 DFS 구간 [TreeIndexBegin, TreeIndexEnd) - BuildClassTree() 이후 유효
+    // -1이면 트리 생성 이후 등록된 클래스이므로 Super 체인으로 검사
+    int32 TreeIndexBegin = -1;
+    int32 TreeIndexEnd = -1;
+
+    // 정확히 이 클래스인 살아 있는 객체들 (ObjectFactory 등록/삭제 시 갱신, TObjectIterator가 사용)
+    TArray<UObject*> Instances;
+
+    // FMemoryManager의 클래스별 객체 수 카운터 (첫 객체 등록 시 연결, 소유는 FMemoryManager)
+    mutable FMemoryClassCounters* MemoryCounters = nullptr;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
@@ -37,6 +49,11 @@ struct UClass
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        // 하위 클래스의 DFS 시작 인덱스는 항상 부모 구간 안에 있음 -> 정수 비교 두 번
+        if (TreeIndexBegin >= 0 && Base->TreeIndexBegin >= 0)
+        {
+            return TreeIndexBegin >= Base->TreeIndexBegin && TreeIndexBegin < Base->TreeIndexEnd;
+        }
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
@@ -48,24 +65,55 @@ struct UClass
         return AllClasses;
     }
 
+    // DFS 순서로 나열된 클래스 (인덱스 == TreeIndexBegin)
+    static TArray<UClass*>& GetClassTreeOrder()
+    {
+        static TArray<UClass*> TreeOrder;
+        return TreeOrder;
+    }
+
+    // BuildClassTree() 이후에 처음 등록된 클래스 (구간 없음)
+    static TArray<UClass*>& GetLateClasses()
+    {
+        static TArray<UClass*> LateClasses;
+        return LateClasses;
+    }
+
     static void SignUpClass(UClass* InClass)
     {
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            // 같은 이름이 중복 등록되면 먼저 등록된 클래스 유지 (기존 선형 탐색과 동일)
+            GetClassMap().emplace(FName(InClass->Name), InClass);
+            if (!GetClassTreeOrder().IsEmpty())
+            {
+                GetLateClasses().Add(InClass);
+            }
         }
     }
+
+    // 정적 등록이 끝난 뒤(엔진 Startup) 한 번 호출: 모든 클래스에 DFS 구간을 부여
+    static void BuildClassTree();
+
+    // 이름(대소문자 무시) -> 클래스
+    static TMap<FName, UClass*>& GetClassMap()
+    {
+        static TMap<FName, UClass*> ClassMap;
+        return ClassMap;
+    }
+
     static UClass* FindClass(const FName& InClassName)
     {
-        for (UClass* Class : GetAllClasses())
-        {
-            if (Class && Class->Name == InClassName)
-            {
-                return Class;
-            }
-        }
+        UClass** Found = GetClassMap().Find(InClassName);
+        return Found ? *Found : nullptr;
+    }
 
-        return nullptr;
+    // 문자열 조회: 풀에 없는 이름은 등록된 클래스일 수 없으므로 새 FName을 만들지 않음
+    static UClass* FindClass(const FString& InClassName)
+    {
+        const FName Name = FName::Find(InClassName);
+        return Name.IsNone() ? nullptr : FindClass(Name);
     }
 
     // 리플렉션 시스템 메서드
@@ -177,6 +225,15 @@ public:
 
     // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+    // 같은 프로퍼티 루프를 FJsonDocument 노드에서 실행 (json::JSON을 만들지 않는 로드 경로용)
+    void LoadProperties(const FJsonValue& InNode);
+    // 레벨/프리팹 로드 경로: 문서 노드에서 바로 로드 (기본 구현은 LoadProperties)
+    // Serialize의 로드 분기에 프로퍼티 외 처리가 있는 클래스는 이 함수도 같이 오버라이드해야 함
+    virtual void LoadFromNode(const FJsonValue& InNode);
+
+    // 두 노드 타입을 함께 읽는 템플릿 코드용 (json::JSON은 Serialize(true), 문서 노드는 LoadFromNode)
+    void LoadFrom(JSON& InNode) { Serialize(true, InNode); }
+    void LoadFrom(const FJsonValue& InNode) { LoadFromNode(InNode); }
 public:
     // GenerateUUID()에 의해 자동 발급
     uint32_t UUID;
@@ -184,6 +241,9 @@ public:
     // 팩토리 함수에 의해 자동 발급
     uint32_t InternalIndex;
 
+    // GetClass()->Instances 내 위치 (ObjectFactory가 관리, 삭제 시 swap-remove)
+    int32 ClassInstanceIndex = -1;
+
     FName    ObjectName;   // 이 프로젝트에서는 고유하지 않는 라벨로 사용
 
     // 정적: 타입 메타 반환 (이름을 StaticClass로!)
@@ -231,32 +291,39 @@ const T* Cast(const UObject* Obj) noexcept
     return (Obj && Obj->IsA<T>()) ? static_cast<const T*>(Obj) : nullptr;
 }
 
+// Array 로드 헬퍼 함수 (json::JSON / FJsonValue 공용)
+template<typename T, typename TJsonNode>
+static void LoadPrimitiveArray(TArray<T>* ArrayPtr, const TJsonNode& ArrayJson)
+{
+    ArrayPtr->clear();
+    for (uint32 i = 0; i < static_cast<uint32>(ArrayJson.size()); ++i)
+    {
+        if constexpr (std::is_same_v<T, int32>)
+        {
+            ArrayPtr->Add(ArrayJson.at(i).ToInt());
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            ArrayPtr->Add(static_cast<float>(ArrayJson.at(i).ToFloat()));
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            ArrayPtr->Add(ArrayJson.at(i).ToBool());
+        }
+        else if constexpr (std::is_same_v<T, FString>)
+        {
+            ArrayPtr->Add(ArrayJson.at(i).ToString());
+        }
+    }
+}
+
 // Array 직렬화 헬퍼 함수
 template<typename T>
 static void SerializePrimitiveArray(TArray<T>* ArrayPtr, bool bIsLoading, JSON& ArrayJson)
 {
     if (bIsLoading)
     {
-        ArrayPtr->clear();
-        for (uint32 i = 0; i < static_cast<uint32>(ArrayJson.size()); ++i)
-        {
-            if constexpr (std::is_same_v<T, int32>)
-            {
-                ArrayPtr->Add(ArrayJson[i].ToInt());
-            }
-            else if constexpr (std::is_same_v<T, float>)
-            {
-                ArrayPtr->Add(static_cast<float>(ArrayJson[i].ToFloat()));
-            }
-            else if constexpr (std::is_same_v<T, bool>)
-            {
-                ArrayPtr->Add(ArrayJson[i].ToBool());
-            }
-            else if constexpr (std::is_same_v<T, FString>)
-            {
-                ArrayPtr->Add(ArrayJson[i].ToString());
-            }
-        }
+        LoadPrimitiveArray<T>(ArrayPtr, static_cast<const JSON&>(ArrayJson));
     }
     else // Saving
     {
@@ -1,7 +1,51 @@
 ﻿#include "pch.h"
 #include "ObjectFactory.h"
+
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
+TArray<uint32> GUObjectSerialNumbers;
+
+namespace
+{
+    // 삭제로 비워진 슬롯 (LIFO로 재사용해서 최근에 비운 캐시 라인부터 다시 씀)
+    TArray<int32> GFreeObjectSlots;
+    // 0은 빈 슬롯 표시용이라 발급하지 않음
+    uint32 GNextSerialNumber = 0;
+    // 살아 있는 객체 주소 -> 슬롯. DeleteObject가 포인터를 역참조하기 전에 관리 중인 객체인지 확인하는 데 사용
+    // (이미 삭제된 포인터의 InternalIndex를 읽으면 해제된 메모리 접근이므로)
+    TMap<const UObject*, int32> GObjectSlotMap;
+
+    // 빈 슬롯이 있으면 재사용하고 없으면 배열 끝에 추가. 새 일련번호를 발급해서 이전 약한 포인터를 무효화
+    int32 AllocateObjectSlot(UObject* Obj)
+    {
+        int32 Index;
+        if (!GFreeObjectSlots.IsEmpty())
+        {
+            Index = GFreeObjectSlots.Pop();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = GUObjectArray.Add(Obj);
+            GUObjectSerialNumbers.Add(0);
+        }
+
+        if (++GNextSerialNumber == 0)
+        {
+            ++GNextSerialNumber;
+        }
+        GUObjectSerialNumbers[Index] = GNextSerialNumber;
+        Obj->InternalIndex = static_cast<uint32>(Index);
+        GObjectSlotMap.Add(Obj, Index);
+
+        // 클래스별 인스턴스 목록 (TObjectIterator가 GUObjectArray 전체 대신 순회)
+        UClass* Class = Obj->GetClass();
+        Obj->ClassInstanceIndex = Class->Instances.Add(Obj);
+
+        FMemoryManager::TrackObjectAllocated(Class);
+        return Index;
+    }
+}
 
 namespace ObjectFactory
 {
@@ -29,11 +73,7 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -55,11 +95,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -81,24 +117,41 @@ namespace ObjectFactory
     {
         if (!Obj) return;
 
-        // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
+        // Important: DO NOT dereference Obj fields before verifying it is still managed.
+        // 주소 -> 슬롯 해시로 확인하므로 선형 탐색 없이 O(1)
+        const int32* SlotPtr = GObjectSlotMap.Find(Obj);
+        if (!SlotPtr)
         {
             // Not managed or already deleted.
             return;
         }
+        const uint32 Index = static_cast<uint32>(*SlotPtr);
+        assert(Index < static_cast<uint32>(GUObjectArray.Num()) && GUObjectArray[Index] == Obj && Obj->InternalIndex == Index);
+        GObjectSlotMap.Remove(Obj);
 
-        GUObjectArray[foundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        GUObjectArray[Index] = nullptr;
+        GUObjectSerialNumbers[Index] = 0;
+
+        // 0번은 피킹 ID "없음"과 겹치므로 재사용하지 않음 (URenderer::GetCollisionComponentPointer)
+        if (Index != 0)
+        {
+            GFreeObjectSlots.Add(static_cast<int32>(Index));
+        }
+
+        // 클래스별 인스턴스 목록에서 swap-remove
+        UClass* Class = Obj->GetClass();
+        TArray<UObject*>& Instances = Class->Instances;
+        const int32 InstanceIndex = Obj->ClassInstanceIndex;
+        if (InstanceIndex >= 0 && InstanceIndex < Instances.Num() && Instances[InstanceIndex] == Obj)
+        {
+            UObject* LastObj = Instances.Last();
+            Instances[InstanceIndex] = LastObj;
+            LastObj->ClassInstanceIndex = InstanceIndex;
+            Instances.Pop();
+        }
+        Obj->ClassInstanceIndex = -1;
+
+        FMemoryManager::TrackObjectFreed(Class);
         Obj->DestroyInternal();
     }
 
@@ -114,26 +167,51 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GUObjectSerialNumbers.Empty();
+        GUObjectSerialNumbers.Shrink();
+        GFreeObjectSlots.Empty();
+        GObjectSlotMap.clear();
+        // GNextSerialNumber는 유지: 남아 있는 약한 포인터가 새 객체와 우연히 일치하지 않도록
     }
 
-    // (선택) null 슬롯 압축
+    // (선택) 배열 끝의 null 슬롯 제거
+    // 가운데 구멍은 프리 리스트로 재사용되고, 객체를 옮기면 InternalIndex(피킹 ID/약한 포인터)가 깨지므로 당기지 않음
     void CompactNullSlots()
     {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
+        int32 NewNum = GUObjectArray.Num();
+        while (NewNum > 0 && GUObjectArray[NewNum - 1] == nullptr)
+        {
+            --NewNum;
+        }
+        if (NewNum == GUObjectArray.Num())
         {
-            if (UObject* Obj = GUObjectArray[read])
+            return;
+        }
+
+        GUObjectArray.SetNum(NewNum);
+        GUObjectSerialNumbers.SetNum(NewNum);
+
+        int32 Write = 0;
+        for (int32 Read = 0; Read < GFreeObjectSlots.Num(); ++Read)
+        {
+            if (GFreeObjectSlots[Read] < NewNum)
             {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
+                GFreeObjectSlots[Write++] = GFreeObjectSlots[Read];
             }
         }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
+        GFreeObjectSlots.SetNum(Write);
+    }
+
+    void ReserveObjects(int32 NumObjects)
+    {
+        const int32 NumAppended = NumObjects - GFreeObjectSlots.Num();
+        if (NumAppended <= 0)
+        {
+            return;
+        }
+
+        GUObjectArray.Reserve(GUObjectArray.Num() + NumAppended);
+        GUObjectSerialNumbers.Reserve(GUObjectSerialNumbers.Num() + NumAppended);
+        GObjectSlotMap.reserve(GObjectSlotMap.size() + NumObjects);
     }
 }
@@ -1,11 +1,12 @@
 ﻿#pragma once
 #include "UEContainer.h"
-
+#include "WeakObjectPtr.h"
 
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
 extern TArray<UObject*> GUObjectArray;
+extern TArray<uint32> GUObjectSerialNumbers;   // 슬롯별 현재 객체의 일련번호 (0 = 빈 슬롯), TWeakObjectPtr 검증용
 
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
 namespace ObjectFactory
@@ -42,12 +43,14 @@ namespace ObjectFactory
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
-    // 개별 삭제(단일 소유자: Factory)
+    // 개별 삭제(단일 소유자: Factory). 주소 -> 슬롯 해시로 역참조 없이 관리 여부를 확인하고 O(1) 제거, 슬롯은 프리 리스트로 반환
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
+    // 배열 끝의 Null 슬롯만 잘라냄 (살아 있는 객체의 InternalIndex는 바뀌지 않음)
     void CompactNullSlots();
+    // 곧 NumObjects개를 한꺼번에 만들 때 호출 (빈 슬롯으로 모자라는 만큼 GUObjectArray를 한 번에 확보)
+    void ReserveObjects(int32 NumObjects);
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
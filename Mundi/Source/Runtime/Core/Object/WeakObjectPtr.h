@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class UObject;
+extern TArray<UObject*> GUObjectArray;
+extern TArray<uint32> GUObjectSerialNumbers;
+
+// Weak object pointer compatible with engine UObject lifetime
+// - GUObjectArray 슬롯 인덱스 + 그 슬롯 점유 객체의 일련번호를 저장 (non-owning)
+// - 객체가 삭제되면 슬롯 일련번호가 바뀌므로 슬롯이 재사용돼도 IsValid()/Get()이 nullptr 반환
+// - GUObjectArray에 등록되지 않은 객체(InternalIndex == UINT32_MAX)는 항상 무효
+// - Hash specialization provided below for unordered_map/set
+template<typename T>
+class TWeakObjectPtr
+{
+public:
+    using ElementType = T;
+
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+    explicit TWeakObjectPtr(T* InPtr)
+    {
+        if (InPtr && InPtr->InternalIndex < static_cast<uint32>(GUObjectSerialNumbers.Num()))
+        {
+            ObjectIndex = static_cast<int32>(InPtr->InternalIndex);
+            SerialNumber = GUObjectSerialNumbers[ObjectIndex];
+        }
+    }
+
+    bool IsValid() const { return Get() != nullptr; }
+    T* Get() const
+    {
+        if (ObjectIndex < 0 || ObjectIndex >= GUObjectSerialNumbers.Num() || GUObjectSerialNumbers[ObjectIndex] != SerialNumber)
+        {
+            return nullptr;
+        }
+        return static_cast<T*>(GUObjectArray[ObjectIndex]);
+    }
+
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
+
+    // 대상이 삭제된 뒤에도 같은 키로 비교/해시되도록 포인터가 아닌 (인덱스, 일련번호)로 비교
+    bool operator==(const TWeakObjectPtr& Other) const { return ObjectIndex == Other.ObjectIndex && SerialNumber == Other.SerialNumber; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
+
+    uint64 GetKey() const { return (static_cast<uint64>(SerialNumber) << 32) | static_cast<uint32>(ObjectIndex); }
+
+private:
+    int32 ObjectIndex = -1;
+    uint32 SerialNumber = 0;
+};
+
+namespace std {
+    template <typename T>
+    struct hash<TWeakObjectPtr<T>>
+    {
+        size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
+        {
+            return hash<uint64>()(Key.GetKey());
+        }
+    };
+}
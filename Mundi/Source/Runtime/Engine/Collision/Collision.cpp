@@ -398,6 +398,47 @@ namespace Collision
         return OverlapLUT[(int)ShapeA.Kind][(int)ShapeB.Kind](ShapeA, A->GetWorldTransform(), ShapeB, B->GetWorldTransform());
     }
 
+    FAABB ComputeShapeAABB(const FShape& Shape, const FTransform& Transform)
+    {
+        const FVector S = AbsVec(Transform.Scale3D);
+
+        // 로컬 축 기준 반크기 (Box: BuildOBB, Capsule: 코어 OBB + 양끝 구, Sphere: 두 반지름 규칙 중 큰 값)
+        FVector LocalHalfExtent;
+        switch (Shape.Kind)
+        {
+        case EShapeKind::Box:
+            LocalHalfExtent = FVector(Shape.Box.BoxExtent.X * S.X, Shape.Box.BoxExtent.Y * S.Y, Shape.Box.BoxExtent.Z * S.Z);
+            break;
+        case EShapeKind::Sphere:
+        {
+            // OverlapSphereAndSphere는 스케일 미적용, 나머지는 UniformScaleMax 적용
+            const float Radius = Shape.Sphere.SphereRadius * FMath::Max(1.0f, UniformScaleMax(S));
+            return FAABB(Transform.Translation - FVector(Radius, Radius, Radius), Transform.Translation + FVector(Radius, Radius, Radius));
+        }
+        case EShapeKind::Capsule:
+        {
+            const float RadiusWorld = Shape.Capsule.CapsuleRadius * FMath::Max(S.X, S.Y);
+            const float HalfHeightWorld = FMath::Max(0.0f, Shape.Capsule.CapsuleHalfHeight - Shape.Capsule.CapsuleRadius) * S.Z;
+            LocalHalfExtent = FVector(RadiusWorld, RadiusWorld, HalfHeightWorld + RadiusWorld);
+            break;
+        }
+        default:
+            return FAABB(Transform.Translation, Transform.Translation);
+        }
+
+        // 회전된 박스를 감싸는 월드 AABB: 각 월드 축으로 세 로컬 축의 투영 길이 합
+        const FMatrix R = Transform.Rotation.ToMatrix();
+        const FVector Axes[3] =
+        {
+            FVector(R.M[0][0], R.M[0][1], R.M[0][2]).GetSafeNormal() * LocalHalfExtent.X,
+            FVector(R.M[1][0], R.M[1][1], R.M[1][2]).GetSafeNormal() * LocalHalfExtent.Y,
+            FVector(R.M[2][0], R.M[2][1], R.M[2][2]).GetSafeNormal() * LocalHalfExtent.Z,
+        };
+        const FVector WorldHalfExtent = AbsVec(Axes[0]) + AbsVec(Axes[1]) + AbsVec(Axes[2]);
+
+        return FAABB(Transform.Translation - WorldHalfExtent, Transform.Translation + WorldHalfExtent);
+    }
+
 
 }
 
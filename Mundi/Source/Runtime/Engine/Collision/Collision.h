@@ -42,4 +42,7 @@ namespace Collision
     
     bool CheckOverlap(const UShapeComponent* A, const UShapeComponent* B);
 
+    // 브로드페이즈용 월드 AABB. 위 내로우페이즈가 쓰는 스케일 규칙을 모두 덮는 보수적인 박스
+    FAABB ComputeShapeAABB(const FShape& Shape, const FTransform& Transform);
+
 }
\ No newline at end of file
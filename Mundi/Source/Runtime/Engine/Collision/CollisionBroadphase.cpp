@@ -0,0 +1,152 @@
+﻿#include "pch.h"
+#include "CollisionBroadphase.h"
+#include "Collision.h"
+#include "World.h"
+#include <algorithm>
+
+void FCollisionBroadphase::UpdateOverlaps()
+{
+	Update();
+
+	// 스냅샷은 이벤트 전달 중에 바뀌지 않음 (핸들러의 파괴는 지연 처리, 스폰은 다음 프레임 오버랩 단계부터 포함)
+	for (int32 i = 0; i < Proxies.Num(); ++i)
+	{
+		UShapeComponent* Shape = Proxies[i].Component;
+		if (Shape->ConsumeOverlapUpdateRequest())
+		{
+			Shape->UpdateOverlaps(OverlapLists[i]);
+		}
+	}
+}
+
+const TArray<UShapeComponent*>& FCollisionBroadphase::GetOverlaps(const UShapeComponent* Shape) const
+{
+	static const TArray<UShapeComponent*> Empty;
+
+	const int32* ProxyIndex = ProxyIndexMap.Find(Shape);
+	return ProxyIndex ? OverlapLists[*ProxyIndex] : Empty;
+}
+
+void FCollisionBroadphase::Update()
+{
+	Proxies.clear();
+	ProxyIndexMap.clear();
+	NumCandidatePairs = 0;
+	NumOverlapPairs = 0;
+
+	if (!World)
+	{
+		return;
+	}
+
+	// 1. 활성 액터의 Shape 수집 (트랜스폼/AABB는 여기서 한 번만 계산)
+	for (AActor* Actor : World->GetActors())
+	{
+		if (!Actor || !Actor->IsActorActive())
+			continue;
+
+		for (USceneComponent* Comp : Actor->GetSceneComponents())
+		{
+			UShapeComponent* Shape = Cast<UShapeComponent>(Comp);
+			// 형태가 없는 기본 UShapeComponent는 제외
+			if (!Shape || Shape->GetClass() == UShapeComponent::StaticClass())
+				continue;
+
+			FShapeProxy Proxy;
+			Proxy.Component = Shape;
+			Proxy.Owner = Shape->GetOwner();
+			Shape->GetShape(Proxy.Shape);
+			Proxy.Transform = Shape->GetWorldTransform();
+			Proxy.Bounds = Collision::ComputeShapeAABB(Proxy.Shape, Proxy.Transform);
+			Proxy.bGenerateOverlapEvents = Shape->GetGenerateOverlapEvents();
+
+			ProxyIndexMap.Add(Shape, Proxies.Num());
+			Proxies.Add(Proxy);
+		}
+	}
+
+	// 목록 배열은 프레임 간에 재사용 (내부 할당 유지)
+	if (OverlapLists.Num() < Proxies.Num())
+	{
+		OverlapLists.resize(Proxies.Num());
+	}
+	for (int32 i = 0; i < Proxies.Num(); ++i)
+	{
+		OverlapLists[i].clear();
+	}
+
+	// 2. 후보 쌍 → 3. 내로우페이즈. 한 쌍은 한 번만 검사하고 결과를 양쪽에 기록
+	SweepAndPrune(Proxies, SortedIndices, CandidatePairs);
+	NumCandidatePairs = CandidatePairs.Num();
+
+	for (const FShapeProxyPair& Pair : CandidatePairs)
+	{
+		const FShapeProxy& A = Proxies[Pair.A];
+		const FShapeProxy& B = Proxies[Pair.B];
+
+		// 같은 액터끼리는 무시, 양쪽 모두 이벤트를 받지 않으면 검사 불필요
+		if (A.Owner == B.Owner)
+			continue;
+		if (!A.bGenerateOverlapEvents && !B.bGenerateOverlapEvents)
+			continue;
+
+		if (!TestOverlap(A, B))
+			continue;
+
+		++NumOverlapPairs;
+
+		// 기존 순회와 동일: 상대가 bGenerateOverlapEvents일 때만 목록에 추가
+		if (B.bGenerateOverlapEvents)
+		{
+			OverlapLists[Pair.A].Add(B.Component);
+		}
+		if (A.bGenerateOverlapEvents)
+		{
+			OverlapLists[Pair.B].Add(A.Component);
+		}
+	}
+}
+
+void FCollisionBroadphase::SweepAndPrune(const TArray<FShapeProxy>& Proxies, TArray<int32>& SortedIndices, TArray<FShapeProxyPair>& OutPairs)
+{
+	OutPairs.clear();
+
+	const int32 NumProxies = Proxies.Num();
+	SortedIndices.resize(NumProxies);
+	for (int32 i = 0; i < NumProxies; ++i)
+	{
+		SortedIndices[i] = i;
+	}
+
+	std::sort(SortedIndices.begin(), SortedIndices.end(), [&Proxies](int32 L, int32 R)
+	{
+		return Proxies[L].Bounds.Min.X < Proxies[R].Bounds.Min.X;
+	});
+
+	for (int32 i = 0; i < NumProxies; ++i)
+	{
+		const int32 IndexA = SortedIndices[i];
+		const FAABB& A = Proxies[IndexA].Bounds;
+
+		for (int32 j = i + 1; j < NumProxies; ++j)
+		{
+			const int32 IndexB = SortedIndices[j];
+			const FAABB& B = Proxies[IndexB].Bounds;
+
+			// Min.X 오름차순이므로 여기서부터는 X 구간이 겹치지 않음
+			if (B.Min.X > A.Max.X)
+				break;
+
+			if (B.Min.Y > A.Max.Y || B.Max.Y < A.Min.Y ||
+				B.Min.Z > A.Max.Z || B.Max.Z < A.Min.Z)
+				continue;
+
+			OutPairs.Add({ IndexA, IndexB });
+		}
+	}
+}
+
+bool FCollisionBroadphase::TestOverlap(const FShapeProxy& A, const FShapeProxy& B)
+{
+	return Collision::OverlapLUT[(int)A.Shape.Kind][(int)B.Shape.Kind](A.Shape, A.Transform, B.Shape, B.Transform);
+}
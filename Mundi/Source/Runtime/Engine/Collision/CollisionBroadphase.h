@@ -0,0 +1,74 @@
+﻿#pragma once
+#include "ShapeComponent.h"
+#include "AABB.h"
+
+class UWorld;
+class AActor;
+
+// 브로드페이즈 입력 하나. 갱신 시점의 월드 트랜스폼과 AABB를 복사해 둔 스냅샷
+struct FShapeProxy
+{
+	UShapeComponent* Component = nullptr;
+	AActor* Owner = nullptr;
+	FShape Shape;
+	FTransform Transform;
+	FAABB Bounds;
+	bool bGenerateOverlapEvents = false;
+};
+
+// AABB가 겹치는 후보 쌍 (Proxies 인덱스)
+struct FShapeProxyPair
+{
+	int32 A;
+	int32 B;
+};
+
+/**
+ * @class FCollisionBroadphase
+ * @brief 월드의 UShapeComponent 오버랩을 프레임당 한 번만 계산하는 Sweep-and-Prune 브로드페이즈입니다.
+ *
+ * 각 Shape가 TickComponent에서 월드 전체를 도는 대신, 모든 액터의 틱이 끝난 뒤(오버랩 단계) 활성 액터의 Shape를 모아
+ * AABB 최솟값 X로 정렬하고 X 구간이 겹치는 쌍만 Y/Z 검사 → Collision::OverlapLUT 내로우페이즈로 넘깁니다.
+ * 각 쌍은 한 번만 검사되고 결과는 양쪽 Shape의 목록에 모두 기록됩니다.
+ * 목록에는 상대가 bGenerateOverlapEvents인 경우만 들어가므로 기존 O(N^2) 순회와 같은 결과입니다.
+ * 이동이 모두 끝난 뒤 계산하므로 같은 프레임에 나중에 움직이거나 비활성화/스폰된 액터도 최종 상태로 판정됩니다.
+ */
+class FCollisionBroadphase
+{
+public:
+	explicit FCollisionBroadphase(UWorld* InWorld) : World(InWorld) {}
+
+	// 액터 틱이 모두 끝난 뒤 호출 (UWorld::Tick). 겹침을 다시 계산하고 이번 프레임에 틱한 Shape의 Begin/End 이벤트를 전달
+	void UpdateOverlaps();
+
+	// 마지막 갱신에서 Shape와 겹친 상대 Shape 목록
+	const TArray<UShapeComponent*>& GetOverlaps(const UShapeComponent* Shape) const;
+
+	// 활성 액터의 Shape를 모아 프록시/겹침 목록을 다시 계산
+	void Update();
+
+	// AABB가 겹치는 후보 쌍을 구함. SortedIndices는 호출 간에 재사용하는 작업 버퍼
+	static void SweepAndPrune(const TArray<FShapeProxy>& Proxies, TArray<int32>& SortedIndices, TArray<FShapeProxyPair>& OutPairs);
+
+	// 두 프록시의 내로우페이즈 검사 (Collision::OverlapLUT)
+	static bool TestOverlap(const FShapeProxy& A, const FShapeProxy& B);
+
+	// 마지막 갱신 통계
+	int32 GetNumProxies() const { return Proxies.Num(); }
+	int32 GetNumCandidatePairs() const { return NumCandidatePairs; }
+	int32 GetNumOverlapPairs() const { return NumOverlapPairs; }
+
+private:
+	UWorld* World = nullptr;
+
+	TArray<FShapeProxy> Proxies;
+	TArray<int32> SortedIndices;
+	TArray<FShapeProxyPair> CandidatePairs;
+
+	// Shape -> Proxies 인덱스, 인덱스별 겹친 상대 목록
+	TMap<const UShapeComponent*, int32> ProxyIndexMap;
+	TArray<TArray<UShapeComponent*>> OverlapLists;
+
+	int32 NumCandidatePairs = 0;
+	int32 NumOverlapPairs = 0;
+};
@@ -152,6 +152,46 @@ FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideA
     return Result;
 }
 
+// ------------------------------------------------------------
+// View * Proj 행렬에서 절두체 추출
+//  - row-vector 규약(p' = p * VP)이므로 클립 좌표의 각 성분은 VP의 "열"과의 내적이다.
+//    (아래 주석의 R3 + R0 등은 column-vector 기준이라 여기서는 C3 + C0 형태로 사용)
+//  - D3D 깊이 범위 [0, 1] 기준: Near = C2, Far = C3 - C2
+//  - 결합 결과 P=(a,b,c,d)에 대해 N=(a,b,c)/|N|, D=-d/|N| 로 "안쪽 ≥ 0" 규약에 맞춘다.
+// ------------------------------------------------------------
+namespace
+{
+    FPlane MakePlaneFromClipCombo(const FVector4& P)
+    {
+        FPlane Out;
+        const FVector4 N(P.X, P.Y, P.Z, 0.0f);
+        const float Len = Length3(N);
+        if (Len > 0.0f)
+        {
+            Out.Normal = FVector4(N.X / Len, N.Y / Len, N.Z / Len, 0.0f);
+            Out.Distance = -P.W / Len;
+        }
+        return Out;
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProj)
+{
+    const FVector4 C0(ViewProj.M[0][0], ViewProj.M[1][0], ViewProj.M[2][0], ViewProj.M[3][0]);
+    const FVector4 C1(ViewProj.M[0][1], ViewProj.M[1][1], ViewProj.M[2][1], ViewProj.M[3][1]);
+    const FVector4 C2(ViewProj.M[0][2], ViewProj.M[1][2], ViewProj.M[2][2], ViewProj.M[3][2]);
+    const FVector4 C3(ViewProj.M[0][3], ViewProj.M[1][3], ViewProj.M[2][3], ViewProj.M[3][3]);
+
+    FFrustum Result;
+    Result.LeftFace = MakePlaneFromClipCombo(C3 + C0);
+    Result.RightFace = MakePlaneFromClipCombo(C3 - C0);
+    Result.BottomFace = MakePlaneFromClipCombo(C3 + C1);
+    Result.TopFace = MakePlaneFromClipCombo(C3 - C1);
+    Result.NearFace = MakePlaneFromClipCombo(C2);
+    Result.FarFace = MakePlaneFromClipCombo(C3 - C2);
+    return Result;
+}
+
 // ------------------------------------------------------------
 // AABB vs 프러스텀 판정
 //  - 각 평면에 대해: 중심의 부호 + 박스의 "프로젝션 반경"으로 배제 테스트
@@ -26,6 +26,8 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// row-vector 규약(p' = p * ViewProj)의 View * Proj 행렬에서 절두체 추출 (원근/직교 공용)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProj);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
@@ -72,6 +72,12 @@ void UBillboardComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UBillboardComponent::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	TexturePath = Texture->GetFilePath();
+}
+
 void UBillboardComponent::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
@@ -29,6 +29,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
 
     // Duplication
     void DuplicateSubObjects() override;
@@ -166,6 +166,8 @@ void UCameraComponent::DuplicateSubObjects()
     Super::DuplicateSubObjects();
 
     ProjectionMode = ECameraProjectionMode::Perspective;
+    // 에디터 전용 기즈모는 복사되지 않으므로 원본 포인터를 들고 있지 않도록 비움 (에디터 월드에 등록되면 OnRegister에서 다시 생성)
+    CameraGizmo = nullptr;
 }
 
 void UCameraComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -183,3 +185,12 @@ void UCameraComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["ProjectionMode"] = static_cast<int32>(ProjectionMode);
     }
 }
+
+void UCameraComponent::LoadFromNode(const FJsonValue& InNode)
+{
+    Super::LoadFromNode(InNode);
+
+    int32 ModeInt = static_cast<int32>(ECameraProjectionMode::Perspective);
+    FJsonSerializer::ReadInt32(InNode, "ProjectionMode", ModeInt, 0);
+    ProjectionMode = static_cast<ECameraProjectionMode>(ModeInt);
+}
@@ -57,6 +57,7 @@ public:
 
     // Serialization
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
 
 private:
     float FieldOfView;   // degrees
@@ -46,35 +46,38 @@ void UHeightFogComponent::RenderHeightFog(URenderer* Renderer)
 {
 }
 
+template<typename TJsonNode>
+void UHeightFogComponent::LoadFogSettings(const TJsonNode& InNode)
+{
+	// Load FogInscatteringColor
+	if (InNode.hasKey("FogInscatteringColor"))
+	{
+		FVector4 ColorVec;
+		FJsonSerializer::ReadVector4(InNode, "FogInscatteringColor", ColorVec);
+		FogInscatteringColor = FLinearColor(ColorVec);
+	}
+
+	// Load HeightFogShader
+	FString shaderPath;
+	if (FJsonSerializer::ReadString(InNode, "HeightFogShader", shaderPath, "", false) && !shaderPath.empty())
+	{
+		HeightFogShader = UResourceManager::GetInstance().Load<UShader>(shaderPath.c_str());
+	}
+
+	// FogDensity, FogHeightFalloff, StartDistance, FogCutoffDistance, FogMaxOpacity도 로드
+	FJsonSerializer::ReadFloat(InNode, "FogDensity", FogDensity, 0.2f);
+	FJsonSerializer::ReadFloat(InNode, "FogHeightFalloff", FogHeightFalloff, 0.2f);
+	FJsonSerializer::ReadFloat(InNode, "StartDistance", StartDistance, 0.0f);
+	FJsonSerializer::ReadFloat(InNode, "FogCutoffDistance", FogCutoffDistance, 6000.0f);
+	FJsonSerializer::ReadFloat(InNode, "FogMaxOpacity", FogMaxOpacity, 1.0f);
+}
+
 void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 	if (bInIsLoading)
 	{
-		// Load FogInscatteringColor
-		if (InOutHandle.hasKey("FogInscatteringColor"))
-		{
-			FVector4 ColorVec;
-			FJsonSerializer::ReadVector4(InOutHandle, "FogInscatteringColor", ColorVec);
-			FogInscatteringColor = FLinearColor(ColorVec);
-		}
-
-		// Load HeightFogShader
-		if (InOutHandle.hasKey("HeightFogShader"))
-		{
-			FString shaderPath = InOutHandle["HeightFogShader"].ToString();
-			if (!shaderPath.empty())
-			{
-				HeightFogShader = UResourceManager::GetInstance().Load<UShader>(shaderPath.c_str());
-			}
-		}
-
-		// FogDensity, FogHeightFalloff, StartDistance, FogCutoffDistance, FogMaxOpacity도 로드
-		FJsonSerializer::ReadFloat(InOutHandle, "FogDensity", FogDensity, 0.2f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogHeightFalloff", FogHeightFalloff, 0.2f);
-		FJsonSerializer::ReadFloat(InOutHandle, "StartDistance", StartDistance, 0.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogCutoffDistance", FogCutoffDistance, 6000.0f);
-		FJsonSerializer::ReadFloat(InOutHandle, "FogMaxOpacity", FogMaxOpacity, 1.0f);
+		LoadFogSettings(InOutHandle);
 	}
 	else
 	{
@@ -103,6 +106,12 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UHeightFogComponent::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	LoadFogSettings(InNode);
+}
+
 void UHeightFogComponent::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
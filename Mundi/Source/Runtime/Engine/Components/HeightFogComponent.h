@@ -42,12 +42,17 @@ public:
     void OnRegister(UWorld* InWorld) override;
 	// Serialize
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 	// ───── 복사 관련 ────────────────────────────
 	void DuplicateSubObjects() override;
 	DECLARE_DUPLICATE(UHeightFogComponent)
     
 private:
+    // 포그 색/셰이더/수치 로드 (json::JSON / 문서 노드 공용)
+    template<typename TJsonNode>
+    void LoadFogSettings(const TJsonNode& InNode);
+
     float FogDensity = 0.2f;
     float FogHeightFalloff = 0.2f;
     float StartDistance = 0.0f;
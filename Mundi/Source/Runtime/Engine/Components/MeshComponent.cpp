@@ -3,6 +3,8 @@
 #include "StaticMesh.h"
 #include "ObjManager.h"
 #include "Shader.h"
+#include "Material.h"
+#include "SceneView.h"
 
 IMPLEMENT_CLASS(UMeshComponent)
 
@@ -17,4 +19,123 @@ UMeshComponent::~UMeshComponent()
 void UMeshComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
+
+    // 복제본은 머티리얼 인스턴스가 새로 만들어지므로 원본의 캐시를 쓰지 않음
+    for (FMeshBatchCacheEntry& Entry : MeshBatchCache)
+    {
+        Entry.Batches.clear();
+    }
+    InvalidateMeshBatchCache();
+}
+
+void UMeshComponent::InvalidateMeshBatchCache()
+{
+    for (FMeshBatchCacheEntry& Entry : MeshBatchCache)
+    {
+        Entry.bValid = false;
+    }
+}
+
+const TArray<UMeshComponent::FCachedMeshBatch>* UMeshComponent::FindCachedMeshBatches(const FSceneView* View, const void* MeshAsset)
+{
+    for (FMeshBatchCacheEntry& Entry : MeshBatchCache)
+    {
+        if (!Entry.bValid || Entry.ViewMacroKey != View->ViewShaderMacroKey)
+        {
+            continue;
+        }
+
+        // 뷰 모드당 항목은 하나뿐이므로 나머지 조건이 틀리면 이 뷰 모드는 다시 만들어야 함
+        if (Entry.MeshAsset != MeshAsset || Entry.ShaderGeneration != GShaderVariantGeneration)
+        {
+            return nullptr;
+        }
+
+        // SetMaterial을 거치지 않고 슬롯이 바뀐 경우(직렬화, 에디터 프로퍼티 등)도 잡아냄
+        for (const FCachedMeshBatch& Cached : Entry.Batches)
+        {
+            if (GetMaterial(Cached.SectionIndex) != Cached.SlotMaterial)
+            {
+                return nullptr;
+            }
+        }
+
+        Entry.LastUsed = ++MeshBatchCacheUseCounter;
+        return &Entry.Batches;
+    }
+    return nullptr;
+}
+
+TArray<UMeshComponent::FCachedMeshBatch>& UMeshComponent::BeginMeshBatchCache(const FSceneView* View, const void* MeshAsset)
+{
+    // 같은 뷰 모드 항목 > 빈 항목 > 가장 오래 안 쓴 항목 순으로 재사용
+    FMeshBatchCacheEntry* Target = nullptr;
+    for (FMeshBatchCacheEntry& Entry : MeshBatchCache)
+    {
+        if (Entry.bValid && Entry.ViewMacroKey == View->ViewShaderMacroKey)
+        {
+            Target = &Entry;
+            break;
+        }
+        if (!Target
+            || (Target->bValid && !Entry.bValid)
+            || (Target->bValid == Entry.bValid && Entry.LastUsed < Target->LastUsed))
+        {
+            Target = &Entry;
+        }
+    }
+
+    Target->Batches.clear();
+    Target->ViewMacroKey = View->ViewShaderMacroKey;
+    Target->MeshAsset = MeshAsset;
+    Target->ShaderGeneration = GShaderVariantGeneration;
+    Target->LastUsed = ++MeshBatchCacheUseCounter;
+    Target->bValid = true;
+    return Target->Batches;
+}
+
+void UMeshComponent::EmitCachedMeshBatches(const TArray<FCachedMeshBatch>& CachedMeshBatches, TArray<FMeshBatchElement>& OutMeshBatchElements, ID3D11Buffer* VertexBuffer, ID3D11Buffer* IndexBuffer) const
+{
+    const FMatrix WorldMatrix = GetWorldMatrix();
+    for (const FCachedMeshBatch& Cached : CachedMeshBatches)
+    {
+        FMeshBatchElement& BatchElement = OutMeshBatchElements.emplace_back(Cached.Template);
+        BatchElement.VertexBuffer = VertexBuffer;
+        BatchElement.IndexBuffer = IndexBuffer;
+        BatchElement.WorldMatrix = WorldMatrix;
+        BatchElement.ObjectID = InternalIndex;
+    }
+}
+
+void UMeshComponent::ResolveShaderVariants(FMeshBatchElement& InOutBatch, UShader* Shader, UMaterialInterface* Material, const FSceneView* View, bool bWithInstancing)
+{
+    // View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
+    TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+    const TArray<FShaderMacro> MaterialMacros = Material->GetShaderMacros();
+    if (0 < MaterialMacros.Num())
+    {
+        ShaderMacros.Append(MaterialMacros);
+    }
+
+    FShaderVariant* ShaderVariant = Shader->GetOrCompileShaderVariant(ShaderMacros);
+    if (!ShaderVariant)
+    {
+        return;
+    }
+
+    InOutBatch.VertexShader = ShaderVariant->VertexShader;
+    InOutBatch.PixelShader = ShaderVariant->PixelShader;
+    InOutBatch.InputLayout = ShaderVariant->InputLayout;
+
+    // 같은 메시/머티리얼이 여러 번 그려지면 DrawMeshBatches가 인스턴싱 변형으로 묶어서 그린다
+    if (bWithInstancing && Shader->SupportsInstancing())
+    {
+        ShaderMacros.Add(FShaderMacro{ "USE_INSTANCING", "1" });
+        if (FShaderVariant* InstancedVariant = Shader->GetOrCompileShaderVariant(ShaderMacros))
+        {
+            InOutBatch.InstancedVertexShader = InstancedVariant->VertexShader;
+            InOutBatch.InstancedPixelShader = InstancedVariant->PixelShader;
+            InOutBatch.InstancedInputLayout = InstancedVariant->InputLayout;
+        }
+    }
 }
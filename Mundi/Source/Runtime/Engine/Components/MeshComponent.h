@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "PrimitiveComponent.h"
+#include "MeshBatchElement.h"
 
 class UShader;
 
@@ -19,6 +20,48 @@ public:
 
     bool IsCastShadows() { return bCastShadows; }
 
+    // 다음 CollectMeshBatches에서 섹션별 셰이더 변형을 다시 결정하도록 모든 뷰의 캐시를 버림
+    void InvalidateMeshBatchCache();
+
+protected:
+    // 섹션 하나의 셰이더 변형까지 결정된 배치 템플릿
+    // (월드 행렬, ObjectID, 정점/인덱스 버퍼는 매 프레임 채움)
+    struct FCachedMeshBatch
+    {
+        uint32 SectionIndex = 0;
+        UMaterialInterface* SlotMaterial = nullptr;    // 기본 머티리얼로 대체되기 전의 GetMaterial() 결과 (변경 감지용)
+        FMeshBatchElement Template;
+    };
+
+    // 뷰 모드(ViewShaderMacroKey)별 캐시에서 메시, 섹션 머티리얼, 셰이더 세대(GShaderVariantGeneration)가
+    // 캐시를 만들 때와 같은 항목을 찾음 (없으면 nullptr)
+    const TArray<FCachedMeshBatch>* FindCachedMeshBatches(const FSceneView* View, const void* MeshAsset);
+
+    // 이 뷰 모드의 항목(없으면 빈 항목이나 가장 오래 안 쓴 항목)을 비우고 반환 (호출부가 섹션을 추가)
+    TArray<FCachedMeshBatch>& BeginMeshBatchCache(const FSceneView* View, const void* MeshAsset);
+
+    // 캐시된 템플릿에 이번 프레임 값을 채워서 출력 배열에 추가
+    void EmitCachedMeshBatches(const TArray<FCachedMeshBatch>& CachedMeshBatches, TArray<FMeshBatchElement>& OutMeshBatchElements, ID3D11Buffer* VertexBuffer, ID3D11Buffer* IndexBuffer) const;
+
+    // 뷰 매크로 + 머티리얼 매크로 조합으로 셰이더 변형을 찾아 배치에 채움 (캐시를 다시 만들 때만 호출)
+    static void ResolveShaderVariants(FMeshBatchElement& InOutBatch, UShader* Shader, UMaterialInterface* Material, const FSceneView* View, bool bWithInstancing);
+
 private:
     bool bCastShadows = true;   // TODO: 프로퍼티로 추가 필요
-};
\ No newline at end of file
+
+    // 뷰 모드 하나에 대한 캐시 항목
+    // 뷰포트마다 뷰 모드가 다를 수 있으므로(Lit/Unlit/WorldNormal...) 몇 개를 동시에 유지해서 번갈아 그려도 재구성하지 않음
+    struct FMeshBatchCacheEntry
+    {
+        uint64 ViewMacroKey = 0;
+        const void* MeshAsset = nullptr;
+        uint32 ShaderGeneration = 0;
+        uint32 LastUsed = 0;
+        bool bValid = false;
+        TArray<FCachedMeshBatch> Batches;
+    };
+
+    static constexpr int32 MaxMeshBatchCacheEntries = 4;
+    FMeshBatchCacheEntry MeshBatchCache[MaxMeshBatchCacheEntries];
+    uint32 MeshBatchCacheUseCounter = 0;
+};
@@ -55,6 +55,42 @@ void UMovementComponent::StopMovement()
     Acceleration = FVector(0.0f, 0.0f, 0.0f);
 }
 
+void UMovementComponent::OnRegister(UWorld* InWorld)
+{
+    Super::OnRegister(InWorld);
+
+    // SpawnActor/프리팹 복제 직후의 값 = 풀에서 다시 꺼냈을 때 돌아갈 값
+    if (!bHasSpawnState)
+    {
+        SpawnVelocity = Velocity;
+        SpawnAcceleration = Acceleration;
+        bHasSpawnState = true;
+    }
+}
+
+void UMovementComponent::OnReleasedToPool()
+{
+    Super::OnReleasedToPool();
+    StopMovement();
+}
+
+void UMovementComponent::OnAcquiredFromPool()
+{
+    Super::OnAcquiredFromPool();
+
+    // 재사용 액터는 BeginPlay를 다시 거치지 않으므로 스폰 시점 값으로 직접 되돌림
+    if (bHasSpawnState)
+    {
+        Velocity = SpawnVelocity;
+        Acceleration = SpawnAcceleration;
+    }
+}
+
+bool UMovementComponent::CanTickInParallel() const
+{
+    return Super::CanTickInParallel() && (!UpdatedComponent || UpdatedComponent->GetOwner() == Owner);
+}
+
 void UMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
 {
     UpdatedComponent = NewUpdatedComponent;
@@ -64,4 +100,7 @@ void UMovementComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
     // MovementComponent has no sub-objects to duplicate
+
+    // 복제본(PIE/프리팹 스폰)은 자기 월드에 등록될 때 스폰 시점 값을 새로 기록
+    bHasSpawnState = false;
 }
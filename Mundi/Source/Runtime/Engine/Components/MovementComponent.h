@@ -25,6 +25,9 @@ public:
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaSeconds) override;
 
+    // 다른 액터의 컴포넌트를 움직이는 경우엔 병렬 틱 불가
+    bool CanTickInParallel() const override;
+
     void SetVelocity(const FVector& NewVelocity);
     FVector GetVelocity() const { return Velocity; }
 
@@ -34,6 +37,10 @@ public:
     // 속도와 가속도를 0으로 설정하여 이동 중지
     virtual void StopMovement();
 
+    // 액터 풀 반납 시 이동 중지, 재사용 시 스폰 시점(첫 등록 시점)의 속도/가속도 복원
+    void OnReleasedToPool() override;
+    void OnAcquiredFromPool() override;
+
     // 업데이트 대상 컴포넌트
     void SetUpdatedComponent(USceneComponent* NewUpdatedComponent);
     USceneComponent* GetUpdatedComponent() const { return UpdatedComponent; }
@@ -45,6 +52,8 @@ public:
     void DuplicateSubObjects() override;
 
 protected:
+    void OnRegister(UWorld* InWorld) override;
+
     // [PIE] Duplicate 복사 대상
     USceneComponent* UpdatedComponent = nullptr;
 
@@ -52,4 +61,9 @@ protected:
     FVector Velocity;
     FVector Acceleration;
     bool bUpdateOnlyIfRendered = false;
+
+    // 액터 풀 재사용 시 복원할 스폰 시점 값 (첫 등록 때 기록, 복제본은 등록 시 다시 기록)
+    FVector SpawnVelocity;
+    FVector SpawnAcceleration;
+    bool bHasSpawnState = false;
 };
@@ -177,3 +177,12 @@ void UPerspectiveDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 		InOutHandle["FovY"] = GetFovY();
 	}
 }
+
+void UPerspectiveDecalComponent::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+
+	float FovYTemp;
+	FJsonSerializer::ReadFloat(InNode, "FovY", FovYTemp);
+	SetFovY(FovYTemp);
+}
@@ -32,6 +32,7 @@ public:
 
 	// Serialize
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 private:
 	float FovY = 60;
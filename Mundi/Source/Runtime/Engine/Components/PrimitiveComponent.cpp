@@ -43,6 +43,33 @@ void UPrimitiveComponent::OnUnregister()
     Super::OnUnregister();
 }
 
+void UPrimitiveComponent::OnReleasedToPool()
+{
+    Super::OnReleasedToPool();
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UWorldPartitionManager* Partition = World->GetPartitionManager())
+        {
+            Partition->Park(this);
+        }
+    }
+}
+
+void UPrimitiveComponent::OnAcquiredFromPool()
+{
+    Super::OnAcquiredFromPool();
+
+    // Park했던 슬롯으로 돌아가므로 BVH 리빌드 없이 리핏만 발생
+    if (UWorld* World = GetWorld())
+    {
+        if (UWorldPartitionManager* Partition = World->GetPartitionManager())
+        {
+            Partition->Register(this);
+        }
+    }
+}
+
 void UPrimitiveComponent::SetMaterialByName(uint32 InElementIndex, const FString& InMaterialName)
 {
     SetMaterial(InElementIndex, UResourceManager::GetInstance().Load<UMaterial>(InMaterialName));
@@ -27,6 +27,10 @@ public:
     void OnRegister(UWorld* InWorld) override;
     void OnUnregister() override;
 
+    // 액터 풀: 파티션 BVH 슬롯은 유지한 채 쿼리에서만 제외/복귀
+    void OnReleasedToPool() override;
+    void OnAcquiredFromPool() override;
+
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
@@ -34,6 +34,7 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , bIsActive(true)
 {
     bCanEverTick = true;
+    bTickInParallel = true; // 호밍이 아니면 자기 속도/UpdatedComponent만 갱신
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -61,6 +62,7 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
                 {
                     //Owner->Destroy();
                     Owner->SetActorHiddenInGame(true);
+                    bHidOwnerOnExpire = true;
                     return;
                 }
             }
@@ -98,6 +100,30 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
     }
 }
 
+bool UProjectileMovementComponent::CanTickInParallel() const
+{
+    // 호밍은 다른 액터의 월드 트랜스폼(캐시 갱신 포함)을 읽으므로 메인 스레드에서 틱
+    return Super::CanTickInParallel() && !bIsHomingProjectile;
+}
+
+void UProjectileMovementComponent::OnAcquiredFromPool()
+{
+    // 속도/가속도는 UMovementComponent에서 스폰 시점 값으로 복원
+    Super::OnAcquiredFromPool();
+
+    bIsActive = true;
+    CurrentLifetime = 0.0f;
+
+    if (bHidOwnerOnExpire)
+    {
+        if (AActor* OwnerActor = GetOwner())
+        {
+            OwnerActor->SetActorHiddenInGame(false);
+        }
+        bHidOwnerOnExpire = false;
+    }
+}
+
 void UProjectileMovementComponent::FireInDirection(const FVector& ShootDirection)
 {
     // 방향 벡터를 정규화하고 InitialSpeed를 곱해 속도 설정
@@ -24,6 +24,7 @@ protected:
 public:
     // Life Cycle
     virtual void TickComponent(float DeltaSeconds) override;
+    bool CanTickInParallel() const override;
 
     // 발사 API
     void FireInDirection(const FVector& ShootDirection);
@@ -69,6 +70,9 @@ public:
     void ResetLifetime() { CurrentLifetime = 0.0f; }
     float GetCurrentLifetime() const { return CurrentLifetime; }
 
+    // 액터 풀 재사용 시 생존 시간/활성 상태 초기화, 수명 만료로 숨긴 Owner는 다시 표시
+    void OnAcquiredFromPool() override;
+
 protected:
     // 내부 헬퍼 함수
     void LimitVelocity();
@@ -115,6 +119,9 @@ protected:
     // 생명 시간 초과 시 자동 파괴 여부
     bool bAutoDestroyWhenLifespanExceeded;
 
+    // 수명 만료로 Owner를 숨겼는지 (풀 재사용 시 되돌림)
+    bool bHidOwnerOnExpire = false;
+
     // === 상태 ===
     // 활성화 상태
     bool bIsActive;
@@ -18,6 +18,7 @@ URotatingMovementComponent::URotatingMovementComponent()
     , bRotationInLocalSpace(true)
 {
     bCanEverTick = true;
+    bTickInParallel = true; // UpdatedComponent 트랜스폼만 갱신
 }
 
 URotatingMovementComponent::~URotatingMovementComponent()
@@ -21,6 +21,9 @@ END_PROPERTIES()
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
 
+// 병렬 틱 중인 스레드의 지연 목록 (nullptr이면 즉시 OnTransformUpdated)
+static thread_local TArray<USceneComponent*>* GDeferredTransformUpdates = nullptr;
+
 USceneComponent::USceneComponent()
     : RelativeLocation(0, 0, 0)
     , RelativeRotation(0, 0, 0, 1)
@@ -63,7 +66,7 @@ void USceneComponent::SetRelativeLocation(const FVector& NewLocation)
 {
     RelativeLocation = NewLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 FVector USceneComponent::GetRelativeLocation() const { return RelativeLocation; }
 
@@ -72,7 +75,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& NewRotation)
     RelativeRotation = NewRotation;
     RelativeRotationEuler = NewRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 FQuat USceneComponent::GetRelativeRotation() const { return RelativeRotation; }
 
@@ -86,7 +89,7 @@ void USceneComponent::SetRelativeRotationEuler(const FVector& EulerDegrees)
 
     // Euler 재계산 하지 않음 - UI에서 입력한 값을 그대로 유지
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 FVector USceneComponent::GetRelativeRotationEuler() const
@@ -99,7 +102,7 @@ void USceneComponent::SetRelativeScale(const FVector& NewScale)
 {
     RelativeScale = NewScale;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 FVector USceneComponent::GetRelativeScale() const { return RelativeScale; }
 
@@ -107,7 +110,7 @@ void USceneComponent::AddRelativeLocation(const FVector& DeltaLocation)
 {
     RelativeLocation = RelativeLocation + DeltaLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
@@ -115,7 +118,7 @@ void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
     RelativeRotation = DeltaRotation * RelativeRotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
@@ -124,21 +127,36 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
         RelativeScale.Y * DeltaScale.Y,
         RelativeScale.Z * DeltaScale.Z);
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 // ──────────────────────────────
 // World API
 // ──────────────────────────────
-FTransform USceneComponent::GetWorldTransform() const
+const FTransform& USceneComponent::GetWorldTransform() const
 {
+    if (!bWorldTransformDirty)
+    {
+        return CachedWorldTransform;
+    }
+
     // Dangling pointer 방지를 위한 체크 
     if (AttachParent && !AttachParent->IsPendingDestroy())
     {
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        // 부모도 더티면 부모 체인에서 한 번씩만 재계산되고 이후엔 캐시를 재사용
+        CachedWorldTransform = AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+    }
+    else
+    {
+        CachedWorldTransform = RelativeTransform;
     }
+    CachedWorldMatrix = CachedWorldTransform.ToMatrix();
 
-    return RelativeTransform;
+    // 파괴 대기 중인 부모를 건너뛰었거나, 부모가 같은 이유로 여전히 더티(조상 중 파괴 대기)면 캐시로 확정하지 않음
+    // (더티 노드의 자손은 항상 더티라는 불변식 유지)
+    bWorldTransformDirty = AttachParent && (AttachParent->IsPendingDestroy() || AttachParent->bWorldTransformDirty);
+
+    return CachedWorldTransform;
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -153,12 +171,13 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     {
         RelativeTransform = W;
     }
+    MarkWorldTransformDirty();
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     RelativeScale = RelativeTransform.Scale3D;
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
  
 void USceneComponent::SetWorldLocation(const FVector& L)
@@ -260,7 +279,7 @@ void USceneComponent::AddLocalOffset(const FVector& Delta)
     const FVector parentDelta = RelativeRotation.RotateVector(Delta);
     RelativeLocation = RelativeLocation + parentDelta;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
@@ -268,7 +287,7 @@ void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
     RelativeRotation = (RelativeRotation * DeltaRot).GetNormalized(); // 로컬: 우측곱
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat& R)
@@ -277,13 +296,15 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
     RelativeRotation = R.GetNormalized();
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    NotifyTransformUpdated();
 }
 
 
-FMatrix USceneComponent::GetWorldMatrix() const
+const FMatrix& USceneComponent::GetWorldMatrix() const
 {
-    return GetWorldTransform().ToMatrix();
+    // GetWorldTransform이 CachedWorldMatrix까지 함께 갱신
+    GetWorldTransform();
+    return CachedWorldMatrix;
 }
  
 
@@ -321,6 +342,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
         if (Rule == EAttachmentRule::KeepWorld)
             RelativeTransform = OldWorld;
     }
+    MarkWorldTransformDirty();
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
@@ -340,6 +362,7 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
 
     if (bKeepWorld)
         RelativeTransform = OldWorld;
+    MarkWorldTransformDirty();
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
@@ -356,6 +379,7 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+    bWorldTransformDirty = true; // 원본에서 복사된 캐시는 원본 부모 기준
 }
 
 // ──────────────────────────────
@@ -364,6 +388,41 @@ void USceneComponent::DuplicateSubObjects()
 void USceneComponent::UpdateRelativeTransform()
 {
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    MarkWorldTransformDirty();
+}
+
+void USceneComponent::MarkWorldTransformDirty()
+{
+    if (bWorldTransformDirty)
+    {
+        return;
+    }
+
+    bWorldTransformDirty = true;
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
+    }
+}
+
+template<typename TJsonNode>
+void USceneComponent::LoadSceneData(const TJsonNode& InNode)
+{
+    // 나중에 자식의 Serialize 호출될 때 부모인 이 객체를 찾기 위해 Map에 추가
+    FJsonSerializer::ReadUint32(InNode, "Id", SceneId);
+    SceneIdMap.Add(SceneId, this);
+
+    // 부모 찾기
+    FJsonSerializer::ReadUint32(InNode, "ParentId", ParentId);
+
+    RelativeRotation = FQuat::MakeFromEulerZYX(RelativeRotationEuler).GetNormalized();
+
+    // 해당 객체의 Transform을 위에서 읽은 값을 기반으로 변경 후, 자식에게 전파
+    UpdateRelativeTransform();
+    OnTransformUpdated();
 }
 
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -372,18 +431,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 	if (bInIsLoading)
 	{
-        // 나중에 자식의 Serialize 호출될 때 부모인 이 객체를 찾기 위해 Map에 추가
-        FJsonSerializer::ReadUint32(InOutHandle, "Id", SceneId);
-        SceneIdMap.Add(SceneId, this);
-
-        // 부모 찾기
-        FJsonSerializer::ReadUint32(InOutHandle, "ParentId", ParentId);
-
-        RelativeRotation = FQuat::MakeFromEulerZYX(RelativeRotationEuler).GetNormalized();
-
-        // 해당 객체의 Transform을 위에서 읽은 값을 기반으로 변경 후, 자식에게 전파
-        UpdateRelativeTransform();
-        OnTransformUpdated();
+		LoadSceneData(InOutHandle);
 	}
 	else
 	{
@@ -400,6 +448,12 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USceneComponent::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	LoadSceneData(InNode);
+}
+
 void USceneComponent::OnRegister(UWorld* InWorld)
 {
     Super::OnRegister(InWorld);
@@ -418,6 +472,43 @@ void USceneComponent::OnRegister(UWorld* InWorld)
     OnTransformUpdated();
 }
 
+void USceneComponent::NotifyTransformUpdated()
+{
+    if (GDeferredTransformUpdates)
+    {
+        // 워커 스레드: 파티션/라이트 등 공유 상태는 메인 스레드 Flush에서 한 번만 갱신
+        if (!bTransformUpdatePending)
+        {
+            bTransformUpdatePending = true;
+            GDeferredTransformUpdates->Add(this);
+        }
+        return;
+    }
+
+    OnTransformUpdated();
+}
+
+TArray<USceneComponent*>* USceneComponent::SetDeferredTransformUpdates(TArray<USceneComponent*>* InList)
+{
+    TArray<USceneComponent*>* Prev = GDeferredTransformUpdates;
+    GDeferredTransformUpdates = InList;
+    return Prev;
+}
+
+void USceneComponent::FlushDeferredTransformUpdates(TArray<USceneComponent*>& InOutList)
+{
+    // 스레드 스케줄과 무관하게 같은 순서로 처리 (결정성)
+    std::sort(InOutList.begin(), InOutList.end(),
+        [](const USceneComponent* A, const USceneComponent* B) { return A->UUID < B->UUID; });
+
+    for (USceneComponent* Comp : InOutList)
+    {
+        Comp->bTransformUpdatePending = false;
+        Comp->OnTransformUpdated();
+    }
+    InOutList.Empty();
+}
+
 void USceneComponent::OnTransformUpdated()
 {
     for (USceneComponent* Child : GetAttachChildren())
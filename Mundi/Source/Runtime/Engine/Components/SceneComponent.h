@@ -46,7 +46,8 @@ public:
     // ──────────────────────────────
     // World Transform API
     // ──────────────────────────────
-    FTransform GetWorldTransform() const;
+    // 캐시된 월드 트랜스폼 반환 (더티일 때만 부모 체인을 따라 재계산)
+    const FTransform& GetWorldTransform() const;
     void SetWorldTransform(const FTransform& W);
 
     void SetWorldLocation(const FVector& L);
@@ -67,7 +68,7 @@ public:
     void AddLocalRotation(const FQuat& DeltaRot);
     void SetLocalLocationAndRotation(const FVector& L, const FQuat& R);
 
-    FMatrix GetWorldMatrix() const; // ToMatrixWithScale
+    const FMatrix& GetWorldMatrix() const; // ToMatrixWithScale (캐시)
       
     // ──────────────────────────────
     // Attach/Detach
@@ -90,14 +91,24 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        MarkWorldTransformDirty();
     }
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
     void OnRegister(UWorld* InWorld) override;
 
     virtual void OnTransformUpdated();
 
+    // 트랜스폼 Set/Add API가 호출. 병렬 틱 중이면 OnTransformUpdated를 메인 스레드 Flush까지 미룸
+    void NotifyTransformUpdated();
+
+    // 현재 스레드의 지연 목록을 교체하고 이전 목록을 반환 (FTickTaskManager 전용)
+    static TArray<USceneComponent*>* SetDeferredTransformUpdates(TArray<USceneComponent*>* InList);
+    // 메인 스레드에서 지연된 OnTransformUpdated를 UUID 순으로 실행하고 목록을 비움
+    static void FlushDeferredTransformUpdates(TArray<USceneComponent*>& InOutList);
+
     // SceneId
     uint32 GetSceneId() const { return SceneId; }
     void SetSceneId(uint32 InId) { SceneId = InId; }
@@ -153,6 +164,24 @@ protected:
     FTransform RelativeTransform;
 
     void UpdateRelativeTransform();
+
+    // 씬 Id/부모 Id를 읽고 로드된 트랜스폼을 적용 (json::JSON / 문서 노드 공용)
+    template<typename TJsonNode>
+    void LoadSceneData(const TJsonNode& InNode);
+
+    /**
+     * @brief 자신과 하위 컴포넌트의 월드 트랜스폼 캐시를 무효화.
+     * @note 더티 노드의 자손은 항상 더티이므로, 이미 더티인 노드에서 전파를 멈춤 (연속 Set 호출 시 O(1)).
+     */
+    void MarkWorldTransformDirty();
+
+    // 월드 트랜스폼 캐시 (GetWorldTransform/GetWorldMatrix에서 지연 갱신)
+    mutable FTransform CachedWorldTransform;
+    mutable FMatrix CachedWorldMatrix;
+    mutable bool bWorldTransformDirty = true;
+
+    // 지연 목록에 이미 들어가 있는지 (병렬 틱 한 번에 한 번만 추가)
+    bool bTransformUpdatePending = false;
     
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
@@ -32,6 +32,17 @@ void UShapeComponent::OnRegister(UWorld* InWorld)
     GetWorldAABB();
 }
 
+void UShapeComponent::OnReleasedToPool()
+{
+    Super::OnReleasedToPool();
+
+    // 재사용 시 이전 수명의 겹침으로 Begin/End 이벤트가 잘못 나가지 않도록 비움
+    OverlapNow.clear();
+    OverlapPrev.clear();
+    OverlapInfos.clear();
+    bOverlapUpdatePending = false;
+}
+
 void UShapeComponent::OnTransformUpdated()
 {
     GetWorldAABB();
@@ -61,33 +72,21 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
         OverlapInfos.clear();
     }
 
+    // 겹침 판정은 다른 액터가 모두 움직인 뒤 UWorld::Tick의 오버랩 단계에서 수행
+    bOverlapUpdatePending = true;
+}
+
+void UShapeComponent::UpdateOverlaps(const TArray<UShapeComponent*>& CurrentOverlaps)
+{
     UWorld* World = GetWorld();
     if (!World) return;
 
-    //Test용 O(N^2) 
+    // 월드 브로드페이즈가 계산한 겹침 목록 (같은 액터 제외, 상대가 bGenerateOverlapEvents인 것만)
     OverlapNow.clear();
 
-    for (AActor* Actor : World->GetActors())
+    for (UShapeComponent* Other : CurrentOverlaps)
     {
-        if (!Actor || !Actor->IsActorActive())
-            continue;
-
-        for (USceneComponent* Comp : Actor->GetSceneComponents())
-        {
-            UShapeComponent* Other = Cast<UShapeComponent>(Comp);
-            if (!Other || Other == this) continue;
-            if (Other->GetOwner() == this->GetOwner()) continue;
-            if (!Other->bGenerateOverlapEvents) continue;
-
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Other->GetOwner();
-
-            // Collision 모듈
-            if (!Collision::CheckOverlap(this, Other)) continue;
-
-            OverlapNow.Add(Other);
-            //UE_LOG("Collision!!");
-        }
+        OverlapNow.Add(Other);
     }
 
     // Publish current overlaps
@@ -40,8 +40,18 @@ public:
 	virtual void BeginPlay() override;
     virtual void OnRegister(UWorld* InWorld) override;
     virtual void OnTransformUpdated() override;
+    virtual void OnReleasedToPool() override;
 
-    void UpdateOverlaps(); 
+    // 오버랩 단계(FCollisionBroadphase::UpdateOverlaps)에서 호출. 이번 프레임 겹침 목록으로 Begin/End 이벤트 전달
+    void UpdateOverlaps(const TArray<UShapeComponent*>& CurrentOverlaps);
+
+    // 이번 프레임에 틱해서 오버랩 갱신을 요청했는지 확인하고 요청을 비움
+    bool ConsumeOverlapUpdateRequest()
+    {
+        const bool bRequested = bOverlapUpdatePending;
+        bOverlapUpdatePending = false;
+        return bRequested;
+    }
 
     FAABB GetWorldAABB() const override;
 	virtual const TArray<FOverlapInfo>& GetOverlapInfos() const override { return OverlapInfos; }
@@ -63,6 +73,7 @@ protected:
 	bool bShapeIsVisible;
 	bool bShapeHiddenInGame;
 	TArray<FOverlapInfo> OverlapInfos; 
+	bool bOverlapUpdatePending = false; // TickComponent에서 설정, 오버랩 단계에서 소비
 	//TODO: float LineThickness;
 
 };
@@ -51,6 +51,21 @@ void USkinnedMeshComponent::CollectMeshBatches(
     ID3D11DeviceContext* DeviceContext = GEngine.GetRHIDevice()->GetDeviceContext();
     SkeletalMesh->UpdateCPUSkinning(DeviceContext);
 
+    // 섹션별 머티리얼/셰이더 변형 결정은 메시, 머티리얼, 뷰 모드, 셰이더가 바뀔 때만 다시 수행
+    const TArray<FCachedMeshBatch>* CachedMeshBatches = FindCachedMeshBatches(View, SkeletalMesh);
+    if (!CachedMeshBatches)
+    {
+        CachedMeshBatches = &RebuildMeshBatchCache(View);
+    }
+
+    // CPU Skinning은 정점별로 처리되므로 템플릿에는 World Matrix만 채움
+    EmitCachedMeshBatches(*CachedMeshBatches, OutMeshBatchElements, SkeletalMesh->GetVertexBuffer(), SkeletalMesh->GetIndexBuffer());
+}
+
+const TArray<UMeshComponent::FCachedMeshBatch>& USkinnedMeshComponent::RebuildMeshBatchCache(const FSceneView* View)
+{
+    TArray<FCachedMeshBatch>& CachedMeshBatches = BeginMeshBatchCache(View, SkeletalMesh);
+
     const TArray<FFlesh>& FleshesInfo = SkeletalMesh->GetFleshesInfo();
 
     auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -64,7 +79,7 @@ void USkinnedMeshComponent::CollectMeshBatches(
         }
         else
         {
-            // Material이 없으면 기본 Material 사용 (매 프레임 호출되므로 로그 제거)
+            // Material이 없으면 기본 Material 사용
             Material = UResourceManager::GetInstance().GetDefaultMaterial();
             if (Material)
             {
@@ -85,10 +100,10 @@ void USkinnedMeshComponent::CollectMeshBatches(
     {
         uint32 IndexCount = 0;
         uint32 StartIndex = 0;
-        const FFlesh& Flesh = FleshesInfo[SectionIndex];
 
         if (bHasSections)
         {
+            const FFlesh& Flesh = FleshesInfo[SectionIndex];
             IndexCount = Flesh.IndexCount;
             StartIndex = Flesh.StartIndex;
         }
@@ -109,38 +124,76 @@ void USkinnedMeshComponent::CollectMeshBatches(
             continue;
         }
 
-        FMeshBatchElement BatchElement;
-        // View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
-        TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
-        if (0 < MaterialToUse->GetShaderMacros().Num())
-        {
-            ShaderMacros.Append(MaterialToUse->GetShaderMacros());
-        }
-        FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+        FCachedMeshBatch& Cached = CachedMeshBatches.emplace_back();
+        Cached.SectionIndex = SectionIndex;
+        Cached.SlotMaterial = GetMaterial(SectionIndex);
 
-        if (ShaderVariant)
-        {
-            BatchElement.VertexShader = ShaderVariant->VertexShader;
-            BatchElement.PixelShader = ShaderVariant->PixelShader;
-            BatchElement.InputLayout = ShaderVariant->InputLayout;
-        }
+        // 스키닝 결과가 컴포넌트마다 다르므로 인스턴싱 변형은 만들지 않음
+        FMeshBatchElement& BatchElement = Cached.Template;
+        ResolveShaderVariants(BatchElement, ShaderToUse, MaterialToUse, View, false);
 
         // UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
         // 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
         BatchElement.Material = MaterialToUse;
-        BatchElement.VertexBuffer = SkeletalMesh->GetVertexBuffer();
-        BatchElement.IndexBuffer = SkeletalMesh->GetIndexBuffer();
         BatchElement.VertexStride = SkeletalMesh->GetVertexStride();
         BatchElement.IndexCount = IndexCount;
         BatchElement.StartIndex = StartIndex;
         BatchElement.BaseVertexIndex = 0;
-
-        // CPU Skinning은 정점별로 처리되므로 여기서는 World Matrix만 설정
-        BatchElement.WorldMatrix = GetWorldMatrix();
-        BatchElement.ObjectID = InternalIndex;
         BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+    }
+
+    return CachedMeshBatches;
+}
 
-        OutMeshBatchElements.Add(BatchElement);
+template<typename TJsonArray>
+void USkinnedMeshComponent::LoadMaterialSlots(TJsonArray& SlotsArray)
+{
+    MaterialSlots.resize(SlotsArray.size());
+
+    for (int i = 0; i < SlotsArray.size(); ++i)
+    {
+        auto& SlotJson = SlotsArray.at(static_cast<uint32>(i));
+        if (SlotJson.IsNull())
+        {
+            MaterialSlots[i] = nullptr;
+            continue;
+        }
+
+        // 2. JSON에서 클래스 이름 읽기
+        FString ClassName;
+        FJsonSerializer::ReadString(SlotJson, "Type", ClassName, "None", false);
+
+        UMaterialInterface* LoadedMaterial = nullptr;
+
+        // 3. 클래스 이름에 따라 분기
+        if (ClassName == UMaterialInstanceDynamic::StaticClass()->Name)
+        {
+            // UMID는 인스턴스이므로, NewObject로 생성합니다.
+            UMaterialInstanceDynamic* NewMID = NewObject<UMaterialInstanceDynamic>();
+
+            // 4. 생성된 빈 객체에 노드 타입에 맞는 로드(Serialize(true) / LoadFromNode)를 호출하여 데이터를 채웁니다.
+            NewMID->LoadFrom(SlotJson);
+
+            // 5. 소유권 추적 배열에 추가합니다.
+            DynamicMaterialInstances.Add(NewMID);
+            LoadedMaterial = NewMID;
+        }
+        else // if(ClassName == UMaterial::StaticClass()->Name)
+        {
+            // UMaterial은 리소스이므로, AssetPath로 리소스 매니저에서 로드합니다.
+            FString AssetPath;
+            FJsonSerializer::ReadString(SlotJson, "AssetPath", AssetPath, "", false);
+            if (!AssetPath.empty())
+            {
+                LoadedMaterial = UResourceManager::GetInstance().Load<UMaterial>(AssetPath);
+            }
+            else
+            {
+                LoadedMaterial = nullptr;
+            }
+        }
+
+        MaterialSlots[i] = LoadedMaterial;
     }
 }
 
@@ -168,53 +221,7 @@ void USkinnedMeshComponent::Serialize(
             false
         ))
         {
-            MaterialSlots.resize(SlotsArrayJson.size());
-
-            for (int i = 0; i < SlotsArrayJson.size(); ++i)
-            {
-                JSON& SlotJson = SlotsArrayJson.at(i);
-                if (SlotJson.IsNull())
-                {
-                    MaterialSlots[i] = nullptr;
-                    continue;
-                }
-
-                // 2. JSON에서 클래스 이름 읽기
-                FString ClassName;
-                FJsonSerializer::ReadString(SlotJson, "Type", ClassName, "None", false);
-
-                UMaterialInterface* LoadedMaterial = nullptr;
-
-                // 3. 클래스 이름에 따라 분기
-                if (ClassName == UMaterialInstanceDynamic::StaticClass()->Name)
-                {
-                    // UMID는 인스턴스이므로, NewObject로 생성합니다.
-                    UMaterialInstanceDynamic* NewMID = NewObject<UMaterialInstanceDynamic>();
-
-                    // 4. 생성된 빈 객체에 Serialize(true)를 호출하여 데이터를 채웁니다.
-                    NewMID->Serialize(true, SlotJson);
-
-                    // 5. 소유권 추적 배열에 추가합니다.
-                    DynamicMaterialInstances.Add(NewMID);
-                    LoadedMaterial = NewMID;
-                }
-                else // if(ClassName == UMaterial::StaticClass()->Name)
-                {
-                    // UMaterial은 리소스이므로, AssetPath로 리소스 매니저에서 로드합니다.
-                    FString AssetPath;
-                    FJsonSerializer::ReadString(SlotJson, "AssetPath", AssetPath, "", false);
-                    if (!AssetPath.empty())
-                    {
-                        LoadedMaterial = UResourceManager::GetInstance().Load<UMaterial>(AssetPath);
-                    }
-                    else
-                    {
-                        LoadedMaterial = nullptr;
-                    }
-                }
-
-                MaterialSlots[i] = LoadedMaterial;
-            }
+            LoadMaterialSlots(SlotsArrayJson);
         }
     }
     else // --- 저장 ---
@@ -246,10 +253,24 @@ void USkinnedMeshComponent::Serialize(
     }
 }
 
+void USkinnedMeshComponent::LoadFromNode(const FJsonValue& InNode)
+{
+    Super::LoadFromNode(InNode);
+
+    ClearDynamicMaterials();
+
+    const FJsonValue* SlotsArray = nullptr;
+    if (FJsonSerializer::ReadArray(InNode, "MaterialSlots", SlotsArray, false))
+    {
+        LoadMaterialSlots(*SlotsArray);
+    }
+}
+
 void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
 {
     // 새 메시를 설정하기 전에, 기존에 생성된 모든 MID와 슬롯 정보를 정리합니다.
     ClearDynamicMaterials();
+    InvalidateMeshBatchCache();
 
     // PathFileName이 비어있거나 "None"이면 nullptr로 설정
     if (PathFileName.empty() || PathFileName == "None")
@@ -360,6 +381,7 @@ void USkinnedMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterfac
 
     // 6. 새 머티리얼을 슬롯에 할당합니다.
     MaterialSlots[InElementIndex] = InNewMaterial;
+    InvalidateMeshBatchCache();
 }
     
 UMaterialInstanceDynamic* USkinnedMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
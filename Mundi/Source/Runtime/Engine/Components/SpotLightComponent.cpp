@@ -790,6 +790,12 @@ void USpotLightComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USpotLightComponent::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	ValidateConeAngles();
+}
+
 void USpotLightComponent::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
@@ -67,6 +67,7 @@ public:
 
 	// Serialization & Duplication
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 	virtual void DuplicateSubObjects() override;
 	DECLARE_DUPLICATE(USpotLightComponent)
 
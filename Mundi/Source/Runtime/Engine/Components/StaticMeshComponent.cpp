@@ -78,6 +78,20 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		return;
 	}
 
+	// 섹션별 머티리얼/셰이더 변형 결정은 메시, 머티리얼, 뷰 모드, 셰이더가 바뀔 때만 다시 수행
+	const TArray<FCachedMeshBatch>* CachedMeshBatches = FindCachedMeshBatches(View, StaticMesh);
+	if (!CachedMeshBatches)
+	{
+		CachedMeshBatches = &RebuildMeshBatchCache(View);
+	}
+
+	EmitCachedMeshBatches(*CachedMeshBatches, OutMeshBatchElements, StaticMesh->GetVertexBuffer(), StaticMesh->GetIndexBuffer());
+}
+
+const TArray<UMeshComponent::FCachedMeshBatch>& UStaticMeshComponent::RebuildMeshBatchCache(const FSceneView* View)
+{
+	TArray<FCachedMeshBatch>& CachedMeshBatches = BeginMeshBatchCache(View, StaticMesh);
+
 	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -137,43 +151,31 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			continue;
 		}
 
-		FMeshBatchElement BatchElement;
-		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
-		TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
-		if (0 < MaterialToUse->GetShaderMacros().Num())
-		{
-			ShaderMacros.Append(MaterialToUse->GetShaderMacros());
-		}
-		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+		FCachedMeshBatch& Cached = CachedMeshBatches.emplace_back();
+		Cached.SectionIndex = SectionIndex;
+		Cached.SlotMaterial = GetMaterial(SectionIndex);
 
-		if (ShaderVariant)
-		{
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
-		}
+		FMeshBatchElement& BatchElement = Cached.Template;
+		ResolveShaderVariants(BatchElement, ShaderToUse, MaterialToUse, View, true);
 
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
 		BatchElement.Material = MaterialToUse;
-		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
-		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
 		BatchElement.IndexCount = IndexCount;
 		BatchElement.StartIndex = StartIndex;
 		BatchElement.BaseVertexIndex = 0;
-		BatchElement.WorldMatrix = GetWorldMatrix();
-		BatchElement.ObjectID = InternalIndex;
 		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-
-		OutMeshBatchElements.Add(BatchElement);
 	}
+
+	return CachedMeshBatches;
 }
 
 void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 {
 	// 새 메시를 설정하기 전에, 기존에 생성된 모든 MID와 슬롯 정보를 정리합니다.
 	ClearDynamicMaterials();
+	InvalidateMeshBatchCache();
 
 	// PathFileName이 비어있거나 "None"이면 nullptr로 설정
 	if (PathFileName.empty() || PathFileName == "None")
@@ -270,6 +272,7 @@ void UStaticMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface
 
 	// 6. 새 머티리얼을 슬롯에 할당합니다.
 	MaterialSlots[InElementIndex] = InNewMaterial;
+	InvalidateMeshBatchCache();
 }
 
 UMaterialInstanceDynamic* UStaticMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
@@ -455,6 +458,62 @@ void UStaticMeshComponent::DuplicateSubObjects()
 	}
 }
 
+template<typename TJsonArray>
+void UStaticMeshComponent::LoadMaterialSlots(TJsonArray& SlotsArray)
+{
+	MaterialSlots.resize(SlotsArray.size());
+
+	for (int i = 0; i < SlotsArray.size(); ++i)
+	{
+		auto& SlotJson = SlotsArray.at(static_cast<uint32>(i));
+		if (SlotJson.IsNull())
+		{
+			MaterialSlots[i] = nullptr;
+			continue;
+		}
+
+		// 2. JSON에서 클래스 이름 읽기
+		FString ClassName;
+		FJsonSerializer::ReadString(SlotJson, "Type", ClassName, "None", false);
+
+		UMaterialInterface* LoadedMaterial = nullptr;
+
+		// 3. 클래스 이름에 따라 분기
+		if (ClassName == UMaterialInstanceDynamic::StaticClass()->Name)
+		{
+			// UMID는 인스턴스이므로, 'new'로 생성합니다.
+			// (참고: 리플렉션 팩토리가 있다면 FReflectionFactory::CreateObject(ClassName) 사용)
+			UMaterialInstanceDynamic* NewMID = new UMaterialInstanceDynamic();
+
+			// 4. 생성된 빈 객체에 노드 타입에 맞는 로드(Serialize(true) / LoadFromNode)를 호출하여 데이터를 채웁니다.
+			NewMID->LoadFrom(SlotJson);
+
+			// 5. 소유권 추적 배열에 추가합니다.
+			DynamicMaterialInstances.Add(NewMID);
+			LoadedMaterial = NewMID;
+		}
+		else // if(ClassName == UMaterial::StaticClass()->Name)
+		{
+			// UMaterial은 리소스이므로, AssetPath로 리소스 매니저에서 로드합니다.
+			FString AssetPath;
+			FJsonSerializer::ReadString(SlotJson, "AssetPath", AssetPath, "", false);
+			if (!AssetPath.empty())
+			{
+				LoadedMaterial = UResourceManager::GetInstance().Load<UMaterial>(AssetPath);
+			}
+			else
+			{
+				LoadedMaterial = nullptr;
+			}
+
+			// UMaterial::Serialize(true)는 호출할 필요가 없습니다 (혹은 호출해도 됨).
+			// 리소스 로드가 주 목적이기 때문입니다.
+		}
+
+		MaterialSlots[i] = LoadedMaterial;
+	}
+}
+
 void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
@@ -469,57 +528,7 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		JSON SlotsArrayJson;
 		if (FJsonSerializer::ReadArray(InOutHandle, MaterialSlotsKey, SlotsArrayJson, JSON::Make(JSON::Class::Array), false))
 		{
-			MaterialSlots.resize(SlotsArrayJson.size());
-
-			for (int i = 0; i < SlotsArrayJson.size(); ++i)
-			{
-				JSON& SlotJson = SlotsArrayJson.at(i);
-				if (SlotJson.IsNull())
-				{
-					MaterialSlots[i] = nullptr;
-					continue;
-				}
-
-				// 2. JSON에서 클래스 이름 읽기
-				FString ClassName;
-				FJsonSerializer::ReadString(SlotJson, "Type", ClassName, "None", false);
-
-				UMaterialInterface* LoadedMaterial = nullptr;
-
-				// 3. 클래스 이름에 따라 분기
-				if (ClassName == UMaterialInstanceDynamic::StaticClass()->Name)
-				{
-					// UMID는 인스턴스이므로, 'new'로 생성합니다.
-					// (참고: 리플렉션 팩토리가 있다면 FReflectionFactory::CreateObject(ClassName) 사용)
-					UMaterialInstanceDynamic* NewMID = new UMaterialInstanceDynamic();
-
-					// 4. 생성된 빈 객체에 Serialize(true)를 호출하여 데이터를 채웁니다.
-					NewMID->Serialize(true, SlotJson); // (const_cast)
-
-					// 5. 소유권 추적 배열에 추가합니다.
-					DynamicMaterialInstances.Add(NewMID);
-					LoadedMaterial = NewMID;
-				}
-				else // if(ClassName == UMaterial::StaticClass()->Name)
-				{
-					// UMaterial은 리소스이므로, AssetPath로 리소스 매니저에서 로드합니다.
-					FString AssetPath;
-					FJsonSerializer::ReadString(SlotJson, "AssetPath", AssetPath, "", false);
-					if (!AssetPath.empty())
-					{
-						LoadedMaterial = UResourceManager::GetInstance().Load<UMaterial>(AssetPath);
-					}
-					else
-					{
-						LoadedMaterial = nullptr;
-					}
-
-					// UMaterial::Serialize(true)는 호출할 필요가 없습니다 (혹은 호출해도 됨).
-					// 리소스 로드가 주 목적이기 때문입니다.
-				}
-
-				MaterialSlots[i] = LoadedMaterial;
-			}
+			LoadMaterialSlots(SlotsArrayJson);
 		}
 	}
 	else // --- 저장 ---
@@ -547,3 +556,16 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		InOutHandle[MaterialSlotsKey] = SlotsArrayJson;
 	}
 }
+
+void UStaticMeshComponent::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+
+	ClearDynamicMaterials();
+
+	const FJsonValue* SlotsArray = nullptr;
+	if (FJsonSerializer::ReadArray(InNode, "MaterialSlots", SlotsArray, false))
+	{
+		LoadMaterialSlots(*SlotsArray);
+	}
+}
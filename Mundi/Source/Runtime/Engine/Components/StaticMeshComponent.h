@@ -27,6 +27,7 @@ public:
 	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 	void SetStaticMesh(const FString& PathFileName);
 
@@ -52,6 +53,13 @@ protected:
 	void OnTransformUpdated() override;
 	void MarkWorldPartitionDirty();
 
+	// 저장된 머티리얼 슬롯 배열로 MaterialSlots 구성 (json::JSON / 문서 노드 공용)
+	template<typename TJsonArray>
+	void LoadMaterialSlots(TJsonArray& SlotsArray);
+
+	// 섹션별 머티리얼/셰이더 변형을 다시 결정해서 배치 캐시를 채움
+	const TArray<FCachedMeshBatch>& RebuildMeshBatchCache(const FSceneView* View);
+
 protected:
 	UStaticMesh* StaticMesh = nullptr;
 	TArray<UMaterialInterface*> MaterialSlots;
@@ -0,0 +1,168 @@
+﻿#include "pch.h"
+#include "ActorPool.h"
+#include "Actor.h"
+#include "SelectionManager.h"
+
+AActor* FActorPool::PopFree(TArray<TWeakObjectPtr<AActor>>& FreeList)
+{
+	while (!FreeList.IsEmpty())
+	{
+		TWeakObjectPtr<AActor> Entry = FreeList.Pop();
+		PooledActors.Remove(Entry);
+
+		AActor* Actor = Entry.Get();
+		if (Actor && !Actor->IsPendingDestroy() && Actor->GetWorld() == World)
+		{
+			return Actor;
+		}
+
+		// 풀에 있는 동안 파괴된 액터는 프리팹 정보도 함께 제거
+		PrefabActors.Remove(Entry);
+	}
+	return nullptr;
+}
+
+void FActorPool::AddPrefabActor(AActor* Actor, const FWideString& PrefabPath)
+{
+	if (PrefabActors.Num() >= PrefabActorsPruneThreshold)
+	{
+		PruneExpiredPrefabActors();
+	}
+	PrefabActors.Add(TWeakObjectPtr<AActor>(Actor), FPrefabPoolInfo{ PrefabPath, Actor->GetActorTransform() });
+}
+
+void FActorPool::PruneExpiredPrefabActors()
+{
+	// 키는 슬롯 번호 + 일련번호라 객체가 삭제된 뒤에도 해시/비교가 안전함
+	for (auto It = PrefabActors.begin(); It != PrefabActors.end();)
+	{
+		if (!It->first.IsValid())
+		{
+			It = PrefabActors.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+	PrefabActorsPruneThreshold = std::max(64, PrefabActors.Num() * 2);
+}
+
+void FActorPool::Reactivate(AActor* Actor, const FTransform& Transform)
+{
+	Actor->SetActorActive(true);
+	Actor->SetActorTransform(Transform);
+
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		if (Component)
+		{
+			Component->OnAcquiredFromPool();
+		}
+	}
+
+	World->GetLightManager()->SetDirtyFlag();
+}
+
+AActor* FActorPool::Acquire(UClass* Class, const FTransform& Transform)
+{
+	if (TArray<TWeakObjectPtr<AActor>>* FreeList = ClassPools.Find(Class))
+	{
+		if (AActor* Actor = PopFree(*FreeList))
+		{
+			Reactivate(Actor, Transform);
+			return Actor;
+		}
+	}
+
+	return World->SpawnActor(Class, Transform);
+}
+
+AActor* FActorPool::AcquirePrefab(const FWideString& PrefabPath)
+{
+	if (TArray<TWeakObjectPtr<AActor>>* FreeList = PrefabPools.Find(PrefabPath))
+	{
+		if (AActor* Actor = PopFree(*FreeList))
+		{
+			Reactivate(Actor, PrefabActors[TWeakObjectPtr<AActor>(Actor)].SpawnTransform);
+			return Actor;
+		}
+	}
+
+	AActor* NewActor = World->SpawnPrefabActor(PrefabPath);
+	if (NewActor)
+	{
+		AddPrefabActor(NewActor, PrefabPath);
+	}
+	return NewActor;
+}
+
+bool FActorPool::Release(AActor* Actor)
+{
+	if (!Actor || Actor->IsPendingDestroy() || Actor->GetWorld() != World)
+	{
+		return false;
+	}
+
+	const TWeakObjectPtr<AActor> Key(Actor);
+	if (PooledActors.Contains(Key))
+	{
+		return false;
+	}
+
+	if (USelectionManager* SelectionMgr = World->GetSelectionManager())
+	{
+		SelectionMgr->DeselectActor(Actor);
+	}
+
+	// 틱/렌더 수집/오버랩 브로드페이즈에서 제외
+	Actor->SetActorActive(false);
+
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		if (Component)
+		{
+			Component->OnReleasedToPool();
+		}
+	}
+
+	World->GetLightManager()->SetDirtyFlag();
+
+	PooledActors.Add(Key);
+	if (const FPrefabPoolInfo* PrefabInfo = PrefabActors.Find(Key))
+	{
+		PrefabPools[PrefabInfo->PrefabPath].Add(Key);
+	}
+	else
+	{
+		ClassPools[Actor->GetClass()].Add(Key);
+	}
+	return true;
+}
+
+void FActorPool::Prewarm(UClass* Class, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Release(World->SpawnActor(Class, FTransform()));
+	}
+}
+
+void FActorPool::PrewarmPrefab(const FWideString& PrefabPath, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		AActor* NewActor = World->SpawnPrefabActor(PrefabPath);
+		if (!NewActor)
+		{
+			return;
+		}
+		AddPrefabActor(NewActor, PrefabPath);
+		Release(NewActor);
+	}
+}
+
+bool FActorPool::IsInPool(AActor* Actor) const
+{
+	return Actor && PooledActors.Contains(TWeakObjectPtr<AActor>(Actor));
+}
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+class AActor;
+class UWorld;
+
+/**
+ * @class FActorPool
+ * @brief 월드 단위 액터 풀. 클래스 또는 프리팹 경로별로 반납된 액터를 보관했다가 재사용합니다.
+ *
+ * 반납된 액터는 레벨과 컴포넌트, 메모리를 그대로 유지한 채 비활성화(틱/렌더/충돌 제외)됩니다.
+ * 프리미티브 컴포넌트는 파티션 BVH 슬롯을 유지하므로(Park) 재사용 시 리빌드 없이 리핏만 발생합니다.
+ * 재사용되는 액터는 BeginPlay를 다시 호출하지 않습니다. (처음 스폰될 때 한 번)
+ * 대신 컴포넌트의 OnAcquiredFromPool에서 스폰 시점 상태를 되돌립니다. (이동 컴포넌트의 속도/가속도, 발사체 수명 등)
+ */
+class FActorPool
+{
+public:
+	explicit FActorPool(UWorld* InWorld) : World(InWorld) {}
+
+	// 풀에 있으면 꺼내서 활성화, 없으면 새로 스폰
+	AActor* Acquire(UClass* Class, const FTransform& Transform);
+	// 프리팹 풀: 재사용 시 처음 스폰됐을 때의 트랜스폼으로 되돌림
+	AActor* AcquirePrefab(const FWideString& PrefabPath);
+
+	// 비활성화 후 풀에 보관. 풀에서 나오지 않은 액터는 클래스 풀로 들어감
+	bool Release(AActor* Actor);
+
+	// 미리 Count개를 스폰해서 풀에 채워 둠 (BeginPlay 등에서 호출)
+	void Prewarm(UClass* Class, int32 Count);
+	void PrewarmPrefab(const FWideString& PrefabPath, int32 Count);
+
+	bool IsInPool(AActor* Actor) const;
+	int32 GetNumPooled() const { return PooledActors.Num(); }
+
+private:
+	// 풀 목록 끝에서 아직 살아 있는 액터를 꺼냄 (풀에 있는 동안 파괴된 액터는 건너뜀)
+	AActor* PopFree(TArray<TWeakObjectPtr<AActor>>& FreeList);
+	void Reactivate(AActor* Actor, const FTransform& Transform);
+
+	// 프리팹으로 스폰된 액터 등록. 풀 밖에서 파괴된 액터의 키가 쌓이지 않도록 임계값마다 만료된 키를 정리
+	void AddPrefabActor(AActor* Actor, const FWideString& PrefabPath);
+	void PruneExpiredPrefabActors();
+
+	struct FPrefabPoolInfo
+	{
+		FWideString PrefabPath;
+		FTransform SpawnTransform;
+	};
+
+	UWorld* World = nullptr;
+
+	TMap<UClass*, TArray<TWeakObjectPtr<AActor>>> ClassPools;
+	TMap<FWideString, TArray<TWeakObjectPtr<AActor>>> PrefabPools;
+
+	// 프리팹으로 스폰된 액터 -> 반납할 프리팹 풀
+	TMap<TWeakObjectPtr<AActor>, FPrefabPoolInfo> PrefabActors;
+	// PrefabActors가 이 개수에 도달하면 정리 (정리 후 남은 수의 2배로 갱신하므로 분할 상환 O(1))
+	int32 PrefabActorsPruneThreshold = 64;
+	// 현재 풀에 들어가 있는 액터 (중복 반납 방지)
+	TSet<TWeakObjectPtr<AActor>> PooledActors;
+};
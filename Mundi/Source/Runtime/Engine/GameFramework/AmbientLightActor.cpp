@@ -43,3 +43,9 @@ void AAmbientLightActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		LightComponent = Cast<UAmbientLightComponent>(RootComponent);
 	}
 }
+
+void AAmbientLightActor::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	LightComponent = Cast<UAmbientLightComponent>(RootComponent);
+}
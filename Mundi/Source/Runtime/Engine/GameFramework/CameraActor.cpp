@@ -191,27 +191,33 @@ void ACameraActor::ProcessEditorCameraInput(float DeltaSeconds)
     ProcessCameraZoom(DeltaSeconds);
 }
 
+template<typename TJsonNode>
+void ACameraActor::LoadCameraSettings(const TJsonNode& InNode)
+{
+    FJsonSerializer::ReadFloat(InNode, "MouseSensitivity", MouseSensitivity, 0.1f);
+    FJsonSerializer::ReadFloat(InNode, "CameraMoveSpeed", CameraMoveSpeed, 10.0f);
+    FJsonSerializer::ReadFloat(InNode, "CameraYawDeg", CameraYawDeg, 0.0f);
+    FJsonSerializer::ReadFloat(InNode, "CameraPitchDeg", CameraPitchDeg, 0.0f);
+    FJsonSerializer::ReadBool(InNode, "PerspectiveCameraInput", PerspectiveCameraInput, false);
+
+    // CameraComponent 포인터는 DuplicateSubObjects()에서 복원됨
+    for (UActorComponent* Component : OwnedComponents)
+    {
+        if (UCameraComponent* CameraComp = Cast<UCameraComponent>(Component))
+        {
+            CameraComponent = CameraComp;
+            break;
+        }
+    }
+}
+
 void ACameraActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
     // 수동 직렬화 (프로퍼티로 등록되지 않은 변수들)
     if (bInIsLoading)
     {
-        FJsonSerializer::ReadFloat(InOutHandle, "MouseSensitivity", MouseSensitivity, 0.1f);
-        FJsonSerializer::ReadFloat(InOutHandle, "CameraMoveSpeed", CameraMoveSpeed, 10.0f);
-        FJsonSerializer::ReadFloat(InOutHandle, "CameraYawDeg", CameraYawDeg, 0.0f);
-        FJsonSerializer::ReadFloat(InOutHandle, "CameraPitchDeg", CameraPitchDeg, 0.0f);
-        FJsonSerializer::ReadBool(InOutHandle, "PerspectiveCameraInput", PerspectiveCameraInput, false);
-
-        // CameraComponent 포인터는 DuplicateSubObjects()에서 복원됨
-        for (UActorComponent* Component : OwnedComponents)
-        {
-            if (UCameraComponent* CameraComp = Cast<UCameraComponent>(Component))
-            {
-                CameraComponent = CameraComp;
-                break;
-            }
-        }
+        LoadCameraSettings(InOutHandle);
     }
     else
     {
@@ -223,6 +229,12 @@ void ACameraActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void ACameraActor::LoadFromNode(const FJsonValue& InNode)
+{
+    Super::LoadFromNode(InNode);
+    LoadCameraSettings(InNode);
+}
+
 void ACameraActor::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
@@ -63,6 +63,7 @@ public:
 
     // ───── 직렬화 관련 ────────────────────────────
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
 
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
@@ -80,6 +81,10 @@ private:
 
     bool PerspectiveCameraInput = false;
     
+    // 카메라 조작 값 로드 + CameraComponent 포인터 재연결 (json::JSON / 문서 노드 공용)
+    template<typename TJsonNode>
+    void LoadCameraSettings(const TJsonNode& InNode);
+
     // Camera input processing methods
     void ProcessCameraRotation(float DeltaSeconds);
     void ProcessCameraMovement(float DeltaSeconds);
@@ -44,3 +44,9 @@ void ADecalActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		DecalComponent = Cast<UDecalComponent>(RootComponent);
 	}
 }
+
+void ADecalActor::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	DecalComponent = Cast<UDecalComponent>(RootComponent);
+}
@@ -22,6 +22,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
 
 protected:
     UDecalComponent* DecalComponent;
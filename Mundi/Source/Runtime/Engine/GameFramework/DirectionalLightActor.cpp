@@ -43,3 +43,9 @@ void ADirectionalLightActor::Serialize(const bool bInIsLoading, JSON& InOutHandl
 		LightComponent = Cast<UDirectionalLightComponent>(RootComponent);
 	}
 }
+
+void ADirectionalLightActor::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	LightComponent = Cast<UDirectionalLightComponent>(RootComponent);
+}
@@ -20,6 +20,7 @@ public:
 	DECLARE_DUPLICATE(ADirectionalLightActor)
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 protected:
 	UDirectionalLightComponent* LightComponent;
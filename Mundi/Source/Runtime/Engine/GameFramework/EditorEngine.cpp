@@ -6,6 +6,9 @@
 #include <ObjManager.h>
 #include "FbxManager.h"
 #include "MemoryManager.h"
+#include "PlatformTime.h"
+#include "PIEStats.h"
+#include "PrefabCache.h"
 
 
 float UEditorEngine::ClientWidth = 1024.0f;
@@ -177,6 +180,9 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
+    // 정적 클래스 등록이 끝난 시점: IsA/Cast용 클래스 트리 구간 계산
+    UClass::BuildClassTree();
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -218,6 +224,9 @@ void UEditorEngine::Tick(float DeltaSeconds)
 {
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
+
+    // 프리팹 파일 수정 여부는 프레임당 한 번만 확인
+    FPrefabCache::GetInstance().BeginFrame();
     
     //@TODO: Delta Time 계산 + EditorActor Tick은 어떻게 할 것인가 
     for (auto& WorldContext : WorldContexts)
@@ -341,6 +350,9 @@ void UEditorEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 레벨에 속하지 않은 프리팹 아키타입 해제
+    FPrefabCache::GetInstance().Clear();
+
     // Release ImGui first (it may hold D3D11 resources)
     UUIManager::GetInstance().Release();
 
@@ -371,6 +383,7 @@ void UEditorEngine::Shutdown()
 void UEditorEngine::StartPIE()
 {
     UE_LOG("[info] START PIE");
+    const uint64 StartCycles = FPlatformTime::Cycles64();
 
     UWorld* EditorWorld = WorldContexts[0].World;
     UWorld* PIEWorld = UWorld::DuplicateWorldForPIE(EditorWorld);
@@ -381,6 +394,7 @@ void UEditorEngine::StartPIE()
     bPIEActive = true;
 
     // BeginPlay 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
+    const uint64 BeginPlayCycles = FPlatformTime::Cycles64();
     TArray<AActor*> LevelActors = GWorld->GetLevel()->GetActors();
     for (AActor* Actor : LevelActors)
     {
@@ -390,6 +404,15 @@ void UEditorEngine::StartPIE()
 
     // NOTE: BeginPlay 중에 삭제된 액터 삭제 후 Tick 시작
     GWorld->ProcessPendingKillActors();
+
+    // DuplicateWorldForPIE가 기록한 복제/등록 시간에 BeginPlay와 전체 시간을 더해 STAT PIE로 표시
+    FPIEStats Stats = FPIEStatManager::GetInstance().GetStats();
+    Stats.BeginPlayMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BeginPlayCycles);
+    Stats.TotalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    FPIEStatManager::GetInstance().UpdateStats(Stats);
+
+    UE_LOG("[info] PIE started in %.2f ms (%u actors: duplicate %.2f ms, register %.2f ms, BeginPlay %.2f ms)",
+        Stats.TotalMs, Stats.NumActors, Stats.DuplicateMs, Stats.RegisterMs, Stats.BeginPlayMs);
 }
 
 void UEditorEngine::EndPIE()
@@ -22,7 +22,11 @@ public:
 	DECLARE_DUPLICATE(AFakeSpotLightActor)
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 protected:
+	// 로드된 데칼/빌보드 컴포넌트로 생성자의 native 컴포넌트를 교체
+	void ReplaceNativeComponentsWithLoaded();
+
 	UBillboardComponent* BillboardComponent{};
 	UPerspectiveDecalComponent* DecalComponent{};
 };
@@ -6,6 +6,7 @@
 #include "PlayerCameraManager.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
+#include "PrefabCache.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -171,6 +172,9 @@ bool UGameEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UGameEngine::Startup(HINSTANCE hInstance)
 {
+    // 정적 클래스 등록이 끝난 시점: IsA/Cast용 클래스 트리 구간 계산
+    UClass::BuildClassTree();
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -231,6 +235,9 @@ void UGameEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 프리팹 파일 수정 여부는 프레임당 한 번만 확인
+    FPrefabCache::GetInstance().BeginFrame();
+
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
@@ -331,6 +338,9 @@ void UGameEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 레벨에 속하지 않은 프리팹 아키타입 해제
+    FPrefabCache::GetInstance().Clear();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
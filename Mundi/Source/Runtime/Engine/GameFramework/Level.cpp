@@ -11,6 +11,7 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "BinarySerializer.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -37,6 +38,50 @@ std::unique_ptr<ULevel> ULevelService::CreateDefaultLevel()
     return NewLevel;
 }
 
+bool ULevelService::LoadLevelFromFile(ULevel* Level, const FWideString& FilePath)
+{
+    if (FBinarySerializer::IsBinaryFile(FilePath))
+    {
+        // 손상된 레코드로 로드 도중 예외가 나면 반쯤 채워진 레벨과 액터가 남지 않도록 정리
+        const int32 NumExistingActors = Level->GetActors().Num();
+        if (!FBinarySerializer::LoadFromFile(FilePath, [Level](const FJsonValue& Root) { Level->LoadFromDocument(Root); }))
+        {
+            Level->DestroyActorsAfter(NumExistingActors);
+            return false;
+        }
+        return true;
+    }
+
+    FJsonDocument LevelDocument;
+    if (!FJsonSerializer::LoadJsonDocumentFromFile(LevelDocument, FilePath))
+    {
+        return false;
+    }
+    Level->LoadFromDocument(LevelDocument.GetRoot());
+    return true;
+}
+
+bool ULevelService::SaveLevelToFile(ULevel* Level, const FWideString& FilePath)
+{
+    return FBinarySerializer::SaveToFile(FilePath, [Level](JSON& Root) { Level->Serialize(false, Root); });
+}
+
+bool ULevelService::ExportLevelToJson(ULevel* Level, const FWideString& FilePath)
+{
+    JSON LevelJson;
+    Level->Serialize(false, LevelJson);
+    return FJsonSerializer::SaveJsonToFile(LevelJson, FilePath);
+}
+
+void ULevel::DestroyActorsAfter(int32 NumKeptActors)
+{
+    for (int32 i = NumKeptActors; i < Actors.Num(); ++i)
+    {
+        ObjectFactory::DeleteObject(Actors[i]);
+    }
+    Actors.SetNum(std::min(NumKeptActors, Actors.Num()));
+}
+
 //어느 레벨이든 기본적으로 존재하는 엑터(디렉셔널 라이트) 생성
 void ULevel::SpawnDefaultActors()
 {
@@ -49,18 +94,98 @@ void ULevel::SpawnDefaultActors()
    
 }
 
-void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+struct FPerspectiveCameraData
 {
-    Super::Serialize(bInIsLoading, InOutHandle);
+    FVector Location;
+    FVector Rotation;
+    float FOV;
+    float NearClip;
+    float FarClip;
+};
+
+template<typename TJsonNode>
+void ULevel::LoadPerspectiveCamera(const TJsonNode& InCameraJson)
+{
+    ACameraActor* CamActor = GWorld->GetEditorCameraActor();
+    FPerspectiveCameraData CamData;
+    if (CamActor)
+    {
+        // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+        // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
+        FJsonSerializer::ReadVector(InCameraJson, "Location", CamData.Location);
+        FJsonSerializer::ReadVector(InCameraJson, "Rotation", CamData.Rotation);
+        FJsonSerializer::ReadArrayFloat(InCameraJson, "FOV", CamData.FOV);
+        FJsonSerializer::ReadArrayFloat(InCameraJson, "NearClip", CamData.NearClip);
+        FJsonSerializer::ReadArrayFloat(InCameraJson, "FarClip", CamData.FarClip);
+
+        CamActor->SetActorLocation(CamData.Location);
+        CamActor->SetRotationFromEulerAngles(CamData.Rotation);
+        if (auto* CamComp = CamActor->GetCameraComponent())
+        {
+            CamComp->SetFOV(CamData.FOV);
+            CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
+        }
+    }
+}
 
-    struct FPerspectiveCameraData
+AActor* ULevel::SpawnSerializedActor(const FString& TypeString)
+{
+    //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
+    UClass* NewClass = UClass::FindClass(TypeString);
+
+    // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
+    if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
     {
-        FVector Location;
-        FVector Rotation;
-        float FOV;
-        float NearClip;
-        float FarClip;
-    };
+        UE_LOG("SpawnActor failed: Invalid class provided.");
+        return nullptr;
+    }
+
+    // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+    AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+    if (!NewActor)
+    {
+        UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
+        return nullptr;
+    }
+
+    AddActor(NewActor);
+    return NewActor;
+}
+
+void ULevel::LoadFromDocument(const FJsonValue& InRoot)
+{
+    LoadProperties(InRoot);
+
+    // 카메라 정보
+    const FJsonValue* PerspectiveCameraData = nullptr;
+    if (FJsonSerializer::ReadObject(InRoot, "PerspectiveCamera", PerspectiveCameraData))
+    {
+        LoadPerspectiveCamera(*PerspectiveCameraData);
+    }
+
+    // Actors 정보: 액터/컴포넌트도 LoadFromNode로 문서 노드를 바로 읽음
+    const FJsonValue* ActorListJson = nullptr;
+    if (FJsonSerializer::ReadObject(InRoot, "Actors", ActorListJson))
+    {
+        for (const FJsonMember& ActorMember : ActorListJson->ObjectRange())
+        {
+            FString TypeString;
+            FJsonSerializer::ReadString(ActorMember.Value, "Type", TypeString);
+
+            AActor* NewActor = SpawnSerializedActor(TypeString);
+            if (!NewActor)
+            {
+                return;
+            }
+
+            NewActor->LoadFromNode(ActorMember.Value);
+        }
+    }
+}
+
+void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
+{
+    Super::Serialize(bInIsLoading, InOutHandle);
 
     if (bInIsLoading)
     {
@@ -68,28 +193,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         JSON PerspectiveCameraData;
         if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
         {
-            // 카메라 정보
-            ACameraActor* CamActor = GWorld->GetEditorCameraActor();
-            FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            LoadPerspectiveCamera(PerspectiveCameraData);
         }
 
         // Actors 정보
@@ -106,32 +210,13 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
                 FString TypeString;
                 FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
 
-                //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-                UClass* NewClass = UClass::FindClass(TypeString);
-
-                UWorld* World = GWorld;
-
-                // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
-                if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
-                {
-                    UE_LOG("SpawnActor failed: Invalid class provided.");
-                    return;
-                }
-
-                // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
-                AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+                AActor* NewActor = SpawnSerializedActor(TypeString);
                 if (!NewActor)
                 {
-                    UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
                     return;
                 }
 
-                AddActor(NewActor);
-
-                if (NewActor)
-                {
-                    NewActor->Serialize(bInIsLoading, ActorDataJson);
-                }
+                NewActor->Serialize(bInIsLoading, ActorDataJson);
             }
         }
     }
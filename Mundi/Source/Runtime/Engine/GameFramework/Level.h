@@ -13,6 +13,7 @@ public:
 
     const TArray<AActor*>& GetActors() const { return Actors; }
     void AddActor(AActor* Actor) { if (Actor) Actors.Add(Actor); }
+    void ReserveActors(int32 NumActors) { Actors.Reserve(Actors.Num() + NumActors); }
     void SpawnDefaultActors();
     bool RemoveActor(AActor* Actor)
     {
@@ -21,9 +22,19 @@ public:
         return false;
     }
     void Clear() { Actors.Empty(); }
+    // 로드 실패 정리용: 앞의 NumKeptActors개만 남기고 이후에 추가된 액터는 삭제
+    void DestroyActorsAfter(int32 NumKeptActors);
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+    // FJsonDocument로 파싱한 레벨 로드 (전체 json::JSON 트리를 만들지 않음)
+    // 액터/컴포넌트는 UObject::LoadFromNode로 문서 노드를 바로 읽음
+    void LoadFromDocument(const FJsonValue& InRoot);
 private:
+    template<typename TJsonNode>
+    void LoadPerspectiveCamera(const TJsonNode& InCameraJson);
+    // 저장된 Type 문자열로 액터를 만들어 레벨에 추가 (실패 시 nullptr)
+    AActor* SpawnSerializedActor(const FString& TypeString);
+
     TArray<AActor*> Actors;
 };
 
@@ -33,4 +44,11 @@ public:
     // Create a new empty level
     static std::unique_ptr<ULevel> CreateNewLevel();
     static std::unique_ptr<ULevel> CreateDefaultLevel();
+
+    // .scene 파일 로드/저장. 로드는 파일 앞부분으로 바이너리/JSON을 판별하고, 저장은 바이너리로만 씀
+    // 로드 도중 실패하면 그때까지 레벨에 추가된 액터를 삭제하고 false를 반환
+    static bool LoadLevelFromFile(ULevel* Level, const FWideString& FilePath);
+    static bool SaveLevelToFile(ULevel* Level, const FWideString& FilePath);
+    // 사람이 읽을 수 있는 JSON으로 내보내기 (에디터의 명시적 동작. 이 파일도 LoadLevelFromFile로 로드 가능)
+    static bool ExportLevelToJson(ULevel* Level, const FWideString& FilePath);
 };
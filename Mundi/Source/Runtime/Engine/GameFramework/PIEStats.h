@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// PIE 시작 통계 구조체
+// 마지막으로 PIE에 들어갈 때 월드 복제/등록/BeginPlay에 걸린 시간을 기록
+struct FPIEStats
+{
+	uint32 NumActors = 0;           // 복제한 액터 수
+	uint32 NumObjects = 0;          // 복제 전에 예상한 객체 수 (액터 + 소유 컴포넌트)
+	double DuplicateMs = 0.0;       // 액터 복제 (복사 생성자 + DuplicateSubObjects)
+	double RegisterMs = 0.0;        // 레벨 추가 + 컴포넌트 등록 + 파티션 일괄 등록 (LBVH 1회 빌드)
+	double BeginPlayMs = 0.0;       // 모든 액터의 BeginPlay
+	double TotalMs = 0.0;           // StartPIE 전체
+
+	void Reset()
+	{
+		NumActors = 0;
+		NumObjects = 0;
+		DuplicateMs = 0.0;
+		RegisterMs = 0.0;
+		BeginPlayMs = 0.0;
+		TotalMs = 0.0;
+	}
+};
+
+// PIE 시작 통계 전역 매니저 (싱글톤)
+// UWorld::DuplicateWorldForPIE와 UEditorEngine::StartPIE가 채우고 UStatsOverlayD2D가 표시
+class FPIEStatManager
+{
+public:
+	static FPIEStatManager& GetInstance()
+	{
+		static FPIEStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FPIEStats& InStats)
+	{
+		LastStats = InStats;
+	}
+
+	// 통계 조회
+	const FPIEStats& GetStats() const
+	{
+		return LastStats;
+	}
+
+private:
+	FPIEStatManager() = default;
+	~FPIEStatManager() = default;
+	FPIEStatManager(const FPIEStatManager&) = delete;
+	FPIEStatManager& operator=(const FPIEStatManager&) = delete;
+
+	FPIEStats LastStats;
+};
@@ -43,3 +43,9 @@ void APointLightActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		LightComponent = Cast<UPointLightComponent>(RootComponent);
 	}
 }
+
+void APointLightActor::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	LightComponent = Cast<UPointLightComponent>(RootComponent);
+}
@@ -20,6 +20,7 @@ public:
 	DECLARE_DUPLICATE(APointLightActor)
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 protected:
 	UPointLightComponent* LightComponent;
@@ -0,0 +1,179 @@
+﻿#include "pch.h"
+#include "PrefabCache.h"
+#include "Actor.h"
+#include "ObjectFactory.h"
+#include "BinarySerializer.h"
+
+FPrefabCache& FPrefabCache::GetInstance()
+{
+	static FPrefabCache Instance;
+	return Instance;
+}
+
+AActor* FPrefabCache::LoadPrefabActor(const FWideString& PrefabPath)
+{
+	// 바이너리 프리팹은 레코드 읽기가 활성화된 LoadFromFile 안에서 역직렬화해야 함
+	if (FBinarySerializer::IsBinaryFile(PrefabPath))
+	{
+		AActor* NewActor = nullptr;
+		if (!FBinarySerializer::LoadFromFile(PrefabPath, [&NewActor](const FJsonValue& Root) { NewActor = CreatePrefabActor(Root); }))
+		{
+			UE_LOG("[error] Prefab 로드 실패 - %s", WideToUTF8(PrefabPath).c_str());
+		}
+		return NewActor;
+	}
+
+	FJsonDocument PrefabDocument;
+	if (!FJsonSerializer::LoadJsonDocumentFromFile(PrefabDocument, PrefabPath))
+	{
+		UE_LOG("[error] 존재하지 않는 Prefab 경로입니다. - %s", WideToUTF8(PrefabPath).c_str());
+		return nullptr;
+	}
+	return CreatePrefabActor(PrefabDocument.GetRoot());
+}
+
+AActor* FPrefabCache::CreatePrefabActor(const FJsonValue& Root)
+{
+	FString TypeString;
+	if (!FJsonSerializer::ReadString(Root, "Type", TypeString))
+	{
+		return nullptr;
+	}
+
+	UClass* NewClass = UClass::FindClass(TypeString);
+
+	// 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
+	if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
+	{
+		UE_LOG("[error] SpawnActor failed: Invalid class provided.");
+		return nullptr;
+	}
+
+	// ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+	AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+	if (!NewActor)
+	{
+		UE_LOG("[error] SpawnActor failed: ObjectFactory could not create an instance of");
+		return nullptr;
+	}
+
+	// 데이터 불러오기 (문서 노드를 그대로 읽음)
+	try
+	{
+		NewActor->LoadFromNode(Root);
+	}
+	catch (...)
+	{
+		// 바이너리 레코드가 손상돼 역직렬화 도중 실패하면 반쯤 채워진 액터를 지우고 LoadFromFile로 전달
+		ObjectFactory::DeleteObject(NewActor);
+		throw;
+	}
+	return NewActor;
+}
+
+bool FPrefabCache::SavePrefabActor(AActor* Actor, const FWideString& PrefabPath)
+{
+	auto SerializeActor = [Actor](JSON& Root)
+	{
+		Root["Type"] = Actor->GetClass()->Name;
+		Actor->Serialize(false, Root);
+	};
+
+	if (!FBinarySerializer::SaveToFile(PrefabPath, SerializeActor))
+	{
+		return false;
+	}
+
+	// 덮어쓴 프리팹은 다음 스폰에서 다시 로드 (같은 프레임 안에서도 수정 시각 확인을 기다리지 않음)
+	GetInstance().Invalidate(PrefabPath);
+	return true;
+}
+
+bool FPrefabCache::ExportPrefabActorToJson(AActor* Actor, const FWideString& PrefabPath)
+{
+	JSON ActorJson;
+	ActorJson["Type"] = Actor->GetClass()->Name;
+	Actor->Serialize(false, ActorJson);
+	if (!FJsonSerializer::SaveJsonToFile(ActorJson, PrefabPath))
+	{
+		return false;
+	}
+
+	GetInstance().Invalidate(PrefabPath);
+	return true;
+}
+
+AActor* FPrefabCache::FindOrLoadArchetype(const FWideString& PrefabPath)
+{
+	// 이번 프레임에 이미 확인한 경로는 파일 시스템을 다시 조회하지 않음
+	if (FPrefabEntry* Entry = Entries.Find(PrefabPath))
+	{
+		if (Entry->CheckedFrame == FrameIndex)
+		{
+			if (AActor* Archetype = Entry->Archetype.Get())
+			{
+				return Archetype;
+			}
+		}
+	}
+
+	std::error_code ErrorCode;
+	const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(PrefabPath, ErrorCode);
+	if (ErrorCode)
+	{
+		Invalidate(PrefabPath);
+		UE_LOG("[error] 존재하지 않는 Prefab 경로입니다. - %s", WideToUTF8(PrefabPath).c_str());
+		return nullptr;
+	}
+
+	if (FPrefabEntry* Entry = Entries.Find(PrefabPath))
+	{
+		// DeleteAll 등으로 아키타입이 지워졌으면 약한 포인터가 무효가 되어 다시 로드
+		AActor* Archetype = Entry->Archetype.Get();
+		if (Archetype && Entry->WriteTime == WriteTime)
+		{
+			Entry->CheckedFrame = FrameIndex;
+			return Archetype;
+		}
+		Invalidate(PrefabPath);
+	}
+
+	AActor* Archetype = LoadPrefabActor(PrefabPath);
+	if (!Archetype)
+	{
+		return nullptr;
+	}
+	Archetype->MarkAsArchetype();
+
+	FPrefabEntry NewEntry;
+	NewEntry.Archetype = TWeakObjectPtr<AActor>(Archetype);
+	NewEntry.WriteTime = WriteTime;
+	NewEntry.CheckedFrame = FrameIndex;
+	Entries.Add(PrefabPath, NewEntry);
+	return Archetype;
+}
+
+void FPrefabCache::Invalidate(const FWideString& PrefabPath)
+{
+	if (FPrefabEntry* Entry = Entries.Find(PrefabPath))
+	{
+		// 아키타입은 레벨에 없으므로 바로 삭제 (소멸자에서 컴포넌트 정리)
+		if (AActor* Archetype = Entry->Archetype.Get())
+		{
+			ObjectFactory::DeleteObject(Archetype);
+		}
+		Entries.Remove(PrefabPath);
+	}
+}
+
+void FPrefabCache::Clear()
+{
+	for (auto& Pair : Entries)
+	{
+		if (AActor* Archetype = Pair.second.Archetype.Get())
+		{
+			ObjectFactory::DeleteObject(Archetype);
+		}
+	}
+	Entries.Empty();
+}
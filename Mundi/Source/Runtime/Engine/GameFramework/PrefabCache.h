@@ -0,0 +1,60 @@
+﻿#pragma once
+#include <filesystem>
+
+class AActor;
+class FJsonValue;
+
+/**
+ * @class FPrefabCache
+ * @brief .prefab 파일마다 한 번만 로드한 아키타입 액터를 보관하고, 스폰은 아키타입을 Duplicate()해서 만듭니다.
+ *
+ * 아키타입은 레벨에 속하지 않은(World == nullptr) 액터로, 기존 스폰 경로와 같이 NewObject + Serialize로 만들어집니다.
+ * 복제는 PIE 월드 복제와 같은 Duplicate 경로를 사용하므로 JSON 파싱/클래스 조회/컴포넌트 역직렬화가 반복되지 않습니다.
+ * 파일 수정 시각은 프레임(BeginFrame)마다 경로당 한 번만 확인하고, 바뀌었으면 아키타입을 다시 로드합니다.
+ * SavePrefabActor로 덮어쓴 경로는 그 자리에서 무효화됩니다.
+ * 아키타입은 AActor::IsArchetype()으로 표시되므로 전역 액터 순회는 이를 건너뛰어야 합니다.
+ * 캐시는 월드가 레벨을 교체할 때(UWorld::SetLevel)와 엔진 종료 시 Clear()로 비워집니다.
+ *
+ * 아키타입은 월드에 등록되지 않으므로 에디터 전용 컴포넌트(빌보드, 방향/카메라 기즈모)를 갖지 않고,
+ * Duplicate()도 에디터 전용 컴포넌트를 복사하지 않습니다. 대신 복제본이 에디터(비 PIE) 월드에 등록될 때
+ * 각 컴포넌트의 OnRegister가 이를 새로 만들므로, 에디터 월드에 스폰한 프리팹도 기존 경로와 같은 모습이 됩니다.
+ */
+class FPrefabCache
+{
+public:
+	static FPrefabCache& GetInstance();
+
+	// 엔진 틱 시작 시 호출: 다음 스폰부터 경로별로 파일 수정 시각을 다시 확인
+	void BeginFrame() { ++FrameIndex; }
+
+	// 캐시된 아키타입 반환 (없거나 파일이 바뀌었으면 다시 로드). 실패 시 nullptr
+	AActor* FindOrLoadArchetype(const FWideString& PrefabPath);
+
+	void Invalidate(const FWideString& PrefabPath);
+	void Clear();
+
+	int32 Num() const { return static_cast<int32>(Entries.size()); }
+
+	// 액터를 .prefab(바이너리)으로 저장
+	static bool SavePrefabActor(AActor* Actor, const FWideString& PrefabPath);
+	// 사람이 읽을 수 있는 JSON 프리팹으로 내보내기 (에디터의 명시적 동작. 이 파일도 로드 가능)
+	static bool ExportPrefabActorToJson(AActor* Actor, const FWideString& PrefabPath);
+
+	// 캐시를 거치지 않고 파일을 읽어 레벨에 등록하지 않은 액터를 만듦 (기존 SpawnPrefabActor 로드 경로)
+	static AActor* LoadPrefabActor(const FWideString& PrefabPath);
+
+private:
+	FPrefabCache() = default;
+
+	static AActor* CreatePrefabActor(const FJsonValue& Root);
+
+	struct FPrefabEntry
+	{
+		TWeakObjectPtr<AActor> Archetype;
+		std::filesystem::file_time_type WriteTime;
+		uint64 CheckedFrame = 0;	// WriteTime을 마지막으로 확인한 프레임
+	};
+
+	TMap<FWideString, FPrefabEntry> Entries;
+	uint64 FrameIndex = 1;
+};
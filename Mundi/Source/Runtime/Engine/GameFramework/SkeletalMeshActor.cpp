@@ -83,6 +83,12 @@ void ASkeletalMeshActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void ASkeletalMeshActor::LoadFromNode(const FJsonValue& InNode)
+{
+    Super::LoadFromNode(InNode);
+    SkeletalMeshComponent = Cast<USkeletalMeshComponent>(RootComponent);
+}
+
 ULineComponent* ASkeletalMeshActor::EnsureSkeletonOverlay(UWorld* World)
 {
     if (SkeletonOverlay)
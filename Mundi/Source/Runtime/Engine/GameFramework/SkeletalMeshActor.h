@@ -39,6 +39,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void LoadFromNode(const FJsonValue& InNode) override;
 
     // Editor Debug Skeleton Overlay (owned by actor)
     ULineComponent* GetSkeletonOverlay() const { return SkeletonOverlay; }
@@ -43,3 +43,9 @@ void ASpotLightActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		LightComponent = Cast<USpotLightComponent>(RootComponent);
 	}
 }
+
+void ASpotLightActor::LoadFromNode(const FJsonValue& InNode)
+{
+	Super::LoadFromNode(InNode);
+	LightComponent = Cast<USpotLightComponent>(RootComponent);
+}
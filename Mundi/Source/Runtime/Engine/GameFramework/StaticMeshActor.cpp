@@ -74,3 +74,9 @@ void AStaticMeshActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         StaticMeshComponent = Cast<UStaticMeshComponent>(RootComponent);
     }
 }
+
+void AStaticMeshActor::LoadFromNode(const FJsonValue& InNode)
+{
+    Super::LoadFromNode(InNode);
+    StaticMeshComponent = Cast<UStaticMeshComponent>(RootComponent);
+}
@@ -24,6 +24,7 @@ public:
 
 	// Serialize
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 protected:
 	UStaticMeshComponent* StaticMeshComponent;
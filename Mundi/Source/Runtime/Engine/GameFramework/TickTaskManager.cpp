@@ -0,0 +1,126 @@
+﻿#include "pch.h"
+#include "TickTaskManager.h"
+#include "Actor.h"
+#include "SceneComponent.h"
+#include "ParallelFor.h"
+#include <mutex>
+
+bool FTickTaskManager::bParallelTickEnabled = true;
+
+namespace
+{
+	// 청크 하나에 들어갈 최소 액터 수 (컴포넌트 틱 하나가 매우 가벼우므로 넉넉하게)
+	constexpr int32 ParallelTickBatchSize = 64;
+
+	// Group에 병렬 틱할 컴포넌트가 있는지
+	bool HasParallelComponents(const AActor* Actor, ETickGroup Group)
+	{
+		for (UActorComponent* Comp : Actor->GetOwnedComponents())
+		{
+			if (Comp && Comp->GetTickGroup() == Group && Comp->CanTickInParallel() && Comp->IsComponentTickEnabled())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// 다른 액터에 붙어 있으면 부모 체인의 캐시/트랜스폼을 다른 스레드와 공유하므로 병렬 불가
+	bool IsActorIsolated(const AActor* Actor)
+	{
+		const USceneComponent* Root = Actor->GetRootComponent();
+		return !Root || !Root->GetAttachParent();
+	}
+}
+
+void FTickTaskManager::TickActors(const TArray<AActor*>& Actors, float DeltaSeconds)
+{
+	NumParallelActors = 0;
+	for (int32 Group = 0; Group < static_cast<int32>(ETickGroup::Max); ++Group)
+	{
+		TickGroup(Actors, static_cast<ETickGroup>(Group), DeltaSeconds);
+	}
+}
+
+void FTickTaskManager::TickGroup(const TArray<AActor*>& Actors, ETickGroup Group, float DeltaSeconds)
+{
+	// 1. 직렬 구간 (Lua, 스폰/파괴, 월드 질의 등은 모두 여기서)
+	for (AActor* Actor : Actors)
+	{
+		const float ActorDelta = DeltaSeconds * Actor->GetCustomTimeDillation();
+		if (Group == ETickGroup::PrePhysics)
+		{
+			Actor->Tick(ActorDelta);
+		}
+		else
+		{
+			Actor->TickComponentsInGroup(Group, ActorDelta);
+		}
+	}
+
+	// 2. 병렬 구간 - 직렬 틱에서 컴포넌트가 추가/삭제됐을 수 있으므로 직렬 구간 뒤에 수집
+	ParallelActors.clear();
+	for (AActor* Actor : Actors)
+	{
+		if (!HasParallelComponents(Actor, Group))
+		{
+			continue;
+		}
+
+		if (IsActorIsolated(Actor))
+		{
+			ParallelActors.Add(Actor);
+		}
+		else
+		{
+			Actor->TickParallelComponentsInGroup(Group, DeltaSeconds * Actor->GetCustomTimeDillation());
+		}
+	}
+
+	if (ParallelActors.IsEmpty())
+	{
+		return;
+	}
+
+	if (!bParallelTickEnabled)
+	{
+		for (AActor* Actor : ParallelActors)
+		{
+			Actor->TickParallelComponentsInGroup(Group, DeltaSeconds * Actor->GetCustomTimeDillation());
+		}
+		return;
+	}
+
+	NumParallelActors += ParallelActors.Num();
+
+	std::mutex DeferredMutex;
+	ParallelFor::Run(ParallelActors.Num(), ParallelTickBatchSize, [&](int32 Begin, int32 End)
+	{
+		// 청크마다 스레드 로컬 목록에 모았다가 끝에 한 번만 잠그고 합침
+		TArray<USceneComponent*> LocalDeferred;
+		{
+			// 틱이 예외를 던져도(JobSystem이 Wait 쪽으로 넘김) 스레드 로컬 포인터가 사라진 LocalDeferred를 가리키지 않도록 복원
+			struct FDeferredScope
+			{
+				TArray<USceneComponent*>* Prev;
+				~FDeferredScope() { USceneComponent::SetDeferredTransformUpdates(Prev); }
+			} DeferredScope{ nullptr };
+			DeferredScope.Prev = USceneComponent::SetDeferredTransformUpdates(&LocalDeferred);
+
+			for (int32 i = Begin; i < End; ++i)
+			{
+				AActor* Actor = ParallelActors[i];
+				Actor->TickParallelComponentsInGroup(Group, DeltaSeconds * Actor->GetCustomTimeDillation());
+			}
+		}
+
+		if (!LocalDeferred.IsEmpty())
+		{
+			std::lock_guard<std::mutex> Lock(DeferredMutex);
+			DeferredTransformUpdates.insert(DeferredTransformUpdates.end(), LocalDeferred.begin(), LocalDeferred.end());
+		}
+	});
+
+	// 3. 지연된 트랜스폼 알림을 메인 스레드에서 처리
+	USceneComponent::FlushDeferredTransformUpdates(DeferredTransformUpdates);
+}
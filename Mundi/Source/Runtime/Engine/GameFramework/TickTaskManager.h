@@ -0,0 +1,42 @@
+﻿#pragma once
+
+class AActor;
+class USceneComponent;
+
+/**
+ * @class FTickTaskManager
+ * @brief 월드의 액터/컴포넌트 틱을 ETickGroup 순서대로 실행합니다.
+ *
+ * 그룹마다 먼저 메인 스레드에서 직렬 틱(PrePhysics는 AActor::Tick, 나머지는 AActor::TickComponentsInGroup)을 돌리고,
+ * 이어서 CanTickInParallel()인 컴포넌트를 가진 액터들을 ParallelFor로 나눠 워커 스레드에서 틱합니다.
+ * 병렬 단위는 액터이므로 같은 액터의 병렬 컴포넌트끼리는 항상 한 스레드에서 원래 순서대로 실행됩니다.
+ *
+ * 틱 순서 주의: 병렬 틱이 도입되면서 같은 그룹 안에서 CanTickInParallel() 컴포넌트는 직렬 컴포넌트보다 항상 뒤에 틱합니다.
+ * (이전에는 액터별로 OwnedComponents 순서대로 섞여서 틱) 병렬 토글을 꺼도 이 순서는 같으므로,
+ * 같은 그룹의 직렬 컴포넌트 결과를 병렬 컴포넌트가 읽는 것은 안전하지만 그 반대(직렬이 같은 프레임의 병렬 결과를 읽음)는 다음 그룹으로 옮겨야 합니다.
+ * 병렬 구간의 OnTransformUpdated(파티션/라이트 갱신)는 지연됐다가 그룹이 끝날 때 메인 스레드에서 UUID 순으로 처리됩니다.
+ */
+class FTickTaskManager
+{
+public:
+	// TickActors는 활성/틱 가능 여부를 이미 거른 액터 목록을 받음. DeltaSeconds에 액터별 CustomTimeDilation을 곱해서 사용
+	void TickActors(const TArray<AActor*>& Actors, float DeltaSeconds);
+
+	// 병렬 틱 전역 토글 (끄면 같은 순서로 메인 스레드에서만 실행)
+	static void SetParallelTickEnabled(bool bEnabled) { bParallelTickEnabled = bEnabled; }
+	static bool IsParallelTickEnabled() { return bParallelTickEnabled; }
+
+	// 마지막 프레임 통계
+	int32 GetNumParallelActors() const { return NumParallelActors; }
+
+private:
+	void TickGroup(const TArray<AActor*>& Actors, ETickGroup Group, float DeltaSeconds);
+
+	// 프레임 간 재사용하는 작업 버퍼
+	TArray<AActor*> ParallelActors;
+	TArray<USceneComponent*> DeferredTransformUpdates;
+
+	int32 NumParallelActors = 0;
+
+	static bool bParallelTickEnabled;
+};
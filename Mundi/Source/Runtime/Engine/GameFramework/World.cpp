@@ -27,8 +27,14 @@
 #include "LightManager.h"
 #include "LuaManager.h"
 #include "ShapeComponent.h"
+#include "CollisionBroadphase.h"
+#include "TickTaskManager.h"
+#include "PrefabCache.h"
+#include "ActorPool.h"
 #include "PlayerCameraManager.h"
 #include "Hash.h"
+#include "PlatformTime.h"
+#include "PIEStats.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -39,6 +45,9 @@ UWorld::UWorld() : Partition(new UWorldPartitionManager())
 	Level = std::make_unique<ULevel>();
 	LightManager = std::make_unique<FLightManager>();
 	LuaManager = std::make_unique<FLuaManager>();
+	CollisionBroadphase = std::make_unique<FCollisionBroadphase>(this);
+	TickTaskManager = std::make_unique<FTickTaskManager>();
+	ActorPool = std::make_unique<FActorPool>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -66,10 +75,13 @@ UWorld::~UWorld()
 			}
 		}
 
+		// 마지막에 Level->Clear()로 한 번에 비우므로 DestroyActor의 RemoveActor(선형 탐색 + erase)는 생략
 		TArray<AActor*> TempActors =  Level->GetActors();
 		for (AActor* Actor : TempActors)
 		{
-			DestroyActor(Actor);
+			if (SelectionMgr) SelectionMgr->DeselectActor(Actor);
+			Actor->DestroyAllComponents();
+			ObjectFactory::DeleteObject(Actor);
 		}
 		Level->Clear();
 	}
@@ -132,12 +144,7 @@ bool UWorld::TryLoadLastUsedLevel()
 	GWorld->GetSelectionManager()->ClearSelection();
 
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, LastUsedLevelPath))
-	{
-		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
+	if (!ULevelService::LoadLevelFromFile(NewLevel.get(), LastUsedLevelPath))
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", LastUsedLevelPath.c_str());
 		return false;
@@ -152,13 +159,7 @@ bool UWorld::TryLoadLastUsedLevel()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
-
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
-	{
-		NewLevel->Serialize(true, LevelJsonData);
-	}
-	else
+	if (!ULevelService::LoadLevelFromFile(NewLevel.get(), Path))
 	{
 		UE_LOG("[error] MainToolbar: Failed To Load Level From: %s", Path.c_str());
 		return false;
@@ -237,8 +238,9 @@ void UWorld::Tick(float DeltaSeconds)
 	if (Level)
 	{
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
-		TArray<AActor*> LevelActors = Level->GetActors();
-		for (AActor* Actor : LevelActors)
+		TArray<AActor*> TickingActors;
+		TickingActors.reserve(Level->GetActors().size());
+		for (AActor* Actor : Level->GetActors())
 		{
 			if (Actor && Actor->IsActorActive())
 			{
@@ -246,11 +248,14 @@ void UWorld::Tick(float DeltaSeconds)
 				{
 					if (Actor->CanTickInEditor() || bPie)
 					{
-						Actor->Tick(GetDeltaTime(EDeltaTime::Game) * Actor->GetCustomTimeDillation());
+						TickingActors.Add(Actor);
 					}
 				}
 			}
 		}
+
+		// 틱 그룹 순서대로 직렬 틱 → 병렬 컴포넌트 틱 (액터별 CustomTimeDilation은 내부에서 곱함)
+		TickTaskManager->TickActors(TickingActors, GetDeltaTime(EDeltaTime::Game));
     }
 
     for (AActor* EditorActor : EditorActors)
@@ -267,6 +272,9 @@ void UWorld::Tick(float DeltaSeconds)
 		LuaManager->Tick(GetDeltaTime(EDeltaTime::Game));
 	}
 
+	// 오버랩 단계: 이동이 모두 끝난 위치로 겹침을 한 번 계산하고 Begin/End 이벤트를 한꺼번에 전달
+	CollisionBroadphase->UpdateOverlaps();
+
 	// 지연 삭제 처리
 	ProcessPendingKillActors();
 }
@@ -287,6 +295,25 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	GEngine.AddWorldContext(PIEWorldContext);
 	
 	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
+	FPIEStats Stats;
+
+	// 1. 액터 + 소유 컴포넌트 수만큼 GUObjectArray와 레벨 액터 배열을 미리 확보 (복제 도중 재할당 방지)
+	for (AActor* SourceActor : SourceActors)
+	{
+		if (SourceActor)
+		{
+			Stats.NumObjects += 1 + static_cast<uint32>(SourceActor->GetOwnedComponents().Num());
+		}
+	}
+	ObjectFactory::ReserveObjects(static_cast<int32>(Stats.NumObjects));
+	PIEWorld->GetLevel()->ReserveActors(SourceActors.Num());
+
+	// 2. 복제
+	// NOTE: 객체 생성은 GUObjectArray 슬롯/UUID/클래스별 인스턴스 목록 같은 전역 상태를 갱신하므로 메인 스레드에서 순서대로 수행
+	//       액터별로 독립적인 월드 바운드 계산은 4단계의 BulkRegister가 병렬로 처리
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	TArray<AActor*> NewActors;
+	NewActors.Reserve(SourceActors.Num());
 	for (AActor* SourceActor : SourceActors)
 	{
 		if (!SourceActor)
@@ -312,12 +339,43 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 			}
 		}
 
+		NewActors.Add(NewActor);
+	}
+	Stats.DuplicateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	// 3. 레벨 추가 + 컴포넌트 등록 (파티션은 개별 더티 큐 대신 4단계에서 한 번에 반영)
+	// 4. 파티션 일괄 등록: 바운드 병렬 계산 후 LBVH 한 번 빌드
+	StartCycles = FPlatformTime::Cycles64();
+	PIEWorld->GetPartitionManager()->BeginBulkRegister();
+	for (AActor* NewActor : NewActors)
+	{
 		PIEWorld->AddActorToLevel(NewActor);
 	}
+	PIEWorld->GetPartitionManager()->BulkRegister(NewActors);
+	Stats.RegisterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	Stats.NumActors = static_cast<uint32>(NewActors.Num());
+	FPIEStatManager::GetInstance().UpdateStats(Stats);
 
 	return PIEWorld;
 }
 
+FOcclusionCullingManagerCPU* UWorld::GetOcclusionCuller(uint64 ViewKey)
+{
+	std::unique_ptr<FOcclusionCullingManagerCPU>& Culler = OcclusionCullers[ViewKey];
+	if (!Culler)
+	{
+		Culler = std::make_unique<FOcclusionCullingManagerCPU>();
+		Culler->Initialize(FOcclusionCullingManagerCPU::DefaultGridWidth, FOcclusionCullingManagerCPU::DefaultGridHeight);
+	}
+	return Culler.get();
+}
+
+void UWorld::ReleaseOcclusionCuller(uint64 ViewKey)
+{
+	OcclusionCullers.Remove(ViewKey);
+}
+
 float UWorld::GetDeltaTime(EDeltaTime type)
 {
 	switch (type)
@@ -471,6 +529,9 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
             ObjectFactory::DeleteObject(Actor);
         }
         Level->Clear();
+
+        // 이전 레벨에서 쓰던 프리팹 아키타입도 해제 (새 레벨에서 스폰할 때 필요한 것만 다시 로드)
+        FPrefabCache::GetInstance().Clear();
     }
     // Clear spatial indices
     Partition->Clear();
@@ -480,7 +541,8 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     // Adopt actors: set world and register
     if (Level)
     {
-		Partition->BulkRegister(Level->GetActors());
+		// 컴포넌트 등록 중 파티션 더티 큐를 쌓지 않고 마지막에 LBVH 한 번으로 반영
+		Partition->BeginBulkRegister();
         for (AActor* Actor : Level->GetActors())
         {
 			if (Actor)
@@ -489,6 +551,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 				Actor->RegisterAllComponents(this);
 }
         }
+		Partition->BulkRegister(Level->GetActors());
     }
 
 	// 씬에서 PCM 검색
@@ -644,55 +707,29 @@ AActor* UWorld::SpawnPrefabActor(const FWideString& PrefabPath)
 		return nullptr;
 	}
 
-	JSON ActorDataJson;
-
-	if (FJsonSerializer::LoadJsonFromFile(ActorDataJson, PrefabPath))
+	// 파일은 처음(또는 수정된 뒤) 한 번만 읽고, 이후에는 캐시된 아키타입을 복제
+	AActor* Archetype = FPrefabCache::GetInstance().FindOrLoadArchetype(PrefabPath);
+	if (!Archetype)
 	{
-		// Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
-
-		FString TypeString;
-		if (FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString))
-		{
-			//UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-			UClass* NewClass = UClass::FindClass(TypeString);
-
-			UWorld* World = GWorld;
-
-			// 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
-			if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
-			{
-				UE_LOG("[error] SpawnActor failed: Invalid class provided.");
-				return nullptr;
-			}
-
-			// ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
-			AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
-			if (!NewActor)
-			{
-				UE_LOG("[error] SpawnActor failed: ObjectFactory could not create an instance of");
-				return nullptr;
-			}
-			
-			// 데이터 불러오기
-			NewActor->Serialize(true, ActorDataJson);
+		return nullptr;
+	}
 
-			// 현재 레벨에 액터 등록
-			AddActorToLevel(NewActor);
+	AActor* NewActor = Archetype->Duplicate();
+	if (!NewActor)
+	{
+		UE_LOG("[error] SpawnActor failed: Duplicate failed");
+		return nullptr;
+	}
 
-			if (this->bPie)
-			{
-				NewActor->BeginPlay();
-			}
+	// 현재 레벨에 액터 등록
+	AddActorToLevel(NewActor);
 
-			return NewActor;
-		}
-	}
-	else
+	if (this->bPie)
 	{
-		UE_LOG("[error] 존재하지 않는 Prefab 경로입니다. - %s", WideToUTF8(PrefabPath).c_str());
+		NewActor->BeginPlay();
 	}
 
-	return nullptr;
+	return NewActor;
 }
 
 bool UWorld::TryMarkOverlapPair(const AActor* Actor, const AActor* B)
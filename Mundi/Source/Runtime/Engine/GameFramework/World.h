@@ -27,6 +27,9 @@ class BVHierachy;
 class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
+class FCollisionBroadphase;
+class FTickTaskManager;
+class FActorPool;
 
 struct FTransform;
 struct FSceneCompData;
@@ -113,6 +116,12 @@ public:
     virtual void Tick(float DeltaSeconds);
     // Overlap pair de-duplication (per-frame)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
+    // Shape 오버랩 브로드페이즈 (프레임당 한 번 계산)
+    FCollisionBroadphase* GetCollisionBroadphase() const { return CollisionBroadphase.get(); }
+    // 틱 그룹 순서 + 병렬 컴포넌트 틱
+    FTickTaskManager* GetTickTaskManager() const { return TickTaskManager.get(); }
+    // 클래스/프리팹별 액터 풀 (Acquire/Release)
+    FActorPool* GetActorPool() const { return ActorPool.get(); }
 
     TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
 
@@ -123,6 +132,11 @@ public:
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
 
+    // 뷰별 CPU 오클루전 컬러 (FSceneRenderer는 프레임마다 생성되므로 가림 히스테리시스 상태는 월드가 보관)
+    FOcclusionCullingManagerCPU* GetOcclusionCuller(uint64 ViewKey);
+    // 뷰포트가 파괴될 때 해당 뷰의 HZB/그리드를 해제
+    void ReleaseOcclusionCuller(uint64 ViewKey);
+
     // PIE용 World 생성
     static UWorld* DuplicateWorldForPIE(UWorld* InEditorWorld);
 
@@ -164,12 +178,24 @@ private:
     //partition
     std::unique_ptr<UWorldPartitionManager> Partition = nullptr;
 
+    // 뷰 키(FViewport 주소) -> 오클루전 컬러
+    TMap<uint64, std::unique_ptr<FOcclusionCullingManagerCPU>> OcclusionCullers;
+
     // Per-world selection manager
     std::unique_ptr<USelectionManager> SelectionMgr;
 
     // Per-frame processed overlap pairs (A,B) keyed canonically
     TSet<uint64> FrameOverlapPairs;
 
+    /** === 충돌 브로드페이즈 ===*/
+    std::unique_ptr<FCollisionBroadphase> CollisionBroadphase;
+
+    /** === 틱 === */
+    std::unique_ptr<FTickTaskManager> TickTaskManager;
+
+    /** === 액터 풀 === */
+    std::unique_ptr<FActorPool> ActorPool;
+
     //Timinig
     float UnscaledDelta;
     float SlomoOnlyDelta;
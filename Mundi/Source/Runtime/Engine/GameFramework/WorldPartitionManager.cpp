@@ -9,6 +9,7 @@
 #include "StaticMeshComponent.h"
 #include "Frustum.h"
 #include "Gizmo/GizmoActor.h"
+#include "ParallelFor.h"
 
 IMPLEMENT_CLASS(UWorldPartitionManager)
 
@@ -53,31 +54,69 @@ void UWorldPartitionManager::Register(UPrimitiveComponent* Smc)
 }
 
 // BulkRegister를 사용하면 틱 budget에 걸리지 않고 1틱 안에 전부 추가됩니다.
+// 월드 바운드는 액터 단위로 병렬 계산하고 LBVH는 한 번만 빌드합니다.
 void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 {
+	bBulkRegistering = false;
 	if (Actors.empty()) return;
+
+	const TArray<AActor*>& EditorActors = GWorld->GetEditorActors();
+
+	// 1. 액터별 프리미티브 컴포넌트 수집 (ActorFirstComponent[i]부터 다음 액터 시작 전까지가 i번째 액터 몫)
 	TArray<UPrimitiveComponent*> StaticMeshComponents;
+	TArray<int32> ActorFirstComponent;
 	StaticMeshComponents.Reserve(Actors.size());
+	ActorFirstComponent.Reserve(Actors.size() + 1);
 
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
+		if (!Actor)
+			continue;
+
 		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
 		if (it != EditorActors.end())
 			continue; // 에디터 액터는 포함하지 않는다.
 
-		const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
-		for (USceneComponent* Component : Components)
+		// 다른 액터에 붙은 루트는 부모 쪽 월드 트랜스폼 캐시를 여기서 먼저 갱신
+		// (병렬 구간에서는 각 작업이 자기 액터의 캐시만 쓰도록)
+		if (USceneComponent* Root = Actor->GetRootComponent())
+		{
+			if (Root->GetAttachParent())
+			{
+				Root->GetWorldTransform();
+			}
+		}
+
+		ActorFirstComponent.Add(StaticMeshComponents.Num());
+		for (USceneComponent* Component : Actor->GetSceneComponents())
 		{
-			if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
+			// MarkDirty와 같이 에디터 전용 컴포넌트(빌보드, 기즈모 화살표/메시 등)는 LBVH에 넣지 않음
+			UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component);
+			if (Smc && Smc->IsEditable())
 			{
 				StaticMeshComponents.push_back(Smc);
 				ComponentDirtySet.erase(Smc);
 			}
 		}
 	}
+	const int32 NumActors = ActorFirstComponent.Num();
+	ActorFirstComponent.Add(StaticMeshComponents.Num());
+
+	// 2. 월드 AABB 계산 (지연 갱신되는 트랜스폼 캐시는 같은 액터 안에서만 공유되므로 액터 단위로 나눔)
+	TArray<FAABB> ComponentBounds;
+	ComponentBounds.resize(StaticMeshComponents.size());
+	ParallelFor::Run(NumActors, 64, [&](int32 Begin, int32 End)
+	{
+		for (int32 ActorIndex = Begin; ActorIndex < End; ++ActorIndex)
+		{
+			for (int32 i = ActorFirstComponent[ActorIndex]; i < ActorFirstComponent[ActorIndex + 1]; ++i)
+			{
+				ComponentBounds[i] = StaticMeshComponents[i]->GetWorldAABB();
+			}
+		}
+	});
 
-	if (BVH) BVH->BulkUpdate(StaticMeshComponents);
+	if (BVH) BVH->BulkUpdate(StaticMeshComponents, ComponentBounds);
 }
 
 void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
@@ -87,9 +126,21 @@ void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
 		if (BVH) BVH->Remove(Smc);
 
 		ComponentDirtySet.erase(Smc);
+		// 파티션에서 빠진 컴포넌트는 더 이상 컬링 판정을 받지 않으므로 플래그 초기화
+		Smc->SetCulled(false);
 	}
 }
 
+void UWorldPartitionManager::Park(UPrimitiveComponent* Component)
+{
+	if (!Component) return;
+
+	if (BVH) BVH->Park(Component);
+
+	ComponentDirtySet.erase(Component);
+	Component->SetCulled(false);
+}
+
 // World Partition에서의 액터 상태를 갱신 예약
 // (신규 등록에도 사용할 수 있지만 코드 가독성을 위해 Register API 사용 권장)
 void UWorldPartitionManager::MarkDirty(AActor* Actor)
@@ -114,7 +165,7 @@ void UWorldPartitionManager::MarkDirty(AActor* Actor)
 // (신규 등록에도 사용할 수 있지만 코드 가독성을 위해 Register API 사용 권장)
 void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 {
-	if (!Smc) return;
+	if (!Smc || bBulkRegistering) return;
 	AActor* Owner = Smc->GetOwner();
 	if (!Owner) return;
 
@@ -182,11 +233,11 @@ void UWorldPartitionManager::RayQueryClosest(FRay InRay, OUT AActor*& OutActor,
 	}
 }
 
-void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
+void UWorldPartitionManager::FrustumQuery(const FFrustum& InFrustum, OUT TArray<UPrimitiveComponent*>& OutVisibleComponents) const
 {
 	if (BVH)
 	{
-		BVH->QueryFrustum(InFrustum);
+		BVH->QueryFrustum(InFrustum, OutVisibleComponents);
 	}
 }
 
@@ -6,6 +6,7 @@
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
+#include "ActorPool.h"
 #include <tuple>
 
 sol::object MakeCompProxy(sol::state_view SolState, void* Instance, UClass* Class) {
@@ -187,6 +188,26 @@ FLuaManager::FLuaManager()
             return NewObject;
         }
     ));
+    // 월드 액터 풀: 반납한 액터는 비활성화된 채 메모리/컴포넌트를 유지하고 AcquirePrefab에서 재사용
+    SharedLib.set_function("AcquirePrefab",
+        [](const FString& PrefabPath) -> FGameObject*
+        {
+            AActor* Actor = GWorld->GetActorPool()->AcquirePrefab(UTF8ToWide(PrefabPath));
+            return Actor ? Actor->GetGameObject() : nullptr;
+        }
+    );
+    SharedLib.set_function("ReleaseObject",
+        [](FGameObject& GameObject) -> bool
+        {
+            return GWorld->GetActorPool()->Release(GameObject.GetOwner());
+        }
+    );
+    SharedLib.set_function("PrewarmPrefab",
+        [](const FString& PrefabPath, int32 Count)
+        {
+            GWorld->GetActorPool()->PrewarmPrefab(UTF8ToWide(PrefabPath), Count);
+        }
+    );
     SharedLib.set_function("DeleteObject", sol::overload(
         [](const FGameObject& GameObject)
         {
@@ -194,7 +215,8 @@ FLuaManager::FLuaManager()
             {
                 AActor* Actor = *It;
 
-                if (Actor->UUID == GameObject.UUID)
+                // 프리팹 아키타입은 월드가 없는 캐시 원본이므로 Destroy 대상이 아님
+                if (!Actor->IsArchetype() && Actor->UUID == GameObject.UUID)
                 {
                     Actor->Destroy();   // 지연 삭제 요청 (즉시 삭제하면 터짐)
                     break;
@@ -45,6 +45,18 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    inline double SurfaceArea(const FAABB& Box)
+    {
+        const FVector D = Box.Max - Box.Min;
+        return 2.0 * ((double)D.X * D.Y + (double)D.Y * D.Z + (double)D.Z * D.X);
+    }
+
+    inline bool IsSameBounds(const FAABB& A, const FAABB& B)
+    {
+        return A.Min.X == B.Min.X && A.Min.Y == B.Min.Y && A.Min.Z == B.Min.Z
+            && A.Max.X == B.Max.X && A.Max.Y == B.Max.Y && A.Max.Z == B.Max.Z;
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -66,6 +78,14 @@ void FBVHierarchy::Clear()
     StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
+    ComponentSlots = TMap<UPrimitiveComponent*, int32>();
+    ParkedSlots = TMap<UPrimitiveComponent*, int32>();
+    SlotToLeaf = TArray<int32>();
+    DirtyLeaves = TArray<int32>();
+    LeafDirtyFlags = TArray<uint8>();
+    NodeAreaSum = 0.0;
+    BuildAreaCost = 0.0f;
+    TombstoneCount = 0;
     Bounds = FAABB();
     bPendingRebuild = false;
 }
@@ -86,6 +106,21 @@ void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
     bPendingRebuild = false;
 }
 
+void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components, const TArray<FAABB>& ComponentBounds)
+{
+    StaticMeshComponentBounds.reserve(StaticMeshComponentBounds.size() + Components.size());
+    for (int32 i = 0; i < Components.Num(); ++i)
+    {
+        if (Components[i])
+        {
+            StaticMeshComponentBounds.Add(Components[i], ComponentBounds[i]);
+        }
+    }
+
+    BuildLBVH();
+    bPendingRebuild = false;
+}
+
 void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
 {
     if (!InComponent)
@@ -99,10 +134,35 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
         return;
     }
 
-    const FAABB WorldBounds = InComponent->GetWorldAABB();
+    UpdateComponentBounds(InComponent, InComponent->GetWorldAABB());
+}
 
+void FBVHierarchy::UpdateComponentBounds(UPrimitiveComponent* InComponent, const FAABB& WorldBounds)
+{
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
-    bPendingRebuild = true;
+
+    // 이미 트리에 있는 컴포넌트는 리핏 대상, 새 컴포넌트는 트리 구조가 바뀌므로 리빌드
+    if (bPendingRebuild)
+    {
+        return;
+    }
+    if (const int32* Slot = ComponentSlots.Find(InComponent))
+    {
+        MarkSlotDirty(*Slot);
+    }
+    else if (const int32* ParkedSlot = ParkedSlots.Find(InComponent))
+    {
+        // Park했던 슬롯으로 복귀: 트리 구조는 그대로이므로 리핏만
+        const int32 SlotIndex = *ParkedSlot;
+        ParkedSlots.Remove(InComponent);
+        StaticMeshComponentArray[SlotIndex] = InComponent;
+        ComponentSlots.Add(InComponent, SlotIndex);
+        MarkSlotDirty(SlotIndex);
+    }
+    else
+    {
+        bPendingRebuild = true;
+    }
 }
 
 void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
@@ -112,14 +172,55 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         return;
     }
 
+    // Park 상태에서 제거되면 비워 둔 슬롯은 일반 tombstone이 됨
+    if (ParkedSlots.Remove(InComponent))
+    {
+        ++TombstoneCount;
+    }
+
     if (StaticMeshComponentBounds.Find(InComponent))
     {
         StaticMeshComponentBounds.Remove(InComponent);
-        bPendingRebuild = true;
+
+        // 트리에 있던 슬롯은 비워두고(tombstone) 해당 리프만 리핏, 리빌드 시 정리됨
+        if (const int32* Slot = ComponentSlots.Find(InComponent))
+        {
+            const int32 SlotIndex = *Slot;
+            ComponentSlots.Remove(InComponent);
+            StaticMeshComponentArray[SlotIndex] = nullptr;
+            ++TombstoneCount;
+            if (!bPendingRebuild)
+            {
+                MarkSlotDirty(SlotIndex);
+            }
+        }
     }
 }
 
-void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+void FBVHierarchy::Park(UPrimitiveComponent* InComponent)
+{
+    if (!InComponent)
+    {
+        return;
+    }
+
+    // 아직 트리에 들어가지 않았거나 어차피 리빌드 예정이면 일반 제거와 같음
+    const int32* Slot = ComponentSlots.Find(InComponent);
+    if (!Slot || bPendingRebuild)
+    {
+        Remove(InComponent);
+        return;
+    }
+
+    const int32 SlotIndex = *Slot;
+    StaticMeshComponentBounds.Remove(InComponent);
+    ComponentSlots.Remove(InComponent);
+    StaticMeshComponentArray[SlotIndex] = nullptr;
+    ParkedSlots.Add(InComponent, SlotIndex);
+    MarkSlotDirty(SlotIndex);
+}
+
+void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum, OUT TArray<UPrimitiveComponent*>& OutVisibleComponents) const
 {
     if (Nodes.empty()) return;
     //프러스텀 외부에 바운드 존재
@@ -127,18 +228,34 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
     //프러스텀 내부에 바운드 존재 (교차 X)
     if (!IsAABBIntersects(InFrustum, Nodes[0].Bounds))
     {
-        for (UPrimitiveComponent* Component : StaticMeshComponentArray)
+        CollectSubtree(0, OutVisibleComponents);
+        return;
+    }
+
+    // 교차 리프의 컴포넌트는 8개씩 모아서 AVX 커널로 한 번에 판정
+    FAABB BatchBounds[8];
+    UPrimitiveComponent* BatchComponents[8] = {};
+    int32 BatchCount = 0;
+
+    auto FlushBatch = [&]()
         {
-            if (!Component) continue;
-            if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                continue;
-            if (AActor* Owner = Component->GetOwner())
+            if (BatchCount == 0) return;
+            // 남는 슬롯은 첫 번째 박스로 채우고 마스크에서 제외
+            for (int32 i = BatchCount; i < 8; ++i)
             {
-                Owner->SetCulled(false);
+                BatchBounds[i] = BatchBounds[0];
             }
-        }
-        return;
-    }
+            const uint8 VisibleMask = AreAABBsVisible_8_AVX(InFrustum, BatchBounds);
+            for (int32 i = 0; i < BatchCount; ++i)
+            {
+                if (VisibleMask & (1u << i))
+                {
+                    OutVisibleComponents.Add(BatchComponents[i]);
+                }
+            }
+            BatchCount = 0;
+        };
+
     //프러스텀과 바운드가 교차
     TArray<int32> IdxStack;
     IdxStack.push_back({ 0 });
@@ -153,24 +270,64 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
             for (int32 i = 0; i < node.Count; ++i)
             {
                 UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                    continue;
+                if (!Component) continue;
                 const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
+                if (!Cached) continue;
+
+                BatchBounds[BatchCount] = *Cached;
+                BatchComponents[BatchCount] = Component;
+                if (++BatchCount == 8)
                 {
-                    if (AActor* Owner = Component->GetOwner())
-                    {
-                        Owner->SetCulled(false);
-                    }
+                    FlushBatch();
                 }
             }
             continue;
         }
-        if (node.Left >= 0 && IsAABBVisible(InFrustum, Nodes[node.Left].Bounds))
-            IdxStack.push_back({ node.Left });
-        if (node.Right >= 0 && IsAABBVisible(InFrustum, Nodes[node.Right].Bounds))
-            IdxStack.push_back({ node.Right });
+
+        // 자식 노드: 완전 내부면 판정 없이 수집, 교차면 계속 내려감
+        for (int32 Child : { node.Left, node.Right })
+        {
+            if (Child < 0) continue;
+            const FAABB& ChildBounds = Nodes[Child].Bounds;
+            if (!IsAABBVisible(InFrustum, ChildBounds)) continue;
+            if (!IsAABBIntersects(InFrustum, ChildBounds))
+            {
+                CollectSubtree(Child, OutVisibleComponents);
+            }
+            else
+            {
+                IdxStack.push_back(Child);
+            }
+        }
+    }
+
+    FlushBatch();
+}
+
+void FBVHierarchy::CollectSubtree(int32 NodeIndex, OUT TArray<UPrimitiveComponent*>& OutComponents) const
+{
+    TArray<int32> IdxStack;
+    IdxStack.push_back(NodeIndex);
+
+    while (!IdxStack.empty())
+    {
+        const FLBVHNode& Node = Nodes[IdxStack.back()];
+        IdxStack.pop_back();
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                // 리빌드 전에 제거된 컴포넌트는 제외
+                if (Component && StaticMeshComponentBounds.find(Component) != StaticMeshComponentBounds.end())
+                {
+                    OutComponents.Add(Component);
+                }
+            }
+            continue;
+        }
+        if (Node.Left >= 0) IdxStack.push_back(Node.Left);
+        if (Node.Right >= 0) IdxStack.push_back(Node.Right);
     }
 }
 
@@ -225,7 +382,7 @@ int FBVHierarchy::TotalNodeCount() const
 
 int FBVHierarchy::TotalActorCount() const
 {
-    return static_cast<int>(StaticMeshComponentArray.size());
+    return static_cast<int>(StaticMeshComponentArray.size()) - TombstoneCount - ParkedSlots.Num();
 }
 
 int FBVHierarchy::MaxOccupiedDepth() const
@@ -272,12 +429,19 @@ namespace
 void FBVHierarchy::BuildLBVH()
 {
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
+    ParkedSlots = TMap<UPrimitiveComponent*, int32>();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
 
     if (N == 0)
     {
         Bounds = FAABB();
+        ComponentSlots = TMap<UPrimitiveComponent*, int32>();
+        SlotToLeaf.clear();
+        LeafDirtyFlags.clear();
+        DirtyLeaves.clear();
+        NodeAreaSum = 0.0;
+        TombstoneCount = 0;
         return;
     }
 
@@ -354,6 +518,35 @@ void FBVHierarchy::BuildLBVH()
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
     BuildRange(0, N);
+
+    // 리핏용 역참조 테이블 구성
+    ComponentSlots = TMap<UPrimitiveComponent*, int32>();
+    ComponentSlots.reserve(N);
+    for (int i = 0; i < N; ++i)
+    {
+        ComponentSlots.Add(StaticMeshComponentArray[i], i);
+    }
+
+    SlotToLeaf.resize(N);
+    NodeAreaSum = 0.0;
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        const FLBVHNode& Node = Nodes[NodeIndex];
+        NodeAreaSum += SurfaceArea(Node.Bounds);
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                SlotToLeaf[Node.First + i] = NodeIndex;
+            }
+        }
+    }
+
+    LeafDirtyFlags = TArray<uint8>();
+    LeafDirtyFlags.resize(Nodes.Num(), 0);
+    DirtyLeaves.clear();
+    TombstoneCount = 0;
+    BuildAreaCost = GetNormalizedAreaCost();
 }
 
 int FBVHierarchy::BuildRange(int s, int e)
@@ -397,6 +590,8 @@ int FBVHierarchy::BuildRange(int s, int e)
     int L = BuildRange(s, mid);
     int R = BuildRange(mid, e);
     node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
+    Nodes[L].Parent = nodeIdx;
+    Nodes[R].Parent = nodeIdx;
     node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
     return nodeIdx;
 }
@@ -500,7 +695,94 @@ void FBVHierarchy::FlushRebuild()
     {
         BuildLBVH();
         bPendingRebuild = false;
+        return;
+    }
+
+    if (!DirtyLeaves.empty())
+    {
+        Refit();
+
+        // 리핏으로 트리 품질이 일정 수준 이상 나빠졌을 때만 전체 리빌드
+        if (ShouldRebuildAfterRefit())
+        {
+            BuildLBVH();
+        }
+    }
+}
+
+void FBVHierarchy::MarkSlotDirty(int32 Slot)
+{
+    const int32 Leaf = SlotToLeaf[Slot];
+    if (!LeafDirtyFlags[Leaf])
+    {
+        LeafDirtyFlags[Leaf] = 1;
+        DirtyLeaves.Add(Leaf);
+    }
+}
+
+// 변경된 리프부터 루트 방향으로 바운드를 다시 합친다.
+// 노드 바운드가 그대로면 그 위 조상도 바뀌지 않으므로 해당 경로는 거기서 멈춘다.
+void FBVHierarchy::Refit()
+{
+    for (int32 Leaf : DirtyLeaves)
+    {
+        LeafDirtyFlags[Leaf] = 0;
+
+        const FLBVHNode& LeafNode = Nodes[Leaf];
+        bool bInitialized = false;
+        FAABB LeafBounds = LeafNode.Bounds;
+        for (int32 i = 0; i < LeafNode.Count; ++i)
+        {
+            UPrimitiveComponent* Component = StaticMeshComponentArray[LeafNode.First + i];
+            if (!Component) continue;
+            const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+            if (!Cached) continue;
+            LeafBounds = bInitialized ? FAABB::Union(LeafBounds, *Cached) : *Cached;
+            bInitialized = true;
+        }
+        // 리프가 전부 비었으면 기존 바운드를 유지 (쿼리에서 빈 슬롯은 건너뜀)
+
+        int32 NodeIndex = Leaf;
+        bool bChanged = SetNodeBounds(NodeIndex, LeafBounds);
+        while (bChanged && Nodes[NodeIndex].Parent >= 0)
+        {
+            NodeIndex = Nodes[NodeIndex].Parent;
+            const FLBVHNode& Node = Nodes[NodeIndex];
+            bChanged = SetNodeBounds(NodeIndex, FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds));
+        }
+    }
+    DirtyLeaves.clear();
+
+    Bounds = Nodes[0].Bounds;
+}
+
+bool FBVHierarchy::SetNodeBounds(int32 NodeIndex, const FAABB& NewBounds)
+{
+    FLBVHNode& Node = Nodes[NodeIndex];
+    if (IsSameBounds(Node.Bounds, NewBounds))
+    {
+        return false;
+    }
+    NodeAreaSum += SurfaceArea(NewBounds) - SurfaceArea(Node.Bounds);
+    Node.Bounds = NewBounds;
+    return true;
+}
+
+float FBVHierarchy::GetNormalizedAreaCost() const
+{
+    if (Nodes.empty()) return 0.0f;
+    const double RootArea = SurfaceArea(Nodes[0].Bounds);
+    return RootArea > 0.0 ? static_cast<float>(NodeAreaSum / RootArea) : 0.0f;
+}
+
+bool FBVHierarchy::ShouldRebuildAfterRefit() const
+{
+    const int32 N = StaticMeshComponentArray.Num();
+    if (N > 0 && TombstoneCount > static_cast<int32>(N * TombstoneRatioThreshold))
+    {
+        return true;
     }
+    return BuildAreaCost > 0.0f && GetNormalizedAreaCost() > BuildAreaCost * RefitCostGrowthThreshold;
 }
 
 template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "DevBenchmarks.h"
 
 struct FFrustum;
 struct FRay; // forward declaration for ray type
@@ -27,13 +28,19 @@ public:
     void Clear();
 
     void BulkUpdate(const TArray<UPrimitiveComponent*>& Components);
+    // 바운드를 미리 계산해 둔 경우 (Bounds[i]가 Components[i]의 월드 AABB)
+    void BulkUpdate(const TArray<UPrimitiveComponent*>& Components, const TArray<FAABB>& ComponentBounds);
     void Update(UPrimitiveComponent* InComponent);
     void Remove(UPrimitiveComponent* InComponent);
+    // 쿼리에서는 빠지지만 배열 슬롯은 유지 (액터 풀 반납용). 다음 Update 때 같은 슬롯으로 복귀해서 리빌드 없이 리핏만 수행
+    void Park(UPrimitiveComponent* InComponent);
 
+    // 구조 변경(추가)이 있으면 전체 리빌드, 바운드만 바뀌었으면 변경된 리프의 조상만 리핏
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
-    void QueryFrustum(const FFrustum& InFrustum);
+    // 절두체와 겹치는 컴포넌트를 OutVisibleComponents에 수집 (리프 후보는 8개씩 AVX로 판정)
+    void QueryFrustum(const FFrustum& InFrustum, OUT TArray<UPrimitiveComponent*>& OutVisibleComponents) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
@@ -46,6 +53,7 @@ public:
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    const TMap<UPrimitiveComponent*, FAABB>& GetComponentBounds() const { return StaticMeshComponentBounds; }
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -59,10 +67,21 @@ private:
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
+        int32 Parent = -1;
         bool IsLeaf() const { return Count > 0; }
     };
     void BuildLBVH();
 
+    // === Refit ===
+    void MarkSlotDirty(int32 Slot);
+    void Refit();
+    bool SetNodeBounds(int32 NodeIndex, const FAABB& NewBounds);
+    bool ShouldRebuildAfterRefit() const;
+    float GetNormalizedAreaCost() const;
+
+    // 바운드만 갱신 (Update 및 벤치마크 공용)
+    void UpdateComponentBounds(UPrimitiveComponent* InComponent, const FAABB& WorldBounds);
+
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
     TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
@@ -71,6 +90,9 @@ private:
 
     int BuildRange(int s, int e);
 
+    // 노드 하위의 모든 컴포넌트를 판정 없이 수집 (절두체 완전 내부 노드용)
+    void CollectSubtree(int32 NodeIndex, OUT TArray<UPrimitiveComponent*>& OutComponents) const;
+
     int Depth;
     int MaxDepth;
     int MaxObjects;
@@ -82,5 +104,28 @@ private:
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
+    // 리핏용 역참조: 컴포넌트 -> 배열 슬롯, 슬롯 -> 리프 노드
+    TMap<UPrimitiveComponent*, int32> ComponentSlots;
+    TArray<int32> SlotToLeaf;
+    TArray<int32> DirtyLeaves;
+    TArray<uint8> LeafDirtyFlags;
+
+    // Park된 컴포넌트 -> 비워 둔 슬롯 (리빌드 시 초기화)
+    TMap<UPrimitiveComponent*, int32> ParkedSlots;
+
+    // 리핏 후 품질 측정 (모든 노드 표면적의 합 / 루트 표면적, 정규화된 SAH 비용)
+    double NodeAreaSum = 0.0;
+    float BuildAreaCost = 0.0f;
+    int32 TombstoneCount = 0;   // 리빌드 전까지 배열에 남아있는 제거된 슬롯 수
+
+    // 리빌드 전환 임계값: 정규화 SAH 비용이 빌드 직후 대비 이 배율을 넘거나, 제거된 슬롯이 이 비율을 넘으면 리빌드
+    static constexpr float RefitCostGrowthThreshold = 1.5f;
+    static constexpr float TombstoneRatioThreshold = 0.25f;
+
     bool bPendingRebuild = false;
+
+#if MUNDI_DEV_BENCHMARKS
+    // 리핏/리빌드 비교 벤치마크는 실제 컴포넌트 없이 바운드만으로 트리를 만들기 때문에 빌드 경로에 직접 접근
+    friend void DevBenchmarks::RunBvhRefitBenchmark(int32 NumComponents, int32 NumMoving, int32 NumFrames);
+#endif
 };
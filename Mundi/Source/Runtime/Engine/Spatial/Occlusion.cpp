@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
 #include "Frustum.h"
+#include <immintrin.h> // For SSE instructions
 
 // NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
 // static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
@@ -45,7 +46,8 @@ bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
 		// 1) 화면 사각형용: WVP → NDC
 		float c[4];
 		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+		// 근평면에 걸친 AABB는 사각형 투영이 성립하지 않으므로 판정 불가로 처리 (호출부에서 보수적으로 다룸)
+		if (c[3] <= D.NearClip) return false;
 
 		const float invW = 1.0f / c[3];
 		const float ndcX = c[0] * invW;  // -1..1
@@ -150,20 +152,29 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
 	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
 	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
+	if (StateSerial.size() <= maxId) StateSerial.resize(maxId + 1, 0);
 
 	for (const auto& D : Candidates)
 	{
 		uint32_t id = D.ActorIndex;
 
+		// 삭제된 객체의 슬롯을 새 객체가 재사용했으면 이전 객체의 연속 프레임 수를 물려받지 않도록 초기화
+		if (StateSerial[id] != D.SerialNumber)
+		{
+			StateSerial[id] = D.SerialNumber;
+			VisibleStreak[id] = 0;
+			OccludedStreak[id] = 0;
+			LastState[id] = 1;
+		}
+
 		FOcclusionRect R;
 		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
 		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
+			// 후보는 이미 절두체 컬링을 통과했으므로 여기서 실패하는 건 근평면에 걸친 경우 → 보임으로 처리
+			OutVisibleFlags[id] = 1;
+			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
+			OccludedStreak[id] = 0;
+			LastState[id] = 1;
 			continue;
 		}
 
@@ -200,7 +211,8 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 				occluded = false;
 		}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
+		// --- 히스테리시스: 보임 → 가림 전환만 2~3프레임 연속일 때 허용 ---
+		// 가림 → 보임은 즉시 전환 (보여야 할 물체가 한 프레임이라도 빠지면 팝핑이 생김)
 		const int thresh = 2; // 2~3 추천
 
 		if (occluded)
@@ -216,13 +228,140 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 		{
 			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
 			OccludedStreak[id] = 0;
-
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
 		}
 
 		LastState[id] = occluded ? 0 : 1;
 		OutVisibleFlags[id] = occluded ? 0 : 1;
 	}
-}
\ No newline at end of file
+}
+
+float FOcclusionCullingManagerCPU::ComputeScreenArea(const FCandidateDrawable& D)
+{
+	FOcclusionRect R;
+	if (!ComputeRectAndMinZ(D, 0, 0, R))
+		return 0.0f;
+	return std::max(0.0f, R.MaxX - R.MinX) * std::max(0.0f, R.MaxY - R.MinY);
+}
+
+uint32 FOcclusionCullingManagerCPU::BuildOccluderDepth(const TArray<FOccluderMesh>& Occluders)
+{
+	Grid.Clear();
+
+	const float GW = float(Grid.GetWidth());
+	const float GH = float(Grid.GetHeight());
+
+	struct FProjectedVertex
+	{
+		float X, Y, Z;  // 그리드 픽셀 좌표 + 선형 깊이(0..1)
+		bool bValid;    // 근평면 앞쪽에 있는지
+	};
+	TArray<FProjectedVertex> Projected;
+	uint32 TriangleCount = 0;
+
+	for (const FOccluderMesh& O : Occluders)
+	{
+		if (!O.Vertices || !O.Indices) continue;
+		const TArray<FNormalVertex>& Vertices = *O.Vertices;
+		const TArray<uint32>& Indices = *O.Indices;
+
+		// 1) 정점 변환 (행벡터: clip = x*R0 + y*R1 + z*R2 + R3)
+		const __m128 R0 = O.WorldViewProj.Rows[0];
+		const __m128 R1 = O.WorldViewProj.Rows[1];
+		const __m128 R2 = O.WorldViewProj.Rows[2];
+		const __m128 R3 = O.WorldViewProj.Rows[3];
+
+		Projected.resize(Vertices.size());
+		for (size_t i = 0; i < Vertices.size(); ++i)
+		{
+			const FVector& P = Vertices[i].pos;
+			const __m128 Clip = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(P.X), R0), _mm_mul_ps(_mm_set1_ps(P.Y), R1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(P.Z), R2), R3));
+			alignas(16) float c[4];
+			_mm_store_ps(c, Clip);
+
+			FProjectedVertex& Out = Projected[i];
+			Out.bValid = c[3] > O.NearClip;
+			if (!Out.bValid) continue;
+
+			const float invW = 1.0f / c[3];
+			Out.X = (0.5f * (c[0] * invW + 1.0f)) * GW;
+			Out.Y = (0.5f * (c[1] * invW + 1.0f)) * GH;
+			Out.Z = LinearizeZ01(c[3], O.NearClip, O.FarClip); // PerspectiveFovLH: w == 뷰 공간 z
+		}
+
+		// 2) 삼각형 래스터화
+		//    근평면에 걸친 삼각형은 클리핑 대신 건너뜀 (오클루더가 줄어드는 쪽이라 보수적)
+		for (size_t t = 0; t + 2 < Indices.size(); t += 3)
+		{
+			const FProjectedVertex& A = Projected[Indices[t + 0]];
+			const FProjectedVertex& B = Projected[Indices[t + 1]];
+			const FProjectedVertex& C = Projected[Indices[t + 2]];
+			if (!A.bValid || !B.bValid || !C.bValid) continue;
+
+			const float MaxZ = std::max(A.Z, std::max(B.Z, C.Z));
+			Grid.RasterizeTriangleDepthMin(A.X, A.Y, B.X, B.Y, C.X, C.Y, MaxZ);
+			++TriangleCount;
+		}
+	}
+
+	return TriangleCount;
+}
+
+void FOcclusionGrid::RasterizeTriangleDepthMin(float X0, float Y0, float X1, float Y1, float X2, float Y2, float MaxZ)
+{
+	// 오클루더는 양면으로 래스터화: 감김 방향이 반대면 정점 순서를 뒤집어 에지 함수 부호를 통일
+	const float Area = (X1 - X0) * (Y2 - Y0) - (Y1 - Y0) * (X2 - X0);
+	if (std::fabs(Area) < 1e-6f) return;
+	if (Area < 0.0f)
+	{
+		std::swap(X1, X2);
+		std::swap(Y1, Y2);
+	}
+
+	int MinPX = std::max(0, int(std::floor(std::min(X0, std::min(X1, X2)))));
+	int MinPY = std::max(0, int(std::floor(std::min(Y0, std::min(Y1, Y2)))));
+	const int MaxPX = std::min(Width - 1, int(std::ceil(std::max(X0, std::max(X1, X2)))));
+	const int MaxPY = std::min(Height - 1, int(std::ceil(std::max(Y0, std::max(Y1, Y2)))));
+	if (MinPX > MaxPX || MinPY > MaxPY) return;
+
+	// Width가 4의 배수이므로 4정렬된 시작점에서 x+3은 항상 행 안에 있음
+	MinPX &= ~3;
+
+	// 에지 함수 E(p) = A*px + B*py + C (세 값이 모두 >= 0 이면 내부)
+	const float A0 = Y0 - Y1, B0 = X1 - X0, C0 = -(A0 * X0 + B0 * Y0);
+	const float A1 = Y1 - Y2, B1 = X2 - X1, C1 = -(A1 * X1 + B1 * Y1);
+	const float A2 = Y2 - Y0, B2 = X0 - X2, C2 = -(A2 * X2 + B2 * Y2);
+
+	const __m128 VA0 = _mm_set1_ps(A0), VA1 = _mm_set1_ps(A1), VA2 = _mm_set1_ps(A2);
+	const __m128 VStepX0 = _mm_set1_ps(A0 * 4.0f), VStepX1 = _mm_set1_ps(A1 * 4.0f), VStepX2 = _mm_set1_ps(A2 * 4.0f);
+	const __m128 VZ = _mm_set1_ps(MaxZ);
+	const __m128 VZero = _mm_setzero_ps();
+
+	// 픽셀 중심 (x + 0.5)
+	const __m128 VPixelX = _mm_setr_ps(MinPX + 0.5f, MinPX + 1.5f, MinPX + 2.5f, MinPX + 3.5f);
+
+	for (int y = MinPY; y <= MaxPY; ++y)
+	{
+		const float Py = float(y) + 0.5f;
+		__m128 E0 = _mm_add_ps(_mm_mul_ps(VA0, VPixelX), _mm_set1_ps(B0 * Py + C0));
+		__m128 E1 = _mm_add_ps(_mm_mul_ps(VA1, VPixelX), _mm_set1_ps(B1 * Py + C1));
+		__m128 E2 = _mm_add_ps(_mm_mul_ps(VA2, VPixelX), _mm_set1_ps(B2 * Py + C2));
+
+		float* Row = &Depth[size_t(y) * Width];
+		for (int x = MinPX; x <= MaxPX; x += 4)
+		{
+			const __m128 Inside = _mm_and_ps(_mm_cmpge_ps(E0, VZero), _mm_and_ps(_mm_cmpge_ps(E1, VZero), _mm_cmpge_ps(E2, VZero)));
+			if (_mm_movemask_ps(Inside))
+			{
+				const __m128 Current = _mm_loadu_ps(Row + x);
+				const __m128 Closer = _mm_min_ps(Current, VZ); // 가장 가까운 깊이로 갱신
+				_mm_storeu_ps(Row + x, _mm_or_ps(_mm_and_ps(Inside, Closer), _mm_andnot_ps(Inside, Current)));
+			}
+
+			E0 = _mm_add_ps(E0, VStepX0);
+			E1 = _mm_add_ps(E1, VStepX1);
+			E2 = _mm_add_ps(E2, VStepX2);
+		}
+	}
+}
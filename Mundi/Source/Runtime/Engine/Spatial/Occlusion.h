@@ -4,10 +4,12 @@ struct FVector;
 struct FVector4;
 struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
 struct FAABB; // AABB
+struct FNormalVertex;
 
 struct FCandidateDrawable
 {
-    uint32_t ActorIndex;   // VisibleFlags 인덱스
+    uint32_t ActorIndex;   // VisibleFlags 인덱스 (GUObjectArray 슬롯)
+    uint32_t SerialNumber = 0; // 슬롯 재사용 구분용 (GUObjectSerialNumbers 값)
     FAABB   Bound;        // 월드 AABB (Min/Max)
     FMatrix  WorldViewProj;// 행벡터 기준 WVP
     FMatrix  WorldView;    // ★ 추가: World-space * View  (여기서는 View만 주면 됨)
@@ -15,6 +17,16 @@ struct FCandidateDrawable
     float    FarClip;         // ★ 추가
 };
 
+// 삼각형 단위로 래스터화할 오클루더 메시 (CPU 정점/인덱스 참조, 소유하지 않음)
+struct FOccluderMesh
+{
+    const TArray<FNormalVertex>* Vertices = nullptr;
+    const TArray<uint32>* Indices = nullptr;
+    FMatrix  WorldViewProj;  // 행벡터 기준 WVP (원근 투영 전제: clip.w == 뷰 공간 z)
+    float    NearClip;
+    float    FarClip;
+};
+
 // 교체 (MaxZ 추가)
 struct FOcclusionRect
 {
@@ -30,7 +42,8 @@ class FOcclusionGrid
 public:
     void Initialize(int InWidth, int InHeight)
     {
-        Width = InWidth; Height = InHeight;
+        // SIMD 래스터라이저가 4픽셀 단위로 처리하므로 가로 해상도는 4의 배수로 맞춤
+        Width = (InWidth + 3) & ~3; Height = InHeight;
         // 교체: 1.0f (Far)
         Depth.assign(size_t(Width * Height), 1.0f);
         BuildLevels.clear();
@@ -66,6 +79,10 @@ public:
         }
     }
 
+    // 삼각형 하나를 레벨0에 래스터화 (SSE, 4픽셀 단위 에지 함수 평가)
+    // X/Y는 그리드 픽셀 좌표, Z는 삼각형의 가장 먼 선형 깊이(보수적) - RasterizeRectDepthMin과 동일하게 min 누적
+    void RasterizeTriangleDepthMin(float X0, float Y0, float X1, float Y1, float X2, float Y2, float MaxZ);
+
     void BuildHZB()
     {
         BuildLevels.clear();
@@ -225,9 +242,17 @@ public:
     void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
     void Shutdown() {}
 
+    // 그리드 기본 해상도 (16:9 기준)
+    static constexpr int DefaultGridWidth = 256;
+    static constexpr int DefaultGridHeight = 144;
+
     // 1) 오클루더로 저해상도 Depth 채우기
     void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
 
+    // 1') 오클루더 메시의 실제 삼각형으로 Depth 채우기 (AABB 사각형보다 정확, 오목한 메시도 안전)
+    //     반환값: 래스터화된 삼각형 수
+    uint32 BuildOccluderDepth(const TArray<FOccluderMesh>& Occluders);
+
     // 2) CPU HZB
     void BuildHZB() { Grid.BuildHZB(); }
 
@@ -236,6 +261,9 @@ public:
 
     const FOcclusionGrid& GetGrid() const { return Grid; }
 
+    // 후보의 화면 점유 면적 [0..1] (오클루더 선택용). 화면 밖/근평면에 걸치면 0
+    static float ComputeScreenArea(const FCandidateDrawable& D);
+
 private:
     // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
     static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
@@ -254,4 +282,5 @@ private:
     TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
     TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
     TArray<uint8_t> LastState;       // 0=occluded, 1=visible
+    TArray<uint32_t> StateSerial;    // 위 상태를 기록한 객체의 일련번호 (슬롯이 재사용되면 상태를 초기화)
 };
\ No newline at end of file
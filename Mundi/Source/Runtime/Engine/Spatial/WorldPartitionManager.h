@@ -26,8 +26,12 @@ public:
 	// 신규 등록 API
 	void Register(UPrimitiveComponent* Smc);         // StaticMeshComponent 하나 추가
 	void BulkRegister(const TArray<AActor*>& Actors); // 여러 액터 한 번에 추가 (+즉시 리빌드)
+	// 이후 BulkRegister까지 Register/MarkDirty를 큐에 쌓지 않음 (등록할 액터 전체를 BulkRegister로 한 번에 반영할 때)
+	void BeginBulkRegister() { bBulkRegistering = true; }
 	
 	void Unregister(UPrimitiveComponent* Component);
+	// 액터 풀 반납: 쿼리에서 제외하되 BVH 슬롯은 유지 (다시 Register하면 리빌드 없이 복귀)
+	void Park(UPrimitiveComponent* Component);
 
 	// 업데이트 큐 등록 API
 	void MarkDirty(AActor* Actor);
@@ -37,7 +41,10 @@ public:
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
-	void FrustumQuery(FFrustum InFrustum);
+	void FrustumQuery(const FFrustum& InFrustum, OUT TArray<UPrimitiveComponent*>& OutVisibleComponents) const;
+
+	/** 아직 BVH에 반영되지 않은(갱신 대기 중인) 컴포넌트 */
+	const TSet<UPrimitiveComponent*>& GetDirtyComponents() const { return ComponentDirtySet; }
 
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
@@ -58,4 +65,5 @@ private:
 	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+	bool bBulkRegistering = false;
 };
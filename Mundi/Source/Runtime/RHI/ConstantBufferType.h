@@ -157,6 +157,25 @@ struct ColorBufferType // b3
     FVector Padding;
 };
 
+// b9: 인스턴싱 드로우의 첫 인스턴스 위치 (SV_InstanceID는 StartInstanceLocation을 더하지 않음)
+struct FInstancingBufferType
+{
+    uint32 InstanceOffset;
+    uint32 Padding[3];
+};
+
+// t12 (VS): 인스턴스별 데이터, Instancing.hlsl의 FInstanceData와 일치
+// ModelBufferType + ColorBufferType을 인스턴스 하나로 합친 것
+struct FInstanceData
+{
+    FMatrix World;
+    FMatrix WorldInverseTranspose;
+    FLinearColor Color;
+    uint32 ObjectID;
+    uint32 Padding[3];
+};
+static_assert(sizeof(FInstanceData) % 16 == 0, "FInstanceData must be 16-byte aligned");
+
 struct FLightBufferType
 {
     FAmbientLightInfo AmbientLight;
@@ -233,7 +252,8 @@ MACRO(CameraBufferType)             \
 MACRO(FLightBufferType)             \
 MACRO(FViewportConstants)           \
 MACRO(FTileCullingBufferType)       \
-MACRO(FPointLightShadowBufferType)
+MACRO(FPointLightShadowBufferType) \
+MACRO(FInstancingBufferType)
 
 // 16 바이트 패딩 어썰트
 #define STATIC_ASSERT_CBUFFER_ALIGNMENT(Type) \
@@ -256,6 +276,7 @@ CONSTANT_BUFFER_INFO(DecalBufferType, 6, true, true)
 CONSTANT_BUFFER_INFO(FireballBufferType, 6, false, true)
 CONSTANT_BUFFER_INFO(CameraBufferType, 7, true, true)  // b7, VS+PS (UberLit.hlsl과 일치)
 CONSTANT_BUFFER_INFO(FLightBufferType, 8, true, true)
+CONSTANT_BUFFER_INFO(FInstancingBufferType, 9, true, false)  // b9, VS only (Instancing.hlsl과 일치)
 CONSTANT_BUFFER_INFO(FViewportConstants, 10, true, true)   // 뷰 포트 크기에 따라 전체 화면 복사를 보정하기 위해 설정 (10번 고유번호로 사용)
 CONSTANT_BUFFER_INFO(FTileCullingBufferType, 11, false, true)  // b11, PS only (UberLit.hlsl과 일치)
 CONSTANT_BUFFER_INFO(FPointLightShadowBufferType, 12, true, true)  // b11, VS only
@@ -64,6 +64,7 @@ void D3D11RHI::Release()
     if (DepthStencilStateLessEqualWrite) { DepthStencilStateLessEqualWrite->Release(); DepthStencilStateLessEqualWrite = nullptr; }
     if (DepthStencilStateLessEqualReadOnly) { DepthStencilStateLessEqualReadOnly->Release(); DepthStencilStateLessEqualReadOnly = nullptr; }
     if (DepthStencilStateAlwaysNoWrite) { DepthStencilStateAlwaysNoWrite->Release(); DepthStencilStateAlwaysNoWrite = nullptr; }
+    if (DepthStencilStateAlwaysWrite) { DepthStencilStateAlwaysWrite->Release(); DepthStencilStateAlwaysWrite = nullptr; }
     if (DepthStencilStateDisable) { DepthStencilStateDisable->Release(); DepthStencilStateDisable = nullptr; }
     if (DepthStencilStateGreaterEqualWrite) { DepthStencilStateGreaterEqualWrite->Release(); DepthStencilStateGreaterEqualWrite = nullptr; }
     if (DepthStencilStateOverlayWriteStencil) { DepthStencilStateOverlayWriteStencil->Release(); DepthStencilStateOverlayWriteStencil = nullptr; }
@@ -200,6 +201,10 @@ void D3D11RHI::CreateDepthStencilState()
     desc.DepthFunc = D3D11_COMPARISON_GREATER_EQUAL;
     Device->CreateDepthStencilState(&desc, &DepthStencilStateGreaterEqualWrite);
 
+    // 5-1) AlwaysWrite: Always + Write ALL (섀도우 아틀라스 영역 초기화 용)
+    desc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+    Device->CreateDepthStencilState(&desc, &DepthStencilStateAlwaysWrite);
+
     // 6) OverlayWriteStencil: Always + NoWriteDepth + Stencil=REPLACE 1
     ZeroMemory(&desc, sizeof(desc));
     desc.DepthEnable = TRUE;
@@ -929,6 +934,9 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
     case EComparisonFunc::LessEqualReadOnly:
         DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
         break;
+    case EComparisonFunc::AlwaysWrite:
+        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysWrite, 0);
+        break;
     }
 }
 
@@ -39,6 +39,7 @@ enum class EComparisonFunc
 	GreaterEqual,
 	Disable,
 	LessEqualReadOnly,
+	AlwaysWrite,
 	// 필요시 추가 후 OMSetDepthStencilState 함수 수정
 };
 
@@ -257,6 +258,7 @@ private:
 	ID3D11DepthStencilState* DepthStencilStateLessEqualWrite = nullptr;      // 기본
 	ID3D11DepthStencilState* DepthStencilStateLessEqualReadOnly = nullptr;   // 읽기 전용
 	ID3D11DepthStencilState* DepthStencilStateAlwaysNoWrite = nullptr;       // 기즈모/오버레이
+	ID3D11DepthStencilState* DepthStencilStateAlwaysWrite = nullptr;         // 섀도우 아틀라스 영역 초기화
 	ID3D11DepthStencilState* DepthStencilStateDisable = nullptr;              // 깊이 테스트/쓰기 모두 끔
 	ID3D11DepthStencilState* DepthStencilStateGreaterEqualWrite = nullptr;   // 선택사항
 	// Stencil-based overlay control
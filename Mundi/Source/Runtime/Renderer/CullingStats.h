@@ -0,0 +1,80 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 가시성 컬링 통계 구조체
+// 프레임마다 절두체/오클루전 컬링을 통과/탈락한 프리미티브 수를 추적
+struct FCullingStats
+{
+	// 절두체 컬링
+	uint32 TotalPrimitives = 0;     // 컬링 대상 메시 프리미티브 수
+	uint32 VisiblePrimitives = 0;   // 절두체를 통과한 수
+	uint32 FrustumCulled = 0;       // 절두체 밖이라 제외된 수
+
+	// 오클루전 컬링 (CPU HZB)
+	uint32 Occluders = 0;           // 깊이 버퍼에 그린 오클루더 메시 수
+	uint32 OccluderTriangles = 0;   // 래스터화한 오클루더 삼각형 수
+	uint32 OcclusionTested = 0;     // 오클루전 판정을 받은 수
+	uint32 OcclusionCulled = 0;     // 가려져서 제외된 수
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		TotalPrimitives = 0;
+		VisiblePrimitives = 0;
+		FrustumCulled = 0;
+		Occluders = 0;
+		OccluderTriangles = 0;
+		OcclusionTested = 0;
+		OcclusionCulled = 0;
+	}
+
+	// 컬링 비율 (%)
+	float GetCulledRatio() const
+	{
+		return TotalPrimitives > 0 ? (static_cast<float>(FrustumCulled) / static_cast<float>(TotalPrimitives)) * 100.0f : 0.0f;
+	}
+
+	// 오클루전 컬링 비율 (%)
+	float GetOcclusionCulledRatio() const
+	{
+		return OcclusionTested > 0 ? (static_cast<float>(OcclusionCulled) / static_cast<float>(OcclusionTested)) * 100.0f : 0.0f;
+	}
+};
+
+// 컬링 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FCullingStatManager
+{
+public:
+	static FCullingStatManager& GetInstance()
+	{
+		static FCullingStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FCullingStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	// 통계 조회
+	const FCullingStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FCullingStatManager() = default;
+	~FCullingStatManager() = default;
+	FCullingStatManager(const FCullingStatManager&) = delete;
+	FCullingStatManager& operator=(const FCullingStatManager&) = delete;
+
+	FCullingStats CurrentStats;
+};
@@ -0,0 +1,72 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 메시 드로우 콜 통계 구조체
+// DrawMeshBatches가 배치를 그린 횟수와 인스턴싱으로 합쳐서 아낀 드로우 콜 수를 추적
+struct FDrawCallStats
+{
+	uint32 MeshBatches = 0;         // 그리기 대상이 된 유효한 배치 수 (인스턴싱이 없었다면 드로우 콜 수)
+	uint32 DrawCalls = 0;           // 실제로 호출한 DrawIndexed / DrawIndexedInstanced 수
+	uint32 InstancedDrawCalls = 0;  // 그 중 DrawIndexedInstanced 수
+	uint32 InstancedBatches = 0;    // 인스턴싱 드로우로 합쳐진 배치 수
+
+	void Reset()
+	{
+		MeshBatches = 0;
+		DrawCalls = 0;
+		InstancedDrawCalls = 0;
+		InstancedBatches = 0;
+	}
+
+	// 인스턴싱으로 줄어든 드로우 콜 수
+	uint32 GetSavedDrawCalls() const
+	{
+		return MeshBatches > DrawCalls ? MeshBatches - DrawCalls : 0;
+	}
+
+	// 인스턴싱 드로우 1회당 평균 인스턴스 수
+	float GetAverageInstances() const
+	{
+		return InstancedDrawCalls > 0 ? static_cast<float>(InstancedBatches) / static_cast<float>(InstancedDrawCalls) : 0.0f;
+	}
+};
+
+// 드로우 콜 통계 전역 매니저 (싱글톤)
+// 한 프레임 동안 모든 뷰포트/패스의 DrawMeshBatches 결과를 누적하고, URenderer::BeginFrame에서 초기화
+class FDrawCallStatManager
+{
+public:
+	static FDrawCallStatManager& GetInstance()
+	{
+		static FDrawCallStatManager Instance;
+		return Instance;
+	}
+
+	// 매 프레임 렌더링 시작 시 호출하여 누적값을 초기화
+	void ResetFrameStats()
+	{
+		FrameStats.Reset();
+	}
+
+	void AddStats(const FDrawCallStats& InStats)
+	{
+		FrameStats.MeshBatches += InStats.MeshBatches;
+		FrameStats.DrawCalls += InStats.DrawCalls;
+		FrameStats.InstancedDrawCalls += InStats.InstancedDrawCalls;
+		FrameStats.InstancedBatches += InStats.InstancedBatches;
+	}
+
+	// 통계 조회 (오버레이는 Present 직전에 그려지므로 이번 프레임 전체 누적값)
+	const FDrawCallStats& GetStats() const
+	{
+		return FrameStats;
+	}
+
+private:
+	FDrawCallStatManager() = default;
+	~FDrawCallStatManager() = default;
+	FDrawCallStatManager(const FDrawCallStatManager&) = delete;
+	FDrawCallStatManager& operator=(const FDrawCallStatManager&) = delete;
+
+	FDrawCallStats FrameStats;
+};
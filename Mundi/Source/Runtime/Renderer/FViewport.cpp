@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
+#include "World.h"
 
 FViewport::FViewport()
 {
@@ -8,6 +9,15 @@ FViewport::FViewport()
 
 FViewport::~FViewport()
 {
+	// 이 뷰포트용으로 월드가 보관하던 오클루전 컬러(HZB/그리드) 해제
+	for (const FWorldContext& WorldContext : GEngine.GetWorldContexts())
+	{
+		if (WorldContext.World)
+		{
+			WorldContext.World->ReleaseOcclusionCuller(reinterpret_cast<uint64>(this));
+		}
+	}
+
 	Cleanup();
 }
 
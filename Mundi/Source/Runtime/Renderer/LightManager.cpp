@@ -229,6 +229,7 @@ void FLightManager::Release()
 	if (ShadowAtlasSRV2D) { ShadowAtlasSRV2D->Release(); ShadowAtlasSRV2D = nullptr; }
 	if (ShadowAtlasDSV2D) { ShadowAtlasDSV2D->Release(); ShadowAtlasDSV2D = nullptr; }
 	if (ShadowAtlasTexture2D) { ShadowAtlasTexture2D->Release(); ShadowAtlasTexture2D = nullptr; }
+	InvalidateShadowViewCache();
 
 	// Cube Atlas Release
 	if (ShadowAtlasSRVCube) { ShadowAtlasSRVCube->Release(); ShadowAtlasSRVCube = nullptr; }
@@ -278,12 +279,12 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 	// 3. CBuffer 업데이트 (Ambient, Directional)
 	FLightBufferType LightBuffer{}; // 셰이더의 CBuffer 'b1'과 일치해야 함
 
-	if (AmbientLightList.Num() > 0 && AmbientLightList[0]->IsVisible() && AmbientLightList[0]->GetOwner()->IsActorVisible())
+	if (AmbientLightList.Num() > 0 && AmbientLightList[0]->IsVisible() && AmbientLightList[0]->GetOwner()->IsActorVisible() && AmbientLightList[0]->GetOwner()->IsActorActive())
 	{
 		LightBuffer.AmbientLight = AmbientLightList[0]->GetLightInfo();
 	}
 
-	if (DIrectionalLightList.Num() > 0 && DIrectionalLightList[0]->IsVisible() && DIrectionalLightList[0]->GetOwner()->IsActorVisible())
+	if (DIrectionalLightList.Num() > 0 && DIrectionalLightList[0]->IsVisible() && DIrectionalLightList[0]->GetOwner()->IsActorVisible() && DIrectionalLightList[0]->GetOwner()->IsActorActive())
 	{
 		UDirectionalLightComponent* Light = DIrectionalLightList[0];
 		LightBuffer.DirectionalLight = Light->GetLightInfo(); // 기본 정보 (색상, 방향)
@@ -307,7 +308,7 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 		PointLightInfoList.clear();
 		for (UPointLightComponent* Light : PointLightList)
 		{
-			if (Light->IsVisible() && Light->GetOwner()->IsActorVisible())
+			if (Light->IsVisible() && Light->GetOwner()->IsActorVisible() && Light->GetOwner()->IsActorActive())
 			{
 				FPointLightInfo Info = Light->GetLightInfo(); // 기본 정보
 
@@ -331,7 +332,7 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 		SpotLightInfoList.clear();
 		for (USpotLightComponent* Light : SpotLightList)
 		{
-			if (Light->IsVisible() && Light->GetOwner()->IsActorVisible())
+			if (Light->IsVisible() && Light->GetOwner()->IsActorVisible() && Light->GetOwner()->IsActorActive())
 			{
 				FSpotLightInfo Info = Light->GetLightInfo(); // 기본 정보
 
@@ -461,6 +462,9 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+
+	// 아틀라스가 전부 지워졌으므로 캐시된 섀도우 뷰도 무효
+	InvalidateShadowViewCache();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -555,6 +559,91 @@ void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRe
 	}
 }
 
+namespace
+{
+	// 같은 아틀라스 위치(2D 영역 또는 큐브 면)를 가리키는지
+	bool IsSameShadowTarget(const FShadowViewCacheEntry& Entry, const FShadowRenderRequest& Request)
+	{
+		if (Entry.SliceIndex != Request.AssignedSliceIndex || Entry.Size != Request.Size)
+		{
+			return false;
+		}
+		if (Request.AssignedSliceIndex >= 0)
+		{
+			return Entry.SubViewIndex == Request.SubViewIndex;
+		}
+		return Entry.AtlasViewportOffset.X == Request.AtlasViewportOffset.X
+			&& Entry.AtlasViewportOffset.Y == Request.AtlasViewportOffset.Y;
+	}
+
+	// 요청 영역을 그리면 내용이 덮어써지는 항목인지
+	bool IsShadowTargetOverlapped(const FShadowViewCacheEntry& Entry, const FShadowRenderRequest& Request)
+	{
+		if (Request.AssignedSliceIndex >= 0)
+		{
+			return Entry.SliceIndex == Request.AssignedSliceIndex && Entry.SubViewIndex == Request.SubViewIndex;
+		}
+		if (Entry.SliceIndex >= 0)
+		{
+			return false;
+		}
+		const float EntryMaxX = Entry.AtlasViewportOffset.X + Entry.Size;
+		const float EntryMaxY = Entry.AtlasViewportOffset.Y + Entry.Size;
+		const float RequestMaxX = Request.AtlasViewportOffset.X + Request.Size;
+		const float RequestMaxY = Request.AtlasViewportOffset.Y + Request.Size;
+		return Entry.AtlasViewportOffset.X < RequestMaxX && Request.AtlasViewportOffset.X < EntryMaxX
+			&& Entry.AtlasViewportOffset.Y < RequestMaxY && Request.AtlasViewportOffset.Y < EntryMaxY;
+	}
+}
+
+bool FLightManager::IsShadowViewCached(const FShadowRenderRequest& Request, uint64 ContentHash) const
+{
+	for (const FShadowViewCacheEntry& Entry : ShadowViewCache)
+	{
+		if (Entry.LightOwner == Request.LightOwner && Entry.ContentHash == ContentHash && IsSameShadowTarget(Entry, Request))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FLightManager::MarkShadowViewRendered(const FShadowRenderRequest& Request, uint64 ContentHash, bool bCacheable)
+{
+	// 같은 영역을 쓰던 항목(다른 뷰포트의 CSM 등)은 내용이 덮어써졌으므로 제거
+	ShadowViewCache.erase(
+		std::remove_if(ShadowViewCache.begin(), ShadowViewCache.end(),
+			[&Request](const FShadowViewCacheEntry& Entry) { return IsShadowTargetOverlapped(Entry, Request); }),
+		ShadowViewCache.end());
+
+	if (!bCacheable)
+	{
+		return;
+	}
+
+	FShadowViewCacheEntry Entry;
+	Entry.LightOwner = Request.LightOwner;
+	Entry.SubViewIndex = Request.SubViewIndex;
+	Entry.SliceIndex = Request.AssignedSliceIndex;
+	Entry.AtlasViewportOffset = Request.AtlasViewportOffset;
+	Entry.Size = Request.Size;
+	Entry.ContentHash = ContentHash;
+	ShadowViewCache.Add(Entry);
+}
+
+void FLightManager::InvalidateShadowViewCache()
+{
+	ShadowViewCache.clear();
+}
+
+void FLightManager::InvalidateShadowViewCache(ULightComponent* Light)
+{
+	ShadowViewCache.erase(
+		std::remove_if(ShadowViewCache.begin(), ShadowViewCache.end(),
+			[Light](const FShadowViewCacheEntry& Entry) { return Entry.LightOwner == Light; }),
+		ShadowViewCache.end());
+}
+
 void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
 {
 	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
@@ -724,6 +813,7 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	InvalidateShadowViewCache(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -740,6 +830,7 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
+	InvalidateShadowViewCache(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -755,6 +846,7 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	InvalidateShadowViewCache(LightComponent);
 }
 
 
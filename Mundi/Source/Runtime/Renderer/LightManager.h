@@ -52,6 +52,17 @@ struct FShadowRenderRequest
     }
 };
 
+// 섀도우 뷰 캐시 항목: 아틀라스의 한 영역(2D 영역 또는 큐브 슬라이스의 한 면)에 마지막으로 그린 내용의 서명
+struct FShadowViewCacheEntry
+{
+    ULightComponent* LightOwner = nullptr;
+    int32 SubViewIndex = -1;
+    int32 SliceIndex = -1;            // 큐브 슬라이스 (2D 아틀라스면 -1)
+    FVector2D AtlasViewportOffset;    // 2D 아틀라스 영역 시작점
+    uint32 Size = 0;
+    uint64 ContentHash = 0;           // 라이트 View-Projection + 캐스터 배치 + 섀도우 AA 기법
+};
+
 // -----------------------------------------------------------------------------
 // 2. Pass 2 (GPU) 셰이더용 구조체
 // -----------------------------------------------------------------------------
@@ -154,6 +165,13 @@ public:
     void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
+    // --- 섀도우 뷰 캐시 (라이트와 캐스터가 그대로면 아틀라스 영역을 다시 그리지 않음) ---
+    bool IsShadowViewCached(const FShadowRenderRequest& Request, uint64 ContentHash) const;
+    // 요청 영역을 새로 그렸음을 기록: 영역이 겹치는 기존 항목은 무효화되고, bCacheable이면 새 항목을 남김
+    void MarkShadowViewRendered(const FShadowRenderRequest& Request, uint64 ContentHash, bool bCacheable);
+    void InvalidateShadowViewCache();
+    void InvalidateShadowViewCache(ULightComponent* Light);
+
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
@@ -205,6 +223,9 @@ private:
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
 
+    // 아틀라스에 현재 남아 있는 섀도우 뷰 목록 (영역 재사용 판정용)
+    TArray<FShadowViewCacheEntry> ShadowViewCache;
+
 
     //structured buffer
     ID3D11Buffer* PointLightBuffer = nullptr;
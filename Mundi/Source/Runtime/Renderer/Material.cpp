@@ -55,6 +55,7 @@ void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 void UMaterial::SetShader(UShader* InShaderResource)
 {
 	Shader = InShaderResource;
+	++GShaderVariantGeneration;	// 이 머티리얼로 캐시된 메시 배치의 셰이더 변형 무효화
 }
 
 void UMaterial::SetShaderByName(const FString& InShaderName)
@@ -80,6 +81,7 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 	}
 
 	ShaderMacros = InShaderMacro;
+	++GShaderVariantGeneration;
 }
 
 UTexture* UMaterial::GetTexture(EMaterialTextureSlot Slot) const
@@ -285,6 +287,13 @@ void UMaterialInstanceDynamic::Serialize(const bool bInIsLoading, JSON& InOutHan
 	}
 }
 
+void UMaterialInstanceDynamic::LoadFromNode(const FJsonValue& InNode)
+{
+	// MID 슬롯은 머티리얼 슬롯 중에서도 드물어 이 노드 분량만 json::JSON으로 바꿔 기존 로드 경로를 재사용
+	JSON MaterialJson = InNode.ToJSON();
+	Serialize(true, MaterialJson);
+}
+
 void UMaterialInstanceDynamic::CopyParametersFrom(const UMaterialInstanceDynamic* Other)
 {
 	if (!Other)
@@ -81,6 +81,7 @@ public:
 	static UMaterialInstanceDynamic* Create(UMaterialInterface* InParentMaterial);
 	
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void LoadFromNode(const FJsonValue& InNode) override;
 
 	void CopyParametersFrom(const UMaterialInstanceDynamic* Other);
 
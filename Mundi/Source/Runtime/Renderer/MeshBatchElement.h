@@ -12,7 +12,7 @@ class UMaterial;
 struct FMeshBatchElement
 {
 	// --- 1. 정렬 키 (Sorting Keys) ---
-	// 렌더러가 상태 변경을 최소화하기 위해 정렬하는 기준입니다.
+	// 렌더러가 상태 변경을 최소화하기 위해 정렬하는 기준입니다. (SortKey에 압축된 ID로 들어감)
 	ID3D11VertexShader* VertexShader = nullptr;
 	ID3D11PixelShader* PixelShader = nullptr;
 	ID3D11InputLayout* InputLayout = nullptr;
@@ -62,33 +62,50 @@ struct FMeshBatchElement
 	// (기본값으로 흰색(1,1,1,1)을 설정하는 것이 일반적입니다.)
 	FLinearColor InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
+
+	// --- 4. 하드웨어 인스턴싱 (Instancing) ---
+	// USE_INSTANCING 변형 셰이더입니다. 셰이더가 인스턴싱을 지원하지 않으면 nullptr이며,
+	// 이 경우 같은 메시가 연속되어도 배치마다 DrawIndexed로 그립니다.
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+
+	// --- 5. 정렬 키 ---
+	// FMeshSortKeyBuilder가 셰이더/머티리얼/지오메트리 ID와 깊이 버킷으로 채우는 64비트 키입니다.
+	uint64 SortKey = 0;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
 
 	/**
 	 * @brief FMeshBatchElement 정렬을 위한 'less than' 연산자입니다.
-	 * TArray::Sort()가 A < B 를 비교하기 위해 이 함수를 호출합니다.
-	 * GPU 상태 변경을 최소화하는 순서로 정렬 키를 비교합니다.
+	 * FMeshSortKeyBuilder가 채운 SortKey만 비교합니다. (키를 만들기 전에는 모두 0)
 	 */
 	bool operator<(const FMeshBatchElement& B) const
 	{
-		const FMeshBatchElement& A = *this; // A는 'this' (자신), B는 비교 대상
-
-		// 1순위: 셰이더 프로그램 (VS, PS)
-		if (A.VertexShader != B.VertexShader) return A.VertexShader < B.VertexShader;
-		if (A.PixelShader != B.PixelShader) return A.PixelShader < B.PixelShader;
-
-		// 2순위: 셰이더 파라미터 (Material)
-		if (A.Material != B.Material) return A.Material < B.Material;
-
-		// 3순위: IA(Input Assembler) 상태 (버퍼, 스트라이드, 토폴로지)
-		if (A.VertexBuffer != B.VertexBuffer) return A.VertexBuffer < B.VertexBuffer;
-		if (A.IndexBuffer != B.IndexBuffer) return A.IndexBuffer < B.IndexBuffer;
-		if (A.VertexStride != B.VertexStride) return A.VertexStride < B.VertexStride;
-		if (A.PrimitiveTopology != B.PrimitiveTopology) return A.PrimitiveTopology < B.PrimitiveTopology;
+		return SortKey < B.SortKey;
+	}
 
-		// 모든 키가 동일하면 순서가 중요하지 않으므로 false 반환 (Stable Sort 보장)
-		return false;
+	/**
+	 * @brief 두 배치를 하나의 DrawIndexedInstanced로 합칠 수 있는지 확인합니다.
+	 * 인스턴스 데이터(월드 행렬, 색상, ObjectID)를 제외한 모든 상태가 같아야 합니다.
+	 */
+	bool CanInstanceWith(const FMeshBatchElement& B) const
+	{
+		return InstancedVertexShader && InstancedPixelShader
+			&& InstancedVertexShader == B.InstancedVertexShader
+			&& InstancedPixelShader == B.InstancedPixelShader
+			&& VertexShader == B.VertexShader
+			&& PixelShader == B.PixelShader
+			&& Material == B.Material
+			&& InstanceShaderResourceView == B.InstanceShaderResourceView
+			&& VertexBuffer == B.VertexBuffer
+			&& IndexBuffer == B.IndexBuffer
+			&& VertexStride == B.VertexStride
+			&& PrimitiveTopology == B.PrimitiveTopology
+			&& IndexCount == B.IndexCount
+			&& StartIndex == B.StartIndex
+			&& BaseVertexIndex == B.BaseVertexIndex;
 	}
 };
\ No newline at end of file
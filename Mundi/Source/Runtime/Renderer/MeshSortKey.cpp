@@ -0,0 +1,218 @@
+﻿#include "pch.h"
+#include "MeshSortKey.h"
+#include "Hash.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	constexpr uint32 ShaderIDBits = 12;
+	constexpr uint32 MaterialIDBits = 14;
+	constexpr uint32 GeometryIDBits = 22;
+	constexpr uint32 DepthBits = 16;
+	static_assert(ShaderIDBits + MaterialIDBits + GeometryIDBits + DepthBits == 64, "Sort key fields must fill 64 bits");
+
+	// 포인터 하위 비트는 정렬 때문에 대부분 0이므로 곱셈 후 상위 비트를 섞어서 사용
+	uint64 MixBits(uint64 Value)
+	{
+		Value *= 0x9e3779b97f4a7c15ull;
+		return Value ^ (Value >> 29);
+	}
+
+	uint64 HashPointer(const void* Ptr)
+	{
+		return MixBits(reinterpret_cast<uintptr_t>(Ptr));
+	}
+
+	// 양수 float의 비트 패턴은 값과 단조 증가 관계이므로 상위 16비트를 로그 분포 깊이 버킷으로 사용
+	// (지수 8비트 + 가수 상위 8비트, 상대 오차 약 0.4%)
+	uint32 QuantizeDepth(float Depth)
+	{
+		if (!(Depth > 0.0f))
+		{
+			return 0;
+		}
+		uint32 Bits;
+		std::memcpy(&Bits, &Depth, sizeof(Bits));
+		return Bits >> (32 - DepthBits - 1);
+	}
+}
+
+size_t FMeshSortKeyBuilder::FShaderKeyHash::operator()(const FShaderKey& Key) const
+{
+	uint64 Hash = HashPointer(Key.VertexShader);
+	Hash = HashCombine(Hash, HashPointer(Key.PixelShader));
+	Hash = HashCombine(Hash, HashPointer(Key.InputLayout));
+	return static_cast<size_t>(MixBits(Hash));
+}
+
+size_t FMeshSortKeyBuilder::FMaterialKeyHash::operator()(const FMaterialKey& Key) const
+{
+	return static_cast<size_t>(MixBits(HashCombine(HashPointer(Key.Material), HashPointer(Key.InstanceSRV))));
+}
+
+size_t FMeshSortKeyBuilder::FGeometryKeyHash::operator()(const FGeometryKey& Key) const
+{
+	uint64 Hash = HashPointer(Key.VertexBuffer);
+	Hash = HashCombine(Hash, HashPointer(Key.IndexBuffer));
+	Hash = HashCombine(Hash, (static_cast<uint64>(Key.VertexStride) << 32) | Key.Topology);
+	Hash = HashCombine(Hash, (static_cast<uint64>(Key.StartIndex) << 32) | Key.IndexCount);
+	Hash = HashCombine(Hash, Key.BaseVertexIndex);
+	return static_cast<size_t>(MixBits(Hash));
+}
+
+// 처음 보는 조합이면 다음 ID를 부여 (필드 폭을 넘으면 최댓값으로 포화)
+template<typename TKey, typename THash>
+uint32 FMeshSortKeyBuilder::TIDTable<TKey, THash>::FindOrAdd(const TKey& Key, uint32 Bits)
+{
+	if (bHasLast && LastKey == Key)
+	{
+		return LastID;
+	}
+
+	if ((Count + 1) * 2 > static_cast<uint32>(Slots.Num()))
+	{
+		Grow();
+	}
+
+	const uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+	uint32 SlotIndex = static_cast<uint32>(THash()(Key)) & Mask;
+	while (Slots[SlotIndex].bUsed && !(Slots[SlotIndex].Key == Key))
+	{
+		SlotIndex = (SlotIndex + 1) & Mask;
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	if (!Slot.bUsed)
+	{
+		const uint32 MaxID = (1u << Bits) - 1;
+		Slot.Key = Key;
+		Slot.ID = std::min(Count, MaxID);
+		Slot.bUsed = true;
+		++Count;
+	}
+
+	LastKey = Key;
+	LastID = Slot.ID;
+	bHasLast = true;
+	return LastID;
+}
+
+template<typename TKey, typename THash>
+void FMeshSortKeyBuilder::TIDTable<TKey, THash>::Grow()
+{
+	TArray<FSlot> OldSlots;
+	OldSlots.swap(Slots);
+	Slots.resize(std::max<size_t>(64, OldSlots.size() * 2));
+
+	const uint32 Mask = static_cast<uint32>(Slots.Num()) - 1;
+	for (const FSlot& Old : OldSlots)
+	{
+		if (!Old.bUsed)
+		{
+			continue;
+		}
+		uint32 SlotIndex = static_cast<uint32>(THash()(Old.Key)) & Mask;
+		while (Slots[SlotIndex].bUsed)
+		{
+			SlotIndex = (SlotIndex + 1) & Mask;
+		}
+		Slots[SlotIndex] = Old;
+	}
+}
+
+template<typename TKey, typename THash>
+void FMeshSortKeyBuilder::TIDTable<TKey, THash>::Reset()
+{
+	// 슬롯 메모리는 유지 (다음 프레임에도 비슷한 개수가 들어옴)
+	for (FSlot& Slot : Slots)
+	{
+		Slot.bUsed = false;
+	}
+	Count = 0;
+	bHasLast = false;
+}
+
+void FMeshSortKeyBuilder::Reset()
+{
+	ShaderIDs.Reset();
+	MaterialIDs.Reset();
+	GeometryIDs.Reset();
+}
+
+uint64 FMeshSortKeyBuilder::MakeSortKey(const FMeshBatchElement& Batch, EMeshSortMode Mode, const FVector& ViewOrigin, const FVector& ViewForward)
+{
+	const uint64 GeometryID = GeometryIDs.FindOrAdd(FGeometryKey{
+		Batch.VertexBuffer, Batch.IndexBuffer, Batch.VertexStride, static_cast<uint32>(Batch.PrimitiveTopology),
+		Batch.StartIndex, Batch.IndexCount, Batch.BaseVertexIndex }, GeometryIDBits);
+
+	if (Mode == EMeshSortMode::GeometryOnly)
+	{
+		return GeometryID << (64 - GeometryIDBits);
+	}
+
+	const uint64 ShaderID = ShaderIDs.FindOrAdd(FShaderKey{ Batch.VertexShader, Batch.PixelShader, Batch.InputLayout }, ShaderIDBits);
+	const uint64 MaterialID = MaterialIDs.FindOrAdd(FMaterialKey{ Batch.Material, Batch.InstanceShaderResourceView }, MaterialIDBits);
+	const uint64 StateKey = (ShaderID << (MaterialIDBits + GeometryIDBits)) | (MaterialID << GeometryIDBits) | GeometryID;
+
+	if (Mode == EMeshSortMode::StateOnly)
+	{
+		return StateKey << DepthBits;
+	}
+
+	// 월드 행렬의 평행이동(4행)을 배치 위치로 보고 뷰 방향 깊이 계산
+	const FVector Position(Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2]);
+	const uint64 Depth = QuantizeDepth(FVector::Dot(Position - ViewOrigin, ViewForward));
+
+	if (Mode == EMeshSortMode::FrontToBack)
+	{
+		return (StateKey << DepthBits) | Depth;
+	}
+
+	// BackToFront: 먼 것이 먼저 오도록 깊이를 반전해서 최상위에 둠
+	const uint64 InvertedDepth = ((1ull << DepthBits) - 1) - Depth;
+	return (InvertedDepth << (64 - DepthBits)) | StateKey;
+}
+
+void FMeshSortKeyBuilder::SortMeshBatches(TArray<FMeshBatchElement>& InOutBatches, EMeshSortMode Mode, const FVector& ViewOrigin, const FVector& ViewForward)
+{
+	const int32 Num = InOutBatches.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	// 키 생성 + 정렬 + 재배치 전체 비용 (섀도우/불투명/데칼 호출이 한 프레임에 합산되어 Draw Call 통계에 표시)
+	TIME_PROFILE(MeshSort)
+
+	// 1. 키 생성 (ID는 배치 순서대로 부여되므로 수집 순서가 같으면 결과도 같음)
+	SortEntries.resize(Num);
+	bool bAlreadySorted = true;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		FMeshBatchElement& Batch = InOutBatches[i];
+		Batch.SortKey = MakeSortKey(Batch, Mode, ViewOrigin, ViewForward);
+		SortEntries[i] = { Batch.SortKey, static_cast<uint32>(i) };
+		if (i > 0 && SortEntries[i - 1].Key > Batch.SortKey)
+		{
+			bAlreadySorted = false;
+		}
+	}
+
+	// 캐시된 배치처럼 이미 정렬된 순서로 수집되면 재배치 생략
+	if (bAlreadySorted)
+	{
+		return;
+	}
+
+	// 2. (키, 인덱스)만 기수 정렬
+	RadixSort::SortByKey(SortEntries, SortScratch);
+
+	// 3. 큰 배치 구조체는 한 번만 재배치
+	SortedBatches.clear();
+	SortedBatches.reserve(Num);
+	for (const FRadixSortEntry& Entry : SortEntries)
+	{
+		SortedBatches.push_back(std::move(InOutBatches[Entry.Index]));
+	}
+	InOutBatches.swap(SortedBatches);
+}
@@ -0,0 +1,110 @@
+﻿#pragma once
+#include "MeshBatchElement.h"
+#include "RadixSort.h"
+
+// 정렬 키에 깊이를 어떻게 섞을지
+enum class EMeshSortMode : uint8
+{
+	StateOnly,		// 상태(셰이더 → 머티리얼 → 지오메트리)만으로 정렬
+	FrontToBack,	// 상태 우선, 같은 지오메트리 안에서는 가까운 것부터 (불투명: Early-Z 이득, 인스턴싱 구간 유지)
+	BackToFront,	// 먼 것부터 그린 뒤 상태 순 (반투명: 깊이가 최상위 키). 아직 반투명 배치 목록이 없어 호출부 없음
+	GeometryOnly,	// 지오메트리만 (셰이더를 패스에서 고정하는 뎁스 전용 패스)
+};
+
+/**
+ * @class FMeshSortKeyBuilder
+ * @brief FMeshBatchElement마다 64비트 정렬 키를 만들고 LSD 기수 정렬로 배치 목록을 정렬합니다.
+ *
+ * 키에 포인터 값을 직접 넣지 않고, 셰이더/머티리얼/지오메트리 조합마다 처음 등장한 순서대로
+ * 작은 ID를 부여해서 씁니다. 같은 장면이면 할당 주소와 무관하게 항상 같은 그리기 순서가 나옵니다.
+ * 객체는 URenderer가 소유하고 FSceneRenderer가 뷰를 그리기 시작할 때 Reset()하므로 ID 테이블은 뷰 하나 동안만 유지되고,
+ * 테이블 슬롯과 정렬 버퍼 메모리는 프레임 간에 재사용됩니다.
+ *
+ * 키 레이아웃 (StateOnly / FrontToBack)
+ *   [63:52] 셰이더 ID 12비트 | [51:38] 머티리얼 ID 14비트 | [37:16] 지오메트리 ID 22비트 | [15:0] 깊이 16비트
+ * BackToFront는 반전된 깊이 16비트를 최상위로 올리고 나머지를 그 아래로 내립니다.
+ * ID가 필드 폭을 넘으면 최댓값으로 포화되며, 이 경우 해당 필드끼리만 덜 모일 뿐 그리기 결과는 같습니다.
+ */
+class FMeshSortKeyBuilder
+{
+public:
+	// 배치마다 SortKey를 채우고 키 순서로 안정 정렬
+	// ViewOrigin/ViewForward는 깊이를 쓰는 모드에서만 사용
+	void SortMeshBatches(TArray<FMeshBatchElement>& InOutBatches, EMeshSortMode Mode, const FVector& ViewOrigin = FVector(), const FVector& ViewForward = FVector(1, 0, 0));
+
+	// 배치 하나의 키 계산 (ID가 없으면 새로 부여)
+	uint64 MakeSortKey(const FMeshBatchElement& Batch, EMeshSortMode Mode, const FVector& ViewOrigin, const FVector& ViewForward);
+
+	// ID 테이블 초기화
+	void Reset();
+
+private:
+	struct FShaderKey
+	{
+		const void* VertexShader;
+		const void* PixelShader;
+		const void* InputLayout;
+		bool operator==(const FShaderKey& Other) const { return VertexShader == Other.VertexShader && PixelShader == Other.PixelShader && InputLayout == Other.InputLayout; }
+	};
+
+	struct FMaterialKey
+	{
+		const void* Material;
+		const void* InstanceSRV;
+		bool operator==(const FMaterialKey& Other) const { return Material == Other.Material && InstanceSRV == Other.InstanceSRV; }
+	};
+
+	struct FGeometryKey
+	{
+		const void* VertexBuffer;
+		const void* IndexBuffer;
+		uint32 VertexStride;
+		uint32 Topology;
+		uint32 StartIndex;
+		uint32 IndexCount;
+		uint32 BaseVertexIndex;
+		bool operator==(const FGeometryKey& Other) const
+		{
+			return VertexBuffer == Other.VertexBuffer && IndexBuffer == Other.IndexBuffer && VertexStride == Other.VertexStride
+				&& Topology == Other.Topology && StartIndex == Other.StartIndex && IndexCount == Other.IndexCount && BaseVertexIndex == Other.BaseVertexIndex;
+		}
+	};
+
+	struct FShaderKeyHash { size_t operator()(const FShaderKey& Key) const; };
+	struct FMaterialKeyHash { size_t operator()(const FMaterialKey& Key) const; };
+	struct FGeometryKeyHash { size_t operator()(const FGeometryKey& Key) const; };
+
+	// 조합 -> ID 테이블 (선형 탐사 오픈 어드레싱, 부하율 50% 이하 유지)
+	// 한 컴포넌트의 섹션들은 연속으로 수집되므로 직전 조회 결과를 먼저 확인
+	template<typename TKey, typename THash>
+	struct TIDTable
+	{
+		struct FSlot
+		{
+			TKey Key{};
+			uint32 ID = 0;
+			bool bUsed = false;
+		};
+
+		TArray<FSlot> Slots;
+		uint32 Count = 0;
+		TKey LastKey{};
+		uint32 LastID = 0;
+		bool bHasLast = false;
+
+		uint32 FindOrAdd(const TKey& Key, uint32 Bits);
+		void Reset();
+
+	private:
+		void Grow();
+	};
+
+	TIDTable<FShaderKey, FShaderKeyHash> ShaderIDs;
+	TIDTable<FMaterialKey, FMaterialKeyHash> MaterialIDs;
+	TIDTable<FGeometryKey, FGeometryKeyHash> GeometryIDs;
+
+	// 프레임 간 재사용하는 정렬 버퍼 (Reset해도 용량 유지)
+	TArray<FRadixSortEntry> SortEntries;
+	TArray<FRadixSortEntry> SortScratch;
+	TArray<FMeshBatchElement> SortedBatches;
+};
@@ -29,6 +29,8 @@
 #include "EditorEngine.h"
 #include "DecalComponent.h"
 #include "DecalStatManager.h"
+#include "DrawCallStats.h"
+#include "FrameArena.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
 
@@ -37,6 +39,7 @@
 URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 {
 	InitializeLineBatch();
+	MeshSortKeyBuilder = std::make_unique<FMeshSortKeyBuilder>();
 }
 
 URenderer::~URenderer()
@@ -45,6 +48,16 @@ URenderer::~URenderer()
 	{
 		delete LineBatchData;
 	}
+	if (InstanceDataSRV)
+	{
+		InstanceDataSRV->Release();
+		InstanceDataSRV = nullptr;
+	}
+	if (InstanceDataBuffer)
+	{
+		InstanceDataBuffer->Release();
+		InstanceDataBuffer = nullptr;
+	}
 }
 
 void URenderer::BeginFrame()
@@ -55,6 +68,7 @@ void URenderer::BeginFrame()
 
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FDrawCallStatManager::GetInstance().ResetFrameStats();
 
 	RHIDevice->ClearAllBuffer();
 }
@@ -62,12 +76,49 @@ void URenderer::BeginFrame()
 void URenderer::EndFrame()
 {
 	RHIDevice->Present();
+
+	// 이번 프레임의 임시 할당(TFrameArray 등)을 한꺼번에 되돌림
+	FFrameArena::Get().Reset();
+}
+
+ID3D11ShaderResourceView* URenderer::UploadInstanceData(const TArray<FInstanceData>& InInstances)
+{
+	if (InInstances.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const uint32 NumInstances = static_cast<uint32>(InInstances.Num());
+	if (NumInstances > InstanceDataCapacity)
+	{
+		if (InstanceDataSRV) { InstanceDataSRV->Release(); InstanceDataSRV = nullptr; }
+		if (InstanceDataBuffer) { InstanceDataBuffer->Release(); InstanceDataBuffer = nullptr; }
+
+		uint32 NewCapacity = std::max<uint32>(InstanceDataCapacity, 1024);
+		while (NewCapacity < NumInstances)
+		{
+			NewCapacity *= 2;
+		}
+
+		if (FAILED(RHIDevice->CreateStructuredBuffer(sizeof(FInstanceData), NewCapacity, nullptr, &InstanceDataBuffer)) ||
+			FAILED(RHIDevice->CreateStructuredBufferSRV(InstanceDataBuffer, &InstanceDataSRV)))
+		{
+			UE_LOG("URenderer::UploadInstanceData: Failed to create instance buffer (%u instances)", NewCapacity);
+			if (InstanceDataBuffer) { InstanceDataBuffer->Release(); InstanceDataBuffer = nullptr; }
+			InstanceDataCapacity = 0;
+			return nullptr;
+		}
+		InstanceDataCapacity = NewCapacity;
+	}
+
+	RHIDevice->UpdateStructuredBuffer(InstanceDataBuffer, InInstances.data(), NumInstances * sizeof(FInstanceData));
+	return InstanceDataSRV;
 }
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
-	FSceneRenderer SceneRenderer(World, View, this);
+	FSceneRenderer SceneRenderer(World, View, this, Viewport);
 
 	// 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
@@ -12,8 +12,10 @@ class UBillboardComponent;
 class UPrimitiveComponent;
 class UCameraComponent;
 class FSceneView;
+class FMeshSortKeyBuilder;
 
 struct FMaterialSlot;
+struct FInstanceData;
 
 class URenderer
 {
@@ -45,6 +47,13 @@ public:
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
 
+	// 인스턴싱 드로우용 인스턴스 데이터를 프레임 공용 Structured Buffer에 올리고 SRV를 반환 (t12에 바인딩해서 사용)
+	// 용량이 부족하면 2배씩 늘려 다시 만든다. 같은 프레임에 여러 번 호출되면 WRITE_DISCARD로 덮어쓴다.
+	ID3D11ShaderResourceView* UploadInstanceData(const TArray<FInstanceData>& InInstances);
+
+	// 배치 정렬 키 생성기 (FSceneRenderer가 뷰마다 Reset해서 사용, 정렬 버퍼는 프레임 간 재사용)
+	FMeshSortKeyBuilder& GetMeshSortKeyBuilder() { return *MeshSortKeyBuilder; }
+
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
@@ -65,6 +74,14 @@ private:
 
 	void InitializeLineBatch();
 
+	// 인스턴싱 드로우용 인스턴스 버퍼 (UploadInstanceData)
+	ID3D11Buffer* InstanceDataBuffer = nullptr;
+	ID3D11ShaderResourceView* InstanceDataSRV = nullptr;
+	uint32 InstanceDataCapacity = 0;
+
+	// FSceneRenderer는 뷰를 그릴 때마다 새로 만들어지므로 정렬 버퍼/ID 테이블 메모리는 여기서 유지
+	std::unique_ptr<FMeshSortKeyBuilder> MeshSortKeyBuilder;
+
 	// 이전 drawCall에서 이미 썼던 RnderState면, 다시 Set 하지 않기 위해 만든 변수들
 	EViewMode PreViewModeIndex = EViewMode::VMI_Wireframe; // RSSetState, UpdateColorConstantBuffers
 	//UMaterial* PreUMaterial = nullptr; // SRV, UpdatePixelConstantBuffers
@@ -20,7 +20,9 @@
 #include "BVHierarchy.h"
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
+#include "StaticMesh.h"
 #include "DecalStatManager.h"
+#include "DrawCallStats.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "OBB.h"
@@ -44,21 +46,27 @@
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "CullingStats.h"
 #include "PlatformTime.h"
+#include "FrameArena.h"
 #include "PostProcessing/VignettePass.h"
 #include "SkeletalMeshComponent.h"
 
 FSceneRenderer::FSceneRenderer(
 	UWorld* InWorld,
 	FSceneView* InView,
-	URenderer* InOwnerRenderer
+	URenderer* InOwnerRenderer,
+	FViewport* InViewport
 )
 	: World(InWorld)
 	, View(InView) // 전달받은 FSceneView 저장
+	, Viewport(InViewport)
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
+	, SortKeyBuilder(InOwnerRenderer->GetMeshSortKeyBuilder())
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
+	// ID는 뷰마다 처음부터 다시 부여 (할당 주소와 무관한 그리기 순서)
+	SortKeyBuilder.Reset();
 
 	// 타일 라이트 컬러 초기화
 	TileLightCuller = std::make_unique<FTileLightCuller>();
@@ -306,18 +314,31 @@ void FSceneRenderer::RenderShadowMaps()
 	FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
-	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	// 2. 그림자 캐스터(Caster) 메시 수집 (카메라 밖의 메시도 그림자를 드리우므로 컬링 전 목록 사용)
+	// 캐스터별 배치는 한 번만 수집하고, 섀도우 뷰마다 라이트 절두체로 컬링해서 필요한 구간만 그린다
+	ShadowCasterBatches.Empty();
+	ShadowCasterRanges.Empty();
+	ShadowCasterBounds.Empty();
+	for (UMeshComponent* MeshComponent : Proxies.ShadowCasters)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			FShadowCasterRange Range;
+			Range.FirstBatch = ShadowCasterBatches.Num();
+			MeshComponent->CollectMeshBatches(ShadowCasterBatches, View);
+			Range.NumBatches = ShadowCasterBatches.Num() - Range.FirstBatch;
+			Range.bDynamic = Cast<USkinnedMeshComponent>(MeshComponent) != nullptr;
+			if (Range.NumBatches == 0)
+			{
+				continue;
+			}
+			ShadowCasterRanges.Add(Range);
+			ShadowCasterBounds.Add(MeshComponent->GetWorldAABB());
 		}
 	}
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
-	//if (ShadowMeshBatches.IsEmpty()) return;
+	//if (ShadowCasterBatches.IsEmpty()) return;
 
 	// 섀도우 맵을 DSV로 사용하기 전에 SRV 슬롯에서 해제
 	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
@@ -396,6 +417,12 @@ void FSceneRenderer::RenderShadowMaps()
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
+	FShadowStats ShadowStats = FShadowStatManager::GetInstance().GetStats();
+	ShadowStats.ShadowCasters = static_cast<uint32>(ShadowCasterRanges.Num());
+
+	TArray<FMeshBatchElement> RequestBatches;
+	RequestBatches.Reserve(ShadowCasterBatches.Num());
+
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) ---
 	{
 		ID3D11DepthStencilView* AtlasDSV2D = LightManager->GetShadowAtlasDSV2D();
@@ -406,8 +433,7 @@ void FSceneRenderer::RenderShadowMaps()
 		{
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
-			
-			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
+
 			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
 			switch (ShadowAAType)
 			{
@@ -417,7 +443,6 @@ void FSceneRenderer::RenderShadowMaps()
 			case EShadowAATechnique::VSM:
 				{
 					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
 					break;
 				}				
 			default:
@@ -425,8 +450,7 @@ void FSceneRenderer::RenderShadowMaps()
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
-
+			// NOTE: 캐시된 영역을 보존하기 위해 아틀라스 전체를 지우지 않고, 다시 그리는 영역만 ClearShadowAtlasRegion()으로 지운다
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
@@ -436,8 +460,30 @@ void FSceneRenderer::RenderShadowMaps()
 				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
 				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+				if (Request.Size > 0)
+				{
+					uint64 ContentHash = 0;
+					bool bCacheable = true;
+					uint32 NumCasters = 0;
+					GatherShadowViewBatches(Request, RequestBatches, ContentHash, bCacheable, NumCasters);
+
+					++ShadowStats.ShadowViews;
+					if (LightManager->IsShadowViewCached(Request, ContentHash))
+					{
+						// 라이트/캐스터가 그대로면 지난 프레임의 아틀라스 영역을 그대로 사용
+						++ShadowStats.CachedShadowViews;
+					}
+					else
+					{
+						// 영역 초기화 후 뎁스 패스 렌더링
+						ClearShadowAtlasRegion();
+						RenderShadowDepthPass(Request, RequestBatches);
+						LightManager->MarkShadowViewRendered(Request, ContentHash, bCacheable);
+
+						ShadowStats.ShadowCasterDraws += NumCasters;
+						ShadowStats.MaxCastersPerView = std::max(ShadowStats.MaxCastersPerView, NumCasters);
+					}
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -495,14 +541,32 @@ void FSceneRenderer::RenderShadowMaps()
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
+					uint64 ContentHash = 0;
+					bool bCacheable = true;
+					uint32 NumCasters = 0;
+					GatherShadowViewBatches(Request, RequestBatches, ContentHash, bCacheable, NumCasters);
+
+					++ShadowStats.ShadowViews;
+					if (LightManager->IsShadowViewCached(Request, ContentHash))
+					{
+						++ShadowStats.CachedShadowViews;
+						continue;
+					}
+
 					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
 					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					RenderShadowDepthPass(Request, RequestBatches);
+					LightManager->MarkShadowViewRendered(Request, ContentHash, bCacheable);
+
+					ShadowStats.ShadowCasterDraws += NumCasters;
+					ShadowStats.MaxCastersPerView = std::max(ShadowStats.MaxCastersPerView, NumCasters);
 				}
 			}
 		}
 	}
 
+	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+
 	// --- 3. RHI 상태 복구 ---
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
 	ID3D11RenderTargetView* nullRTV = nullptr;
@@ -515,7 +579,96 @@ void FSceneRenderer::RenderShadowMaps()
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::GatherShadowViewBatches(const FShadowRenderRequest& ShadowRequest, TArray<FMeshBatchElement>& OutBatches, uint64& OutContentHash, bool& bOutCacheable, uint32& OutNumCasters)
+{
+	OutBatches.Empty();
+	OutNumCasters = 0;
+	bOutCacheable = true;
+
+	// FNV-1a: 라이트 시점 + 그려지는 배치가 같으면 같은 섀도우 뷰로 본다
+	uint64 Hash = 14695981039346656037ull;
+	auto HashBytes = [&Hash](const void* Data, size_t Size)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Hash ^= Bytes[i];
+			Hash *= 1099511628211ull;
+		}
+	};
+
+	const FMatrix LightViewProj = ShadowRequest.ViewMatrix * ShadowRequest.ProjectionMatrix;
+	HashBytes(LightViewProj.M, sizeof(LightViewProj.M));
+	HashBytes(&ShadowRequest.WorldLocation, sizeof(ShadowRequest.WorldLocation));
+	HashBytes(&ShadowRequest.Radius, sizeof(ShadowRequest.Radius));
+	const EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
+	HashBytes(&ShadowAAType, sizeof(ShadowAAType));
+
+	// 라이트 절두체로 캐스터를 8개씩 AVX 컬링
+	const FFrustum LightFrustum = CreateFrustumFromViewProjection(LightViewProj);
+	const int32 NumCasters = ShadowCasterRanges.Num();
+	for (int32 Base = 0; Base < NumCasters; Base += 8)
+	{
+		const int32 Count = std::min(8, NumCasters - Base);
+		FAABB Bounds[8];
+		for (int32 i = 0; i < 8; ++i)
+		{
+			// 남는 칸은 마지막 유효 바운드로 채움 (결과는 무시)
+			Bounds[i] = ShadowCasterBounds[Base + std::min(i, Count - 1)];
+		}
+		const uint8 VisibleMask = AreAABBsVisible_8_AVX(LightFrustum, Bounds);
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FShadowCasterRange& Range = ShadowCasterRanges[Base + i];
+			// 스키닝 메시는 애니메이션으로 바운드를 벗어날 수 있으므로 항상 포함
+			if (!Range.bDynamic && (VisibleMask & (1u << i)) == 0)
+			{
+				continue;
+			}
+
+			if (Range.bDynamic)
+			{
+				bOutCacheable = false;
+			}
+
+			++OutNumCasters;
+			for (int32 BatchIndex = Range.FirstBatch; BatchIndex < Range.FirstBatch + Range.NumBatches; ++BatchIndex)
+			{
+				const FMeshBatchElement& Batch = ShadowCasterBatches[BatchIndex];
+				OutBatches.Add(Batch);
+
+				HashBytes(&Batch.VertexBuffer, sizeof(Batch.VertexBuffer));
+				HashBytes(&Batch.IndexBuffer, sizeof(Batch.IndexBuffer));
+				HashBytes(&Batch.StartIndex, sizeof(Batch.StartIndex));
+				HashBytes(&Batch.IndexCount, sizeof(Batch.IndexCount));
+				HashBytes(&Batch.BaseVertexIndex, sizeof(Batch.BaseVertexIndex));
+				HashBytes(Batch.WorldMatrix.M, sizeof(Batch.WorldMatrix.M));
+			}
+		}
+	}
+
+	OutContentHash = Hash;
+}
+
+void FSceneRenderer::ClearShadowAtlasRegion()
+{
+	UShader* ClearShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowRegionClear.hlsl");
+	if (!ClearShader || !ClearShader->GetVertexShader()) return;
+
+	// 깊이 1.0 쿼드를 현재 뷰포트(=아틀라스 영역)에 덮어써서 해당 영역만 초기화
+	const bool bVSM = World->GetRenderSettings().GetShadowAATechnique() == EShadowAATechnique::VSM;
+	RHIDevice->PrepareShader(ClearShader);
+	if (!bVSM)
+	{
+		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
+	}
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::AlwaysWrite);
+	RHIDevice->DrawFullScreenQuad();
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+}
+
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, TArray<FMeshBatchElement>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -555,7 +708,10 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	ViewProjBufferType ViewProjBuffer = ViewProjBufferType(ShadowRequest.ViewMatrix, ShadowRequest.ProjectionMatrix, WorldLocation, FMatrix::Identity());	// NOTE: 그림자 맵 셰이더에는 역행렬이 필요 없으므로 Identity를 전달함
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer));
 
-	// 4. (DrawMeshBatches와 유사하게) 배치 순회하며 그리기
+	// 4. 셰이더가 고정이므로 같은 지오메트리끼리만 모이도록 정렬 (IA 상태 변경 최소화)
+	SortKeyBuilder.SortMeshBatches(InShadowBatches, EMeshSortMode::GeometryOnly);
+
+	// 5. (DrawMeshBatches와 유사하게) 배치 순회하며 그리기
 	ID3D11Buffer* CurrentVertexBuffer = nullptr;
 	ID3D11Buffer* CurrentIndexBuffer = nullptr;
 	UINT CurrentVertexStride = 0;
@@ -674,9 +830,10 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
+	// 절두체 컬링 -> 오클루전 컬링 순으로 수행, 결과가 각 UPrimitiveComponent의 컬링 플래그에 기록됨
+	// NOTE: 데칼은 BVH로 대상 메시를 직접 찾으므로 컬링 결과와 무관하게 그려짐
+	PerformFrustumCulling();
+	PerformOcclusionCulling();
 
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawSkeletalMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
@@ -742,7 +899,11 @@ void FSceneRenderer::GatherVisibleProxies()
 
 						if (bShouldAdd)
 						{
-							Proxies.Meshes.Add(MeshComponent);
+							Proxies.ShadowCasters.Add(MeshComponent);
+							if (!MeshComponent->GetCulled())
+							{
+								Proxies.Meshes.Add(MeshComponent);
+							}
 						}
 					}
 					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
@@ -907,22 +1068,228 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	TIME_PROFILE(FrustumCulling)
+
+	PotentiallyVisibleComponents.clear();
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH)
+	{
+		return;
+	}
+
+	const FFrustum& ViewFrustum = View->ViewFrustum;
+
+	// 1. BVH에 등록된 모든 컴포넌트를 일단 컬링 상태로 표시
+	const TMap<UPrimitiveComponent*, FAABB>& TrackedBounds = BVH->GetComponentBounds();
+	for (const auto& Pair : TrackedBounds)
+	{
+		Pair.first->SetCulled(true);
+	}
+
+	// 2. BVH 절두체 쿼리를 통과한 컴포넌트만 다시 보이도록 표시
+	Partition->FrustumQuery(ViewFrustum, PotentiallyVisibleComponents);
+	for (UPrimitiveComponent* Component : PotentiallyVisibleComponents)
+	{
+		Component->SetCulled(false);
+	}
+
+	// 3. 아직 BVH에 반영되지 않은 더티 컴포넌트는 현재 월드 AABB로 직접 판정
+	//    (업데이트 budget에 밀려 BVH의 캐시된 바운드가 오래된 경우 잘못 컬링되는 것을 방지)
+	uint32 UntrackedCount = 0;
+	uint32 UntrackedVisibleCount = 0;
+	for (UPrimitiveComponent* Component : Partition->GetDirtyComponents())
+	{
+		if (!Component) continue;
+		const bool bVisible = IsAABBVisible(ViewFrustum, Component->GetWorldAABB());
+		Component->SetCulled(!bVisible);
+
+		if (TrackedBounds.find(Component) == TrackedBounds.end())
+		{
+			++UntrackedCount;
+			UntrackedVisibleCount += bVisible ? 1 : 0;
+		}
+	}
+
+	// 컬링 통계 업데이트
+	FCullingStats CullingStats;
+	CullingStats.TotalPrimitives = static_cast<uint32>(TrackedBounds.size()) + UntrackedCount;
+	CullingStats.VisiblePrimitives = UntrackedVisibleCount;
+	for (const auto& Pair : TrackedBounds)
+	{
+		CullingStats.VisiblePrimitives += Pair.first->GetCulled() ? 0 : 1;
+	}
+	CullingStats.FrustumCulled = CullingStats.TotalPrimitives - CullingStats.VisiblePrimitives;
+	FCullingStatManager::GetInstance().UpdateStats(CullingStats);
+}
+
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	TIME_PROFILE(OcclusionCulling)
+
+	if (!World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling))
+	{
+		return;
+	}
+	// 선형 깊이를 clip.w로 계산하므로 원근 투영에서만 수행
+	if (View->ProjectionMode != ECameraProjectionMode::Perspective)
+	{
+		return;
+	}
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH)
+	{
+		return;
+	}
+
+	// --- 튜닝 파라미터 ---
+	const int32 MaxOccluders = 32;				// 프레임당 오클루더 메시 수
+	const float MinOccluderScreenArea = 0.02f;	// 화면의 2% 이상을 덮는 메시만 오클루더 후보
+	const int32 MaxOccluderTriangles = 4096;	// 이보다 복잡한 메시는 래스터화 비용 때문에 제외
+
+	// 1. 절두체 컬링 결과(PotentiallyVisibleComponents + 더티 컴포넌트)만 후보로 수집 (컴포넌트/점수 목록은 프레임 아레나에서 할당)
+	const FMatrix ViewProj = View->ViewMatrix * View->ProjectionMatrix;
+	TArray<FCandidateDrawable> Candidates;
+	TFrameArray<UPrimitiveComponent*> CandidateComponents;
+
+	auto AddCandidate = [&](UPrimitiveComponent* Component, const FAABB& Bound)
+		{
+			if (!Component || Component->GetCulled() || Component->InternalIndex == UINT32_MAX)
+			{
+				return;
+			}
+			FCandidateDrawable Candidate;
+			Candidate.ActorIndex = Component->InternalIndex;
+			Candidate.SerialNumber = GUObjectSerialNumbers[Component->InternalIndex];
+			Candidate.Bound = Bound;
+			Candidate.WorldViewProj = ViewProj;	// 바운드가 이미 월드 공간
+			Candidate.WorldView = View->ViewMatrix;
+			Candidate.NearClip = View->NearClip;
+			Candidate.FarClip = View->FarClip;
+			Candidates.Add(Candidate);
+			CandidateComponents.Add(Component);
+		};
+
+	const TMap<UPrimitiveComponent*, FAABB>& TrackedBounds = BVH->GetComponentBounds();
+	const TSet<UPrimitiveComponent*>& DirtyComponents = Partition->GetDirtyComponents();
+	for (UPrimitiveComponent* Component : PotentiallyVisibleComponents)
+	{
+		// 더티 컴포넌트는 캐시된 바운드가 오래됐을 수 있으므로 아래에서 현재 바운드로 처리
+		if (DirtyComponents.find(Component) != DirtyComponents.end())
+		{
+			continue;
+		}
+		auto It = TrackedBounds.find(Component);
+		if (It != TrackedBounds.end())
+		{
+			AddCandidate(Component, It->second);
+		}
+	}
+	for (UPrimitiveComponent* Component : DirtyComponents)
+	{
+		if (Component)
+		{
+			AddCandidate(Component, Component->GetWorldAABB());
+		}
+	}
+
+	// 2. 오클루더 선택: 화면 점유 면적이 큰 스태틱 메시 상위 MaxOccluders개
+	TFrameArray<std::pair<float, int32>> OccluderScores;
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(CandidateComponents[i]);
+		UStaticMesh* StaticMesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+		FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!MeshAsset || MeshAsset->Indices.empty() || static_cast<int32>(MeshAsset->Indices.size() / 3) > MaxOccluderTriangles)
+		{
+			continue;
+		}
+
+		const float ScreenArea = FOcclusionCullingManagerCPU::ComputeScreenArea(Candidates[i]);
+		if (ScreenArea >= MinOccluderScreenArea)
+		{
+			OccluderScores.Add({ ScreenArea, i });
+		}
+	}
+
+	const int32 NumOccluders = std::min(MaxOccluders, OccluderScores.Num());
+	std::partial_sort(OccluderScores.begin(), OccluderScores.begin() + NumOccluders, OccluderScores.end(),
+		[](const std::pair<float, int32>& A, const std::pair<float, int32>& B) { return A.first > B.first; });
+
+	TArray<FOccluderMesh> Occluders;
+	Occluders.Reserve(NumOccluders);
+	TSet<int32> OccluderIndices;
+	for (int32 i = 0; i < NumOccluders; ++i)
+	{
+		const int32 CandidateIndex = OccluderScores[i].second;
+		UStaticMeshComponent* StaticMeshComponent = static_cast<UStaticMeshComponent*>(CandidateComponents[CandidateIndex]);
+		FStaticMesh* MeshAsset = StaticMeshComponent->GetStaticMesh()->GetStaticMeshAsset();
+
+		FOccluderMesh Occluder;
+		Occluder.Vertices = &MeshAsset->Vertices;
+		Occluder.Indices = &MeshAsset->Indices;
+		Occluder.WorldViewProj = StaticMeshComponent->GetWorldMatrix() * ViewProj;
+		Occluder.NearClip = View->NearClip;
+		Occluder.FarClip = View->FarClip;
+		Occluders.Add(Occluder);
+		OccluderIndices.insert(CandidateIndex);
+	}
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	FCullingStats CullingStats = FCullingStatManager::GetInstance().GetStats();
+	CullingStats.Occluders = static_cast<uint32>(Occluders.Num());
+	if (Occluders.IsEmpty())
+	{
+		FCullingStatManager::GetInstance().UpdateStats(CullingStats);
+		return;
+	}
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	// 3. 오클루더 삼각형 래스터화 -> HZB 구성 -> 나머지 후보 판정
+	//    히스테리시스 상태는 뷰포트별로 유지 (FViewport 주소를 키로 사용, 뷰포트 파괴 시 FViewport가 해제)
+	//    뷰포트 없는 프리뷰 렌더는 뷰 원점을 키로 사용 (포인터 값과 겹치지 않는 작은 정수)
+	const uint64 ViewKey = Viewport
+		? reinterpret_cast<uint64>(Viewport)
+		: (static_cast<uint64>(View->ViewRect.MinX) << 16) | View->ViewRect.MinY;
+	FOcclusionCullingManagerCPU* OcclusionCuller = World->GetOcclusionCuller(ViewKey);
+
+	CullingStats.OccluderTriangles = OcclusionCuller->BuildOccluderDepth(Occluders);
+	OcclusionCuller->BuildHZB();
+
+	TArray<FCandidateDrawable> Occludees;
+	TFrameArray<UPrimitiveComponent*> OccludeeComponents;
+	Occludees.Reserve(Candidates.Num());
+	OccludeeComponents.Reserve(Candidates.Num());
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		if (OccluderIndices.find(i) == OccluderIndices.end())
+		{
+			Occludees.Add(Candidates[i]);
+			OccludeeComponents.Add(CandidateComponents[i]);
+		}
+	}
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	const int32 GridW = OcclusionCuller->GetGrid().GetWidth();
+	const int32 GridH = OcclusionCuller->GetGrid().GetHeight();
+	TArray<uint8_t> VisibleFlags;
+	OcclusionCuller->TestOcclusion(Occludees, GridW, GridH, VisibleFlags);
+
+	uint32 OcclusionCulled = 0;
+	for (int32 i = 0; i < Occludees.Num(); ++i)
+	{
+		if (!VisibleFlags[Occludees[i].ActorIndex])
+		{
+			OccludeeComponents[i]->SetCulled(true);
+			++OcclusionCulled;
+		}
+	}
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	// 컬링 통계 업데이트 (절두체 컬링 결과에 오클루전 결과를 덧붙임)
+	CullingStats.OcclusionTested = static_cast<uint32>(Occludees.Num());
+	CullingStats.OcclusionCulled = OcclusionCulled;
+	CullingStats.VisiblePrimitives -= std::min(CullingStats.VisiblePrimitives, OcclusionCulled);
+	FCullingStatManager::GetInstance().UpdateStats(CullingStats);
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
@@ -946,7 +1313,8 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	// 상태 순으로 모으고, 같은 지오메트리 안에서는 가까운 것부터 (인스턴스 순서도 앞에서 뒤로)
+	SortKeyBuilder.SortMeshBatches(MeshBatchElements, EMeshSortMode::FrontToBack, View->ViewLocation, View->ViewRotation.GetForwardVector());
 
 	// --- 3. 그리기 (Draw) ---
 	DrawMeshBatches(MeshBatchElements, true);
@@ -997,7 +1365,7 @@ void FSceneRenderer::RenderDecalPass()
 		}
 
 		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		TFrameArray<UPrimitiveComponent*> TargetPrimitives;
 
 		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
 		const FOBB DecalOBB = Decal->GetWorldOBB();
@@ -1041,7 +1409,12 @@ void FSceneRenderer::RenderDecalPass()
 			BatchElement.VertexShader = ShaderVariant->VertexShader;
 			BatchElement.PixelShader = ShaderVariant->PixelShader;
 			BatchElement.VertexStride = sizeof(FVertexDynamic);
+			// 데칼 셰이더는 인스턴싱 변형이 없으므로 메시의 인스턴싱 셰이더를 쓰지 않게 한다
+			BatchElement.InstancedVertexShader = nullptr;
+			BatchElement.InstancedPixelShader = nullptr;
+			BatchElement.InstancedInputLayout = nullptr;
 		}
+		SortKeyBuilder.SortMeshBatches(MeshBatchElements, EMeshSortMode::StateOnly);
 		DrawMeshBatches(MeshBatchElements, true);
 
 		// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
@@ -1349,9 +1722,57 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
 	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
 
+	// 인스턴싱 구간 탐색: 정렬 후 인스턴스 데이터만 다른 배치가 연속되면 DrawIndexedInstanced 한 번으로 묶는다
+	const int32 NumBatches = InMeshBatches.Num();
+	InstancedRuns.clear();
+	InstanceDataScratch.clear();
+	for (int32 RunStart = 0; RunStart < NumBatches;)
+	{
+		const FMeshBatchElement& First = InMeshBatches[RunStart];
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < NumBatches && First.CanInstanceWith(InMeshBatches[RunEnd]))
+		{
+			++RunEnd;
+		}
+
+		if (RunEnd - RunStart >= 2 && First.VertexShader && First.PixelShader && First.VertexBuffer && First.IndexBuffer && First.VertexStride != 0)
+		{
+			InstancedRuns.Add({ RunStart, RunEnd - RunStart, static_cast<uint32>(InstanceDataScratch.Num()) });
+			for (int32 i = RunStart; i < RunEnd; ++i)
+			{
+				const FMeshBatchElement& Instance = InMeshBatches[i];
+				FInstanceData& Data = InstanceDataScratch.emplace_back();
+				Data.World = Instance.WorldMatrix;
+				Data.WorldInverseTranspose = Instance.WorldMatrix.InverseAffine().Transpose();
+				Data.Color = Instance.InstanceColor;
+				Data.ObjectID = Instance.ObjectID;
+			}
+		}
+		RunStart = RunEnd;
+	}
+
+	// 인스턴스 데이터는 호출당 한 번만 업로드 (t12, VS)
+	if (!InstancedRuns.IsEmpty())
+	{
+		ID3D11ShaderResourceView* InstanceSRV = OwnerRenderer->UploadInstanceData(InstanceDataScratch);
+		if (InstanceSRV)
+		{
+			RHIDevice->GetDeviceContext()->VSSetShaderResources(12, 1, &InstanceSRV);
+		}
+		else
+		{
+			InstancedRuns.clear();
+		}
+	}
+
+	FDrawCallStats DrawStats;
+	int32 NextRun = 0;
+
 	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
 	{
+		const FMeshBatchElement& Batch = InMeshBatches[BatchIndex];
+
 		// --- 필수 요소 유효성 검사 ---
 		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
 		{
@@ -1360,16 +1781,22 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			continue;
 		}
 
+		// 이 배치가 인스턴싱 구간의 시작이면 구간 전체를 인스턴싱 변형 셰이더로 한 번에 그린다
+		const FInstancedBatchRun* Run = (NextRun < InstancedRuns.Num() && InstancedRuns[NextRun].FirstBatch == BatchIndex) ? &InstancedRuns[NextRun] : nullptr;
+		ID3D11VertexShader* VertexShader = Run ? Batch.InstancedVertexShader : Batch.VertexShader;
+		ID3D11PixelShader* PixelShader = Run ? Batch.InstancedPixelShader : Batch.PixelShader;
+		ID3D11InputLayout* InputLayout = Run ? Batch.InstancedInputLayout : Batch.InputLayout;
+
 		// 1. 셰이더 상태 변경
-		if (Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
+		if (VertexShader != CurrentVertexShader || PixelShader != CurrentPixelShader)
 		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(Batch.InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(Batch.VertexShader, nullptr, 0);
+			RHIDevice->GetDeviceContext()->IASetInputLayout(InputLayout);
+			RHIDevice->GetDeviceContext()->VSSetShader(VertexShader, nullptr, 0);
 
-			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
+			RHIDevice->GetDeviceContext()->PSSetShader(PixelShader, nullptr, 0);
 
-			CurrentVertexShader = Batch.VertexShader;
-			CurrentPixelShader = Batch.PixelShader;
+			CurrentVertexShader = VertexShader;
+			CurrentPixelShader = PixelShader;
 		}
 
 		// --- 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (캐싱됨) ---
@@ -1465,14 +1892,37 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			CurrentTopology = Batch.PrimitiveTopology;
 		}
 
+		if (Run)
+		{
+			// 4. 인스턴스 데이터는 t12에 이미 올라가 있으므로 구간 시작 위치만 설정
+			RHIDevice->SetAndUpdateConstantBuffer(FInstancingBufferType{ Run->InstanceOffset });
+
+			// 5. 구간 전체를 한 번에 그리고 나머지 배치는 건너뜀
+			RHIDevice->GetDeviceContext()->DrawIndexedInstanced(Batch.IndexCount, Run->NumBatches, Batch.StartIndex, Batch.BaseVertexIndex, 0);
+
+			DrawStats.MeshBatches += Run->NumBatches;
+			DrawStats.InstancedBatches += Run->NumBatches;
+			++DrawStats.InstancedDrawCalls;
+			++DrawStats.DrawCalls;
+
+			BatchIndex += Run->NumBatches - 1;
+			++NextRun;
+			continue;
+		}
+
 		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경)
 		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
 		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
 
 		// 5. 드로우 콜 실행
 		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+
+		++DrawStats.MeshBatches;
+		++DrawStats.DrawCalls;
 	}
 
+	FDrawCallStatManager::GetInstance().AddStats(DrawStats);
+
 	// 루프 종료 후 리스트 비우기 (옵션)
 	if (bClearListAfterDraw)
 	{
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "MeshSortKey.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -36,6 +37,7 @@ struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
 	TArray<UMeshComponent*> Meshes;
+	TArray<UMeshComponent*> ShadowCasters;	// 카메라 절두체와 무관하게 그림자를 드리울 수 있는 메시
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
@@ -48,6 +50,22 @@ struct FVisibleRenderProxySet
 	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
 };
 
+// 섀도우 캐스터 하나가 ShadowCasterBatches에서 차지하는 구간
+struct FShadowCasterRange
+{
+	int32 FirstBatch = 0;
+	int32 NumBatches = 0;
+	bool bDynamic = false;	// 스키닝처럼 트랜스폼과 무관하게 모양이 바뀌는 캐스터 (섀도우 뷰 캐시 불가)
+};
+
+// DrawMeshBatches에서 DrawIndexedInstanced 한 번으로 합쳐지는 연속 배치 구간
+struct FInstancedBatchRun
+{
+	int32 FirstBatch = 0;
+	int32 NumBatches = 0;
+	uint32 InstanceOffset = 0;	// 인스턴스 버퍼(t12)에서 첫 인스턴스 위치
+};
+
 struct FSceneLocals
 {
 	TArray<UPointLightComponent*> PointLights;
@@ -70,7 +88,7 @@ struct FSceneGlobals
 class FSceneRenderer
 {
 public:
-	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer);
+	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FViewport* InViewport = nullptr);
 	~FSceneRenderer();
 
 	/** @brief 이 씬 렌더러의 모든 렌더링 파이프라인을 실행합니다. */
@@ -89,7 +107,13 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, TArray<FMeshBatchElement>& InShadowBatches);
+
+	/** @brief 섀도우 뷰의 라이트 절두체로 캐스터를 컬링해 그릴 배치를 모으고, 캐시 판정용 내용 해시를 계산합니다. */
+	void GatherShadowViewBatches(const FShadowRenderRequest& ShadowRequest, TArray<FMeshBatchElement>& OutBatches, uint64& OutContentHash, bool& bOutCacheable, uint32& OutNumCasters);
+
+	/** @brief 현재 뷰포트로 설정된 섀도우 아틀라스 영역만 초기화합니다. (캐시된 다른 영역 보존) */
+	void ClearShadowAtlasRegion();
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -97,9 +121,12 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 파티션 BVH로 프리미티브 컴포넌트 단위 절두체 컬링을 수행하고 컬링 플래그를 갱신합니다. */
 	void PerformFrustumCulling();
 
+	/** @brief 절두체 컬링을 통과한 컴포넌트를 CPU HZB로 오클루전 컬링하고 컬링 플래그를 갱신합니다. */
+	void PerformOcclusionCulling();
+
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
@@ -134,6 +161,7 @@ private:
 	// --- 렌더링 컨텍스트 (외부에서 주입받음) ---
 	UWorld* World;
 	FSceneView* View;
+	FViewport* Viewport;	// 프리뷰 렌더처럼 뷰포트 없이 그릴 때는 nullptr
 	URenderer* OwnerRenderer;
 	D3D11RHI* RHIDevice;
 
@@ -146,12 +174,24 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
+	// 절두체 컬링을 통과한 컴포넌트 목록 (BVH 쿼리 결과)
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
+	// 배치 정렬 키 생성기 (URenderer 소유, 생성자에서 ID 테이블을 비워 이 뷰를 그리는 동안만 유지)
+	FMeshSortKeyBuilder& SortKeyBuilder;
+
+	// DrawMeshBatches 인스턴싱 구간과 업로드할 인스턴스 데이터 (호출마다 재사용)
+	TArray<FInstancedBatchRun> InstancedRuns;
+	TArray<FInstanceData> InstanceDataScratch;
+
+	// 섀도우 캐스터 배치 (캐스터별로 한 번만 수집, 섀도우 뷰마다 컬링해서 재사용)
+	TArray<FMeshBatchElement> ShadowCasterBatches;
+	TArray<FShadowCasterRange> ShadowCasterRanges;
+	TArray<FAABB> ShadowCasterBounds;
+
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
 
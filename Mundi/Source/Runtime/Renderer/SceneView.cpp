@@ -3,6 +3,7 @@
 #include "CameraActor.h"
 #include "FViewport.h"
 #include "Frustum.h"
+#include "Shader.h"
 
 FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings)
 	: RenderSettings(InRenderSettings)
@@ -40,7 +41,11 @@ FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InR
 		InMinimalViewInfo->ProjectionMode
 	);
 
+	// --- 4. 절두체 계산 (컬링용) ---
+	ViewFrustum = CreateFrustumFromViewProjection(ViewMatrix * ProjectionMatrix);
+
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderMacroKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings)
@@ -62,7 +67,7 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 
 	ViewMatrix = InCamera->GetViewMatrix();
 	ProjectionMatrix = InCamera->GetProjectionMatrix(AspectRatio, InViewport);
-	//ViewFrustum = CreateFrustumFromCamera(*InCamera, AspectRatio);
+	ViewFrustum = CreateFrustumFromViewProjection(ViewMatrix * ProjectionMatrix);
 	ViewLocation = InCamera->GetWorldLocation();
 	ViewRotation = InCamera->GetWorldRotation();
 	NearClip = InCamera->GetNearClip();
@@ -78,6 +83,7 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 	ProjectionMode = InCamera->GetProjectionMode();
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderMacroKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
@@ -68,6 +68,7 @@ public:
     // 렌더링 설정
     ECameraProjectionMode ProjectionMode = ECameraProjectionMode::Perspective;
     TArray<FShaderMacro> ViewShaderMacros;
+    uint64 ViewShaderMacroKey = 0;   // ViewShaderMacros의 해시 (메시 배치 캐시가 뷰 모드 변경을 감지하는 데 사용)
     float NearClip = 0.0f;
     float FarClip = 0.0f;
     float FieldOfView = 0.0f;
@@ -4,6 +4,8 @@
 
 IMPLEMENT_CLASS(UShader)
 
+uint32 GShaderVariantGeneration = 0;
+
 // 컴파일 로직을 처리하는 비공개 헬퍼 함수
 static bool CompileShaderInternal(
 	const FWideString& InFilePath,
@@ -336,7 +338,7 @@ void UShader::ReleaseResources()
 	{
 		Pair.second.Release(); // FShaderVariant::Release() 호출
 	}
-	ShaderVariantMap.Empty();
+	ShaderVariantMap.Empty();	++GShaderVariantGeneration;
 }
 
 bool UShader::IsOutdated() const
@@ -416,6 +418,9 @@ bool UShader::Reload(ID3D11Device* InDevice)
 	// (ShaderVariantMap은 이제 비어있습니다)
 	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
 
+	// 변형 리소스가 새로 만들어지므로 캐시된 변형 포인터를 모두 다시 조회하게 함
+	++GShaderVariantGeneration;
+
 	bool bAllReloadsSuccessful = true;
 
 	// 3. [재시도] Old 맵에 있던 모든 Variant에 대해 Load를 다시 호출합니다.
@@ -498,6 +503,7 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 {
 	// 이미 파싱된 파일 목록 초기화
 	IncludedFiles.clear();
+	bSupportsInstancing = false;
 
 	// 파싱할 파일 큐
 	TArray<FString> FilesToParse;
@@ -546,6 +552,12 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 			}
 			Line = Line.substr(FirstNonSpace);
 
+			// 인스턴싱 변형 분기 (#if USE_INSTANCING) 제공 여부
+			if (Line.find("USE_INSTANCING") != FString::npos)
+			{
+				bSupportsInstancing = true;
+			}
+
 			// #include 지시문 찾기
 			if (Line.compare(0, 8, "#include") == 0)
 			{
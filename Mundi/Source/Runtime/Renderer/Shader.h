@@ -37,6 +37,10 @@ struct FShaderVariant
 	}
 };
 
+// 셰이더 변형이 다시 만들어지거나(핫 리로드, 해제) 머티리얼의 셰이더/매크로가 바뀔 때마다 증가합니다.
+// 변형을 캐시하는 쪽(UMeshComponent의 배치 캐시)은 이 값이 바뀌면 변형을 다시 조회합니다.
+extern uint32 GShaderVariantGeneration;
+
 class UShader : public UResourceBase
 {
 public:
@@ -54,6 +58,9 @@ public:
 	ID3D11VertexShader* GetVertexShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11PixelShader* GetPixelShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
+	// 소스(또는 include)에서 USE_INSTANCING 분기를 제공하는지 여부 (DrawMeshBatches 인스턴싱 대상)
+	bool SupportsInstancing() const { return bSupportsInstancing; }
+
 	// Hot Reload Support
 	bool IsOutdated() const;
 	bool Reload(ID3D11Device* InDevice);
@@ -70,6 +77,9 @@ private:
 	TArray<FString> IncludedFiles;
 	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
 
+	// ParseIncludeFiles에서 소스를 훑을 때 함께 판정
+	bool bSupportsInstancing = false;
+
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
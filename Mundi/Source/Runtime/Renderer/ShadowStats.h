@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 #include "UEContainer.h"
 
 // 섀도우 통계 구조체
@@ -21,6 +21,13 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 섀도우 뷰(요청)별 캐스터 컬링 / 캐시
+	uint32 ShadowViews = 0;               // 이번 프레임 섀도우 뷰 수 (CSM 캐스케이드, 스팟, 포인트 6면 각각)
+	uint32 CachedShadowViews = 0;         // 아틀라스 영역을 재사용해 다시 그리지 않은 뷰 수
+	uint32 ShadowCasters = 0;             // 컬링 전 캐스터 후보 수
+	uint32 ShadowCasterDraws = 0;         // 실제로 그린 뷰들의 캐스터 수 합계
+	uint32 MaxCastersPerView = 0;         // 한 뷰에서 그린 최대 캐스터 수
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +41,18 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		ShadowViews = 0;
+		CachedShadowViews = 0;
+		ShadowCasters = 0;
+		ShadowCasterDraws = 0;
+		MaxCastersPerView = 0;
+	}
+
+	// 다시 그린 뷰당 평균 캐스터 수
+	float GetAverageCastersPerView() const
+	{
+		const uint32 RenderedViews = ShadowViews - CachedShadowViews;
+		return RenderedViews > 0 ? static_cast<float>(ShadowCasterDraws) / static_cast<float>(RenderedViews) : 0.0f;
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
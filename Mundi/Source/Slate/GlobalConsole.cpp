@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
@@ -46,6 +47,10 @@ void UGlobalConsole::Log(const char* fmt, ...)
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
 #ifdef _EDITOR
+    // 프리로드 워커 스레드에서도 로그를 남기므로 직렬화
+    static std::mutex LogMutex;
+    std::lock_guard<std::mutex> Lock(LogMutex);
+
     if (ConsoleWidget)
     {
         ConsoleWidget->VAddLog(fmt, args);
@@ -13,6 +13,9 @@
 #include "TileCullingStats.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "CullingStats.h"
+#include "DrawCallStats.h"
+#include "PIEStats.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -98,7 +101,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowCulling && !bShowDrawCall && !bShowPIE) || !SwapChain)
 		return;
 
 	ID2D1Factory1* D2dFactory = nullptr;
@@ -223,18 +226,25 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		const double ToMb = 1.0 / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) * ToMb;
+		double PeakMb = static_cast<double>(FMemoryManager::GetPeakAllocationBytes()) * ToMb;
+		double ReservedMb = static_cast<double>(FMemoryManager::GetReservedBytes()) * ToMb;
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"Memory: %.1f MB (Peak %.1f)\nAllocs: %llu\nReserved: %.1f MB\nFragmentation: %.1f%%",
+			Mb, PeakMb, static_cast<unsigned long long>(FMemoryManager::GetTotalAllocationCount()), ReservedMb,
+			FMemoryManager::GetFragmentation() * 100.0);
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelWidth = 260.0f;
+		const float MemoryPanelHeight = 96.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + MemoryPanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, Dwrite, Buf, Rc, 16.0f,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -336,7 +346,7 @@ void UStatsOverlayD2D::Draw()
 
 		// 2. 출력할 문자열 버퍼를 만듭니다.
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\n\nViews: %u (Cached %u)\nCasters: %u\nCasters/View: %.1f (Max %u)",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -348,10 +358,15 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
+			ShadowStats.TotalShadowMemoryMB,
+			ShadowStats.ShadowViews,
+			ShadowStats.CachedShadowViews,
+			ShadowStats.ShadowCasters,
+			ShadowStats.GetAverageCastersPerView(),
+			ShadowStats.MaxCastersPerView);
 
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-		const float shadowPanelHeight = 260.0f;
+		const float shadowPanelHeight = 340.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 한색(Magenta)으로 설정합니다.
@@ -373,6 +388,117 @@ void UStatsOverlayD2D::Draw()
 
 		NextY += shadowPanelHeight + Space;
 	}
+
+	if (bShowCulling)
+	{
+		// 1. FCullingStatManager로부터 통계 데이터를 가져옵니다.
+		const FCullingStats& CullingStats = FCullingStatManager::GetInstance().GetStats();
+
+		// 2. 출력할 문자열 버퍼를 만듭니다.
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"[Culling Stats]\nPrimitives: %u\nVisible: %u\nFrustum Culled: %u (%.1f%%)\nOccluders: %u (%u tris)\nOcclusion Culled: %u / %u (%.1f%%)",
+			CullingStats.TotalPrimitives,
+			CullingStats.VisiblePrimitives,
+			CullingStats.FrustumCulled,
+			CullingStats.GetCulledRatio(),
+			CullingStats.Occluders,
+			CullingStats.OccluderTriangles,
+			CullingStats.OcclusionCulled,
+			CullingStats.OcclusionTested,
+			CullingStats.GetOcclusionCulledRatio());
+
+		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
+		const float cullingPanelHeight = 140.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + cullingPanelHeight);
+
+		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 하늘색(LightSkyBlue)으로 설정합니다.
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightSkyBlue));
+
+		NextY += cullingPanelHeight + Space;
+
+		rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + 40);
+		DrawTextBlock(
+			D2dCtx, Dwrite, FScopeCycleCounter::GetTimeProfile("FrustumCulling").GetConstWChar_tWithKey("FrustumCulling"), rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightSkyBlue));
+
+		NextY += 40 + Space;
+
+		rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + 40);
+		DrawTextBlock(
+			D2dCtx, Dwrite, FScopeCycleCounter::GetTimeProfile("OcclusionCulling").GetConstWChar_tWithKey("OcclusionCulling"), rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightSkyBlue));
+
+		NextY += 40 + Space;
+	}
+
+	if (bShowDrawCall)
+	{
+		// 1. FDrawCallStatManager로부터 이번 프레임 누적 통계를 가져옵니다.
+		const FDrawCallStats& DrawStats = FDrawCallStatManager::GetInstance().GetStats();
+
+		// 2. 출력할 문자열 버퍼를 만듭니다.
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"[Draw Call Stats]\nMesh Batches: %u\nDraw Calls: %u\nInstanced: %u draws / %u batches (avg %.1f)\nSaved: %u",
+			DrawStats.MeshBatches,
+			DrawStats.DrawCalls,
+			DrawStats.InstancedDrawCalls,
+			DrawStats.InstancedBatches,
+			DrawStats.GetAverageInstances(),
+			DrawStats.GetSavedDrawCalls());
+
+		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
+		const float drawCallPanelHeight = 110.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + drawCallPanelHeight);
+
+		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 연두색(GreenYellow)으로 설정합니다.
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::GreenYellow));
+
+		NextY += drawCallPanelHeight + Space;
+
+		rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + 40);
+		DrawTextBlock(
+			D2dCtx, Dwrite, FScopeCycleCounter::GetTimeProfile("MeshSort").GetConstWChar_tWithKey("MeshSort"), rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::GreenYellow));
+
+		NextY += 40 + Space;
+	}
+
+	if (bShowPIE)
+	{
+		// 1. FPIEStatManager로부터 마지막 PIE 시작 통계를 가져옵니다.
+		const FPIEStats& PIEStats = FPIEStatManager::GetInstance().GetStats();
+
+		// 2. 출력할 문자열 버퍼를 만듭니다.
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"[PIE Stats]\nEnter: %.2f ms\nActors: %u (%u objects)\nDuplicate: %.2f ms\nRegister: %.2f ms\nBeginPlay: %.2f ms",
+			PIEStats.TotalMs,
+			PIEStats.NumActors,
+			PIEStats.NumObjects,
+			PIEStats.DuplicateMs,
+			PIEStats.RegisterMs,
+			PIEStats.BeginPlayMs);
+
+		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
+		const float piePanelHeight = 130.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + piePanelHeight);
+
+		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 주황색(Orange)으로 설정합니다.
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Orange));
+
+		NextY += piePanelHeight + Space;
+	}
 	
 	D2dCtx->EndDraw();
 	D2dCtx->SetTarget(nullptr);
@@ -458,3 +584,33 @@ void UStatsOverlayD2D::ToggleShadow()
 {
 	bShowShadow = !bShowShadow;
 }
+
+void UStatsOverlayD2D::SetShowCulling(bool b)
+{
+	bShowCulling = b;
+}
+
+void UStatsOverlayD2D::ToggleCulling()
+{
+	bShowCulling = !bShowCulling;
+}
+
+void UStatsOverlayD2D::SetShowDrawCall(bool b)
+{
+	bShowDrawCall = b;
+}
+
+void UStatsOverlayD2D::ToggleDrawCall()
+{
+	bShowDrawCall = !bShowDrawCall;
+}
+
+void UStatsOverlayD2D::SetShowPIE(bool b)
+{
+	bShowPIE = b;
+}
+
+void UStatsOverlayD2D::TogglePIE()
+{
+	bShowPIE = !bShowPIE;
+}
@@ -19,6 +19,9 @@ public:
     void SetShowTileCulling(bool b);
     void SetShowLights(bool b);
     void SetShowShadow(bool b);
+    void SetShowCulling(bool b);
+    void SetShowDrawCall(bool b);
+    void SetShowPIE(bool b);
     void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
@@ -26,6 +29,9 @@ public:
     void ToggleTileCulling();
     void ToggleLights();
     void ToggleShadow();
+    void ToggleCulling();
+    void ToggleDrawCall();
+    void TogglePIE();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -33,6 +39,9 @@ public:
     bool IsTileCullingVisible() const { return bShowTileCulling; }
     bool IsLightsVisible() const { return bShowLights; }
     bool IsShadowVisible() const { return bShowShadow; }
+    bool IsCullingVisible() const { return bShowCulling; }
+    bool IsDrawCallVisible() const { return bShowDrawCall; }
+    bool IsPIEVisible() const { return bShowPIE; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -52,6 +61,9 @@ private:
     bool bShowTileCulling = false;
     bool bShowShadow = false;
     bool bShowLights = false;
+    bool bShowCulling = false;
+    bool bShowDrawCall = false;
+    bool bShowPIE = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
@@ -4,6 +4,7 @@
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
 #include "USlateManager.h"
+#include "DevBenchmarks.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -52,6 +53,19 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("MEMORY REPORT");
+#if MUNDI_DEV_BENCHMARKS
+	HelpCommandList.Add("BVH BENCH");
+	HelpCommandList.Add("SKINNING TEST");
+	HelpCommandList.Add("CACHE BENCH");
+	HelpCommandList.Add("OBJ BENCH");
+	HelpCommandList.Add("TICK BENCH");
+	HelpCommandList.Add("OBJECT BENCH");
+	HelpCommandList.Add("PREFAB BENCH");
+	HelpCommandList.Add("POOL TEST");
+	HelpCommandList.Add("JSON BENCH");
+	HelpCommandList.Add("BINARY BENCH");
+#endif
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -353,6 +367,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT DECAL");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
+		AddLog("- STAT CULLING");
+		AddLog("- STAT DRAWCALL");
+		AddLog("- STAT PIE");
 		AddLog("- STAT NONE");
 	}
 	else if (Stricmp(command_line, "STAT FPS") == 0)
@@ -380,6 +397,89 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleTileCulling();
 		AddLog("STAT LIGHT TOGGLED");
 	}
+	else if (Stricmp(command_line, "MEMORY REPORT") == 0)
+	{
+		// 크기 버킷별 사용량/단편화와 최대치 기준 상위 UClass 출력
+		FMemoryManager::LogReport();
+	}
+#if MUNDI_DEV_BENCHMARKS
+	else if (Stricmp(command_line, "BVH BENCH") == 0)
+	{
+		// 파티션 BVH 리빌드/리핏 비교 (결과는 콘솔 로그로 출력)
+		AddLog("Running BVH rebuild/refit benchmark...");
+		DevBenchmarks::RunBvhRefitBenchmark(10000, 300, 60);
+		DevBenchmarks::RunBvhRefitBenchmark(100000, 300, 60);
+	}
+	else if (Stricmp(command_line, "SKINNING TEST") == 0)
+	{
+		// CPU 스키닝 SIMD/병렬 커널을 스칼라 결과와 비교 (결과는 콘솔 로그로 출력)
+		AddLog("Running CPU skinning kernel test...");
+		DevBenchmarks::RunSkinningSelfTest(30000, 80, 20);
+	}
+	else if (Stricmp(command_line, "CACHE BENCH") == 0)
+	{
+		// 메시 캐시 전체를 스트림 리더 / 매핑 리더로 읽어서 Cold/Warm 로드 시간 비교
+		AddLog("Running mesh cache load benchmark...");
+		DevBenchmarks::RunMeshCacheLoadBenchmark(5);
+	}
+	else if (Stricmp(command_line, "OBJ BENCH") == 0)
+	{
+		// 기존 stringstream 파서와 버퍼 기반 파서의 속도 및 FObjInfo 일치 여부 비교
+		AddLog("Running OBJ parser benchmark...");
+		DevBenchmarks::RunObjParserBenchmark();
+	}
+	else if (Stricmp(command_line, "TICK BENCH") == 0)
+	{
+		// 이동 컴포넌트 틱을 메인 스레드 직렬 / 작업 시스템 병렬로 돌려 시간과 결과 트랜스폼 비교
+		AddLog("Running parallel tick benchmark...");
+		DevBenchmarks::RunTickBenchmark(10000, 60);
+	}
+	else if (Stricmp(command_line, "OBJECT BENCH") == 0)
+	{
+		// GUObjectArray 슬롯 할당/O(1) 삭제/약한 포인터 무효화 확인 (10만 개)
+		AddLog("Running object array benchmark...");
+		DevBenchmarks::RunObjectBenchmark(100000);
+	}
+	else if (Stricmp(command_line, "PREFAB BENCH") == 0)
+	{
+		// Data/Prefabs의 첫 번째 프리팹으로 파일 로드 스폰과 아키타입 복제 스폰 비교
+		AddLog("Running prefab spawn benchmark...");
+		DevBenchmarks::RunPrefabSpawnBenchmark(1000);
+	}
+	else if (Stricmp(command_line, "POOL TEST") == 0)
+	{
+		// 발사체 액터 반납/재사용 후 이동·표시 상태 복원 확인
+		AddLog("Running actor pool reuse test...");
+		DevBenchmarks::RunActorPoolSelfTest();
+	}
+	else if (Stricmp(command_line, "JSON BENCH") == 0)
+	{
+		// 5만 액터 레벨로 json::JSON::Load와 FJsonDocument 파싱 시간/메모리, 전체 레벨 로드 시간 비교
+		AddLog("Running JSON parse benchmark...");
+		DevBenchmarks::RunJsonParseBenchmark(50000);
+	}
+	else if (Stricmp(command_line, "BINARY BENCH") == 0)
+	{
+		// 2만 액터 레벨의 JSON/바이너리 저장·로드 시간과 파일 크기 비교
+		AddLog("Running binary level format benchmark...");
+		DevBenchmarks::RunBinaryLevelBenchmark(20000);
+	}
+#endif
+	else if (Stricmp(command_line, "STAT CULLING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleCulling();
+		AddLog("STAT CULLING TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT DRAWCALL") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleDrawCall();
+		AddLog("STAT DRAWCALL TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT PIE") == 0)
+	{
+		UStatsOverlayD2D::Get().TogglePIE();
+		AddLog("STAT PIE TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -387,6 +487,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowPicking(true);
 		UStatsOverlayD2D::Get().SetShowDecal(true);
 		UStatsOverlayD2D::Get().SetShowTileCulling(true);
+		UStatsOverlayD2D::Get().SetShowCulling(true);
+		UStatsOverlayD2D::Get().SetShowDrawCall(true);
+		UStatsOverlayD2D::Get().SetShowPIE(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
@@ -396,6 +499,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowPicking(false);
 		UStatsOverlayD2D::Get().SetShowDecal(false);
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
+		UStatsOverlayD2D::Get().SetShowCulling(false);
+		UStatsOverlayD2D::Get().SetShowDrawCall(false);
+		UStatsOverlayD2D::Get().SetShowPIE(false);
 		AddLog("STAT: OFF");
 	}
 	else
@@ -206,8 +206,16 @@ void UMainToolbarWidget::RenderSceneButtons()
         {
             PendingCommand = EToolbarCommand::SaveScene;
         }
+        if (ImGui::BeginPopupContextItem("##SaveBtnContext"))
+        {
+            if (ImGui::MenuItem("JSON으로 내보내기...", "Ctrl+Shift+S"))
+            {
+                PendingCommand = EToolbarCommand::ExportSceneJson;
+            }
+            ImGui::EndPopup();
+        }
         if (ImGui::IsItemHovered())
-            ImGui::SetTooltip("현재 씬을 저장합니다 [Ctrl+S]");
+            ImGui::SetTooltip("현재 씬을 저장합니다 [Ctrl+S]\n우클릭: JSON으로 내보내기 [Ctrl+Shift+S]");
     }
 
     ImGui::SameLine();
@@ -590,9 +598,7 @@ void UMainToolbarWidget::OnSaveScene()
             return;
         }
 
-        JSON LevelJson;
-        CurrentWorld->GetLevel()->Serialize(false, LevelJson);
-        bool bSuccess = FJsonSerializer::SaveJsonToFile(LevelJson, SelectedPath);
+        bool bSuccess = ULevelService::SaveLevelToFile(CurrentWorld->GetLevel(), SelectedPath);
 
         if (bSuccess)
         {
@@ -610,6 +616,47 @@ void UMainToolbarWidget::OnSaveScene()
     }
 }
 
+void UMainToolbarWidget::OnExportSceneJson()
+{
+    const FWideString BaseDir = UTF8ToWide(GDataDir) + L"/Scenes";
+    const FWideString Extension = L".json";
+    const FWideString Description = L"Scene JSON Files";
+    FWideString DefaultFileName = L"NewScene";
+
+    if (EditorINI.Contains("LastUsedLevel"))
+    {
+        std::filesystem::path LastUsedPath(UTF8ToWide(EditorINI["LastUsedLevel"]));
+        DefaultFileName = LastUsedPath.stem().wstring();
+    }
+
+    std::filesystem::path SelectedPath = FPlatformProcess::OpenSaveFileDialog(BaseDir, Extension, Description, DefaultFileName);
+    if (SelectedPath.empty())
+        return;
+
+    try
+    {
+        UWorld* CurrentWorld = GWorld;
+        if (!CurrentWorld)
+        {
+            UE_LOG("MainToolbar: Cannot find World!");
+            return;
+        }
+
+        if (ULevelService::ExportLevelToJson(CurrentWorld->GetLevel(), SelectedPath))
+        {
+            UE_LOG("MainToolbar: Scene exported: %s", SelectedPath.generic_u8string().c_str());
+        }
+        else
+        {
+            UE_LOG("[error] MainToolbar: Scene export failed: %s", SelectedPath.generic_u8string().c_str());
+        }
+    }
+    catch (const std::exception& Exception)
+    {
+        UE_LOG("[error] MainToolbar: Export Error: %s", Exception.what());
+    }
+}
+
 void UMainToolbarWidget::OnLoadScene()
 {
     const FWideString BaseDir = UTF8ToWide(GDataDir) + L"/Scenes";
@@ -636,10 +683,8 @@ void UMainToolbarWidget::OnLoadScene()
         GWorld->GetSelectionManager()->ClearSelection();
 
         std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, SelectedPath))
+        if (ULevelService::LoadLevelFromFile(NewLevel.get(), SelectedPath))
         {
-            NewLevel->Serialize(true, LevelJsonData);
             EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
         }
         else
@@ -795,6 +840,10 @@ void UMainToolbarWidget::ProcessPendingCommands()
         OnSaveScene();
         break;
 
+    case EToolbarCommand::ExportSceneJson:
+        OnExportSceneJson();
+        break;
+
     case EToolbarCommand::LoadScene:
         OnLoadScene();
         break;
@@ -898,11 +947,17 @@ void UMainToolbarWidget::HandleKeyboardShortcuts()
     }
 
     // Ctrl+S: Save Scene
-    if (io.KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_S, false))
+    if (io.KeyCtrl && !io.KeyShift && ImGui::IsKeyPressed(ImGuiKey_S, false))
     {
         PendingCommand = EToolbarCommand::SaveScene;
     }
 
+    // Ctrl+Shift+S: Export Scene as JSON
+    if (io.KeyCtrl && io.KeyShift && ImGui::IsKeyPressed(ImGuiKey_S, false))
+    {
+        PendingCommand = EToolbarCommand::ExportSceneJson;
+    }
+
     // Ctrl+O: Open/Load Scene
     if (io.KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_O, false))
     {
@@ -35,6 +35,8 @@ private:
     void OnNewScene();
     void OnSaveScene();
     void OnLoadScene();
+    // 현재 씬을 읽을 수 있는 JSON으로 내보내기 (저장은 바이너리만 쓰므로 필요할 때만 명시적으로 실행)
+    void OnExportSceneJson();
 
     // 키보드 입력 처리
     void HandleKeyboardShortcuts();
@@ -49,6 +51,7 @@ private:
         None,
         NewScene,
         SaveScene,
+        ExportSceneJson,
         LoadScene,
         SpawnActor,
         StartPIE,
@@ -30,6 +30,7 @@
 #include "SceneComponent.h"
 #include "Color.h"
 #include "PlatformProcess.h"
+#include "PrefabCache.h"
 #include "JsonSerializer.h"
 
 using namespace std;
@@ -338,10 +339,26 @@ void UTargetActorTransformWidget::RenderHeader(AActor* SelectedActor, UActorComp
 	if (ImGui::Button("to Prefab", ImVec2(80, 25)))
 	{
 		std::filesystem::path PrefabPath = FPlatformProcess::OpenSaveFileDialog(UTF8ToWide(GDataDir) + L"/Prefabs", L"prefab", L"Prefab Files", UTF8ToWide(SelectedActor->ObjectName.ToString()));
-		JSON ActorJson;
-		ActorJson["Type"] = SelectedActor->GetClass()->Name;
-		SelectedActor->Serialize(false, ActorJson);
-		bool bSuccess = FJsonSerializer::SaveJsonToFile(ActorJson, PrefabPath);
+		if (!PrefabPath.empty())
+		{
+			FPrefabCache::SavePrefabActor(SelectedActor, PrefabPath);
+		}
+	}
+	if (ImGui::BeginPopupContextItem("##ToPrefabContext"))
+	{
+		if (ImGui::MenuItem("JSON으로 내보내기..."))
+		{
+			std::filesystem::path JsonPath = FPlatformProcess::OpenSaveFileDialog(UTF8ToWide(GDataDir) + L"/Prefabs", L"json", L"Prefab JSON Files", UTF8ToWide(SelectedActor->ObjectName.ToString()));
+			if (!JsonPath.empty())
+			{
+				FPrefabCache::ExportPrefabActorToJson(SelectedActor, JsonPath);
+			}
+		}
+		ImGui::EndPopup();
+	}
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::SetTooltip("프리팹(바이너리)으로 저장합니다\n우클릭: JSON으로 내보내기");
 	}
 
 	ImGui::SameLine();
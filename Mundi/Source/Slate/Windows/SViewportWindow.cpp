@@ -1392,6 +1392,7 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				UStatsOverlayD2D::Get().SetShowTileCulling(false);
 				UStatsOverlayD2D::Get().SetShowLights(false);
 				UStatsOverlayD2D::Get().SetShowShadow(false);
+				UStatsOverlayD2D::Get().SetShowCulling(false);
 			}
 
 			if (ImGui::IsItemHovered())
@@ -1481,6 +1482,36 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("셉도우 맵 통계를 표시합니다. (셉도우 라이트 개수, 아틀라스 크기, 메모리 사용량)");
 			}
 
+			bool bCullingStats = UStatsOverlayD2D::Get().IsCullingVisible();
+			if (ImGui::Checkbox(" CULLING", &bCullingStats))
+			{
+				UStatsOverlayD2D::Get().ToggleCulling();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("절두체 컬링 통계를 표시합니다. (전체/가시/컬링된 프리미티브 수)");
+			}
+
+			bool bDrawCallStats = UStatsOverlayD2D::Get().IsDrawCallVisible();
+			if (ImGui::Checkbox(" DRAW CALLS", &bDrawCallStats))
+			{
+				UStatsOverlayD2D::Get().ToggleDrawCall();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("드로우 콜 통계를 표시합니다. (배치 수, 실제 드로우 콜 수, 인스턴싱으로 줄인 드로우 콜 수)");
+			}
+
+			bool bPIEStats = UStatsOverlayD2D::Get().IsPIEVisible();
+			if (ImGui::Checkbox(" PIE", &bPIEStats))
+			{
+				UStatsOverlayD2D::Get().TogglePIE();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("마지막 PIE 시작 시간을 표시합니다. (월드 복제, 등록, BeginPlay 단계별 시간)");
+			}
+
 			ImGui::EndMenu();
 		}
 
@@ -1849,6 +1880,19 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("타일 기반 라이트 컬링 설정");
 		}
 
+		// CPU HZB Occlusion Culling
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling);
+		if (ImGui::Checkbox("##OcclusionCulling", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_OcclusionCulling);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 오클루전 컬링 (CPU HZB)");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("화면을 크게 덮는 메시를 오클루더로 래스터화해 그 뒤에 가려진 메시를 그리지 않습니다.");
+		}
+
 		// ===== 그림자 안티 에일리어싱 =====
 		bool bShadowAA = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_ShadowAntiAliasing);
 		if (ImGui::Checkbox("##ShadowAA", &bShadowAA))